@@ -0,0 +1,122 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDiskCache
+#define ROOT_RDiskCache
+
+#include <ROOT/RStringView.hxx>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \class RDiskCache RDiskCache.hxx
+ * \ingroup IO
+ *
+ * The RDiskCache keeps byte ranges of (remote) files in a local directory, such that repeated reads of the same
+ * ranges are served from local disk. Entries are addressed by content: a file identifier (the UUID of a TFile, or any
+ * other string that identifies the content of a file, e.g. for RRawFile users), the offset and the length of the
+ * range. The cache is a read-through layer: a reader first tries Get() and, on a miss, reads from the file and calls
+ * Put().
+ *
+ * The size of the directory is bounded by a configurable cap. When the cap is exceeded, the least recently used
+ * entries are removed; the modification time of an entry serves as its last access time. Several threads and
+ * several processes can share the same directory: entries are written to a temporary file and atomically renamed,
+ * every entry records its key and is verified on reading, and the eviction is serialized by a lock file.
+ *
+ * A process-wide instance, configured by the `Cache.Directory` and `Cache.MaxSize` entries of the ROOT resource
+ * file, is returned by GetGlobal(). It is used by TFileCacheRead (and therefore TTreeCache) and TFilePrefetch for
+ * remote files.
+ */
+class RDiskCache {
+public:
+   /// Counters of the cache accesses of this process
+   struct RStats {
+      std::uint64_t fNHits = 0;
+      std::uint64_t fNMisses = 0;
+      std::uint64_t fHitBytes = 0;
+      std::uint64_t fMissBytes = 0;
+      std::uint64_t fNPuts = 0;
+      std::uint64_t fPutBytes = 0;
+      std::uint64_t fNEvictions = 0;
+      std::uint64_t fEvictedBytes = 0;
+      /// Fraction of the Get() calls that were served from the cache
+      double GetHitRate() const { return (fNHits + fNMisses) ? double(fNHits) / (fNHits + fNMisses) : 0.; }
+   };
+
+private:
+   /// The directory that contains the entries, in 256 sub-directories named after the first byte of their hash
+   std::string fDirectory;
+   /// The maximum size in bytes of the entries in the directory
+   std::uint64_t fMaxSize;
+
+   /// Protects fSize and fPutSinceScan and serializes the eviction within the process
+   std::mutex fLock;
+   /// Size of the directory as of the last scan, plus the entries put since; -1 until the first scan
+   std::int64_t fSize = -1;
+   /// Bytes put since the last scan; the directory is re-scanned regularly to account for the other processes
+   std::uint64_t fPutSinceScan = 0;
+   /// Makes the names of the temporary files unique within the process
+   std::atomic<std::uint64_t> fNTmpFiles{0};
+
+   std::atomic<std::uint64_t> fNHits{0};
+   std::atomic<std::uint64_t> fNMisses{0};
+   std::atomic<std::uint64_t> fHitBytes{0};
+   std::atomic<std::uint64_t> fMissBytes{0};
+   std::atomic<std::uint64_t> fNPuts{0};
+   std::atomic<std::uint64_t> fPutBytes{0};
+   std::atomic<std::uint64_t> fNEvictions{0};
+   std::atomic<std::uint64_t> fEvictedBytes{0};
+
+   static std::string GetKey(std::string_view fileId, std::uint64_t offset, std::size_t nbytes);
+   std::string GetEntryPath(const std::string &key) const;
+   /// Scan the directory and, if its size exceeds `limit`, remove the least recently used entries until the size is
+   /// below `target`. Must be called with fLock held.
+   void ScanAndEvict(std::uint64_t limit, std::uint64_t target);
+
+public:
+   RDiskCache(std::string_view directory, std::uint64_t maxSize);
+   RDiskCache(const RDiskCache &) = delete;
+   RDiskCache &operator=(const RDiskCache &) = delete;
+   ~RDiskCache() = default;
+
+   /// Copy the `nbytes` bytes at `offset` of the file `fileId` into `buffer`. Returns false on a cache miss, in which
+   /// case the content of `buffer` is undefined.
+   bool Get(std::string_view fileId, std::uint64_t offset, void *buffer, std::size_t nbytes);
+   /// Store the `nbytes` bytes at `offset` of the file `fileId`. Failures to write to the cache directory are not
+   /// reported: the entry is simply missing later on.
+   void Put(std::string_view fileId, std::uint64_t offset, const void *buffer, std::size_t nbytes);
+   /// Remove the least recently used entries until the directory is below the size cap
+   void Evict();
+   /// Remove all the entries
+   void Clear();
+
+   const std::string &GetDirectory() const { return fDirectory; }
+   std::uint64_t GetMaxSize() const { return fMaxSize; }
+   /// The size of the directory, as of the last scan plus the entries put by this process since
+   std::uint64_t GetSize();
+   RStats GetStats() const;
+   void Print() const;
+
+   /// The process-wide cache configured by `Cache.Directory` and `Cache.MaxSize` (in MB) in the ROOT resource file,
+   /// or nullptr if no cache directory is configured
+   static RDiskCache *GetGlobal();
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
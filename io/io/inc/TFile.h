@@ -22,6 +22,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include <atomic>
+#include <functional>
 
 #include "Compression.h"
 #include "TDirectoryFile.h"
@@ -36,6 +37,8 @@
 #ifdef R__USE_IMT
 #include "ROOT/TRWSpinLock.hxx"
 #include <mutex>
+#include <utility>
+#include <vector>
 #endif
 
 
@@ -114,6 +117,7 @@ protected:
 
 #ifdef R__USE_IMT
    std::mutex                                 fWriteMutex;  ///<!Lock for writing baskets / keys into the file.
+   std::vector<std::pair<const TObject *, std::function<void()>>> fPipelinedWriters; ///<!Objects writing baskets in background tasks, with the functions waiting for them
    static ROOT::Internal::RConcurrentHashColl fgTsSIHashes; ///<!TS Set of hashes built from read streamer infos
 #endif
 
@@ -268,6 +272,7 @@ public:
    virtual TProcessID *ReadProcessID(UShort_t pidf);
    virtual void        ReadStreamerInfo();
    virtual Int_t       Recover();
+           void        RegisterPipelinedWriter(const TObject *writer, std::function<void()> wait);
    virtual Int_t       ReOpen(Option_t *mode);
    virtual void        Seek(Long64_t offset, ERelativeTo pos = kBeg);
    virtual void        SetCacheRead(TFileCacheRead *cache, TObject* tree = 0, ECacheAction action = kDisconnect);
@@ -282,6 +287,8 @@ public:
    virtual void        ShowStreamerInfo();
            Int_t       Sizeof() const override;
            void        SumBuffer(Int_t bufsize);
+           void        UnregisterPipelinedWriter(const TObject *writer);
+           void        WaitForPipelinedWriters();
    virtual Bool_t      WriteBuffer(const char *buf, Int_t len);
            Int_t       Write(const char *name=nullptr, Int_t opt=0, Int_t bufsiz=0) override;
            Int_t       Write(const char *name=nullptr, Int_t opt=0, Int_t bufsiz=0) const override;
@@ -16,9 +16,17 @@
 
 #include "TFile.h"
 
+#include <string>
+
 class TBranch;
 class TFilePrefetch;
 
+namespace ROOT {
+namespace Internal {
+class RDiskCache;
+}
+}
+
 class TFileCacheRead : public TObject {
 
 protected:
@@ -72,6 +80,9 @@ protected:
 
    void SetEnablePrefetchingImpl(Bool_t setPrefetching = kFALSE); // Can not be virtual as it is called from the constructor.
 
+   ROOT::Internal::RDiskCache *GetDiskCache() const;
+   Bool_t ReadBuffersDiskCache(ROOT::Internal::RDiskCache *diskCache, Int_t first, Int_t nblocks);
+
 private:
    TFileCacheRead(const TFileCacheRead &) = delete;            //cannot be copied
    TFileCacheRead& operator=(const TFileCacheRead &) = delete;
@@ -116,6 +127,8 @@ public:
    virtual TFilePrefetch* GetPrefetchObj();
    virtual void        WaitFinishPrefetch();                  //Gracefully join the prefetching thread
 
+   static std::string  GetDiskCacheFileId(const TFile *file);
+
    ClassDef(TFileCacheRead,2)  //TFile cache when reading
 };
 
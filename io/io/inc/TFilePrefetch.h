@@ -20,6 +20,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 
 #ifdef R__LESS_INCLUDES
@@ -30,6 +31,12 @@ class TFPBlock;
 #include "TFPBlock.h"
 #endif
 
+namespace ROOT {
+namespace Internal {
+class RDiskCache;
+}
+}
+
 class TFilePrefetch : public TObject {
 
 private:
@@ -43,6 +50,7 @@ private:
    std::condition_variable fReadBlockAdded; // signal the addition of a new red block
    TSemaphore *fSemChangeFile;     // semaphore used when changin a file in TChain
    TString     fPathCache;         // path to the cache directory
+   std::unique_ptr<ROOT::Internal::RDiskCache> fDiskCache; //! local disk cache of the blocks, if any
    TStopwatch  fWaitTime;          // time wating to prefetch a buffer (in usec)
    Bool_t      fThreadJoined;      // mark if async thread was joined
    std::atomic<Bool_t> fPrefetchFinished;  // true if prefetching is over
@@ -68,11 +76,10 @@ public:
    Int_t     ThreadStart();
 
    Bool_t    SetCache(const char*);
-   Bool_t    CheckBlockInCache(char*&, TFPBlock*);
-   char     *GetBlockFromCache(const char*, Int_t);
+   Bool_t    ReadBlockFromCache(TFPBlock*);
    void      SaveBlockInCache(TFPBlock*);
+   ROOT::Internal::RDiskCache *GetCache() const { return fDiskCache.get(); }
 
-   Int_t     SumHex(const char*);
    Bool_t    BinarySearchReadList(TFPBlock*, Long64_t, Int_t, Int_t*);
    Long64_t  GetWaitTime();
 
@@ -0,0 +1,268 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RDiskCache.hxx>
+
+#include "TEnv.h"
+#include "TLockFile.h"
+#include "TMD5.h"
+#include "TSystem.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+/// Every entry starts with the magic string, followed by the length of the key, the key and the data
+const char kEntryMagic[4] = {'R', 'D', 'C', '1'};
+/// Temporary files older than this (in seconds) were left behind by a crashed writer
+constexpr Long_t kTmpFileMaxAge = 3600;
+/// A process waiting for the eviction lock breaks locks older than this (in seconds)
+constexpr Int_t kLockTimeLimit = 60;
+
+bool EndsWith(const std::string &str, const char *suffix)
+{
+   auto len = strlen(suffix);
+   return str.size() >= len && str.compare(str.size() - len, len, suffix) == 0;
+}
+} // anonymous namespace
+
+ROOT::Internal::RDiskCache::RDiskCache(std::string_view directory, std::uint64_t maxSize)
+   : fDirectory(directory), fMaxSize(maxSize)
+{
+   while (fDirectory.size() > 1 && fDirectory.back() == '/')
+      fDirectory.pop_back();
+   gSystem->mkdir(fDirectory.c_str(), kTRUE);
+}
+
+std::string ROOT::Internal::RDiskCache::GetKey(std::string_view fileId, std::uint64_t offset, std::size_t nbytes)
+{
+   std::string key(fileId);
+   key += ":" + std::to_string(offset) + ":" + std::to_string(nbytes);
+   return key;
+}
+
+std::string ROOT::Internal::RDiskCache::GetEntryPath(const std::string &key) const
+{
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+   md5.Final();
+   std::string hash = md5.AsString();
+   return fDirectory + "/" + hash.substr(0, 2) + "/" + hash;
+}
+
+bool ROOT::Internal::RDiskCache::Get(std::string_view fileId, std::uint64_t offset, void *buffer, std::size_t nbytes)
+{
+   const std::string key = GetKey(fileId, offset, nbytes);
+   const std::string path = GetEntryPath(key);
+
+   bool hit = false;
+   std::ifstream istrm(path, std::ios::binary | std::ios::in);
+   if (istrm) {
+      char magic[sizeof(kEntryMagic)];
+      std::uint32_t keyLen = 0;
+      istrm.read(magic, sizeof(magic));
+      istrm.read(reinterpret_cast<char *>(&keyLen), sizeof(keyLen));
+      // The key guards against hash collisions and against entries written by an incompatible version
+      if (istrm && memcmp(magic, kEntryMagic, sizeof(magic)) == 0 && keyLen == key.size()) {
+         std::string storedKey(keyLen, '\0');
+         istrm.read(&storedKey[0], keyLen);
+         if (istrm && storedKey == key) {
+            istrm.read(static_cast<char *>(buffer), nbytes);
+            hit = (static_cast<std::size_t>(istrm.gcount()) == nbytes);
+         }
+      }
+   }
+
+   if (!hit) {
+      fNMisses++;
+      fMissBytes += nbytes;
+      return false;
+   }
+
+   // The modification time of an entry is its last access time for the LRU eviction
+   Long_t now = time(nullptr);
+   gSystem->Utime(path.c_str(), now, now);
+   fNHits++;
+   fHitBytes += nbytes;
+   return true;
+}
+
+void ROOT::Internal::RDiskCache::Put(std::string_view fileId, std::uint64_t offset, const void *buffer,
+                                     std::size_t nbytes)
+{
+   const std::string key = GetKey(fileId, offset, nbytes);
+   const std::string path = GetEntryPath(key);
+   const std::uint64_t entrySize = sizeof(kEntryMagic) + sizeof(std::uint32_t) + key.size() + nbytes;
+   if (entrySize > fMaxSize)
+      return;
+
+   // Write to a file that no other process or thread uses and rename it to the entry when complete: readers
+   // either see the complete entry or no entry at all.
+   const std::string tmpPath =
+      path + "." + std::to_string(gSystem->GetPid()) + "." + std::to_string(fNTmpFiles++) + ".tmp";
+   {
+      std::ofstream ostrm(tmpPath, std::ios::binary | std::ios::out | std::ios::trunc);
+      if (!ostrm) {
+         gSystem->mkdir(path.substr(0, path.rfind('/')).c_str(), kTRUE);
+         ostrm.open(tmpPath, std::ios::binary | std::ios::out | std::ios::trunc);
+         if (!ostrm)
+            return;
+      }
+      std::uint32_t keyLen = key.size();
+      ostrm.write(kEntryMagic, sizeof(kEntryMagic));
+      ostrm.write(reinterpret_cast<const char *>(&keyLen), sizeof(keyLen));
+      ostrm.write(key.data(), key.size());
+      ostrm.write(static_cast<const char *>(buffer), nbytes);
+      ostrm.close();
+      if (!ostrm) {
+         gSystem->Unlink(tmpPath.c_str());
+         return;
+      }
+   }
+   if (gSystem->Rename(tmpPath.c_str(), path.c_str()) != 0) {
+      gSystem->Unlink(tmpPath.c_str());
+      return;
+   }
+   fNPuts++;
+   fPutBytes += nbytes;
+
+   std::lock_guard<std::mutex> guard(fLock);
+   fPutSinceScan += entrySize;
+   if (fSize >= 0)
+      fSize += entrySize;
+   // Other processes fill the directory too: scan it again after a fraction of the cap was put by this process.
+   if (fSize < 0 || static_cast<std::uint64_t>(fSize) > fMaxSize || fPutSinceScan > fMaxSize / 16)
+      ScanAndEvict(fMaxSize, fMaxSize - fMaxSize / 10);
+}
+
+void ROOT::Internal::RDiskCache::ScanAndEvict(std::uint64_t limit, std::uint64_t target)
+{
+   struct REntry {
+      Long_t fMtime;
+      std::uint64_t fSize;
+      std::string fPath;
+   };
+
+   // Serialize the scan and the eviction with the other processes using the directory
+   TLockFile lock((fDirectory + "/.lock").c_str(), kLockTimeLimit);
+
+   std::vector<REntry> entries;
+   std::uint64_t size = 0;
+   const Long_t now = time(nullptr);
+   for (int i = 0; i < 256; ++i) {
+      char subdir[3];
+      snprintf(subdir, sizeof(subdir), "%02x", i);
+      const std::string dirPath = fDirectory + "/" + subdir;
+      void *dirp = gSystem->OpenDirectory(dirPath.c_str());
+      if (!dirp)
+         continue;
+      while (const char *name = gSystem->GetDirEntry(dirp)) {
+         if (name[0] == '.')
+            continue;
+         std::string path = dirPath + "/" + name;
+         FileStat_t stat;
+         if (gSystem->GetPathInfo(path.c_str(), stat) != 0 || !R_ISREG(stat.fMode))
+            continue;
+         if (EndsWith(path, ".tmp")) {
+            if (now - stat.fMtime > kTmpFileMaxAge)
+               gSystem->Unlink(path.c_str());
+            continue;
+         }
+         size += stat.fSize;
+         entries.push_back({stat.fMtime, static_cast<std::uint64_t>(stat.fSize), std::move(path)});
+      }
+      gSystem->FreeDirectory(dirp);
+   }
+
+   if (size > limit) {
+      std::sort(entries.begin(), entries.end(), [](const REntry &a, const REntry &b) { return a.fMtime < b.fMtime; });
+      for (const auto &entry : entries) {
+         if (size <= target)
+            break;
+         if (gSystem->Unlink(entry.fPath.c_str()) != 0)
+            continue;
+         size -= entry.fSize;
+         fNEvictions++;
+         fEvictedBytes += entry.fSize;
+      }
+   }
+
+   fSize = size;
+   fPutSinceScan = 0;
+}
+
+void ROOT::Internal::RDiskCache::Evict()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   ScanAndEvict(fMaxSize, fMaxSize - fMaxSize / 10);
+}
+
+void ROOT::Internal::RDiskCache::Clear()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   ScanAndEvict(0, 0);
+}
+
+std::uint64_t ROOT::Internal::RDiskCache::GetSize()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   if (fSize < 0)
+      ScanAndEvict(fMaxSize, fMaxSize - fMaxSize / 10);
+   return fSize;
+}
+
+ROOT::Internal::RDiskCache::RStats ROOT::Internal::RDiskCache::GetStats() const
+{
+   RStats stats;
+   stats.fNHits = fNHits;
+   stats.fNMisses = fNMisses;
+   stats.fHitBytes = fHitBytes;
+   stats.fMissBytes = fMissBytes;
+   stats.fNPuts = fNPuts;
+   stats.fPutBytes = fPutBytes;
+   stats.fNEvictions = fNEvictions;
+   stats.fEvictedBytes = fEvictedBytes;
+   return stats;
+}
+
+void ROOT::Internal::RDiskCache::Print() const
+{
+   auto stats = GetStats();
+   printf("******DiskCache for directory: %s ******\n", fDirectory.c_str());
+   printf("Maximum size............: %llu bytes\n", static_cast<unsigned long long>(fMaxSize));
+   printf("Number of hits..........: %llu (%llu bytes)\n", static_cast<unsigned long long>(stats.fNHits),
+          static_cast<unsigned long long>(stats.fHitBytes));
+   printf("Number of misses........: %llu (%llu bytes)\n", static_cast<unsigned long long>(stats.fNMisses),
+          static_cast<unsigned long long>(stats.fMissBytes));
+   printf("Hit rate................: %6.2f %%\n", 100. * stats.GetHitRate());
+   printf("Number of entries put...: %llu (%llu bytes)\n", static_cast<unsigned long long>(stats.fNPuts),
+          static_cast<unsigned long long>(stats.fPutBytes));
+   printf("Number of evictions.....: %llu (%llu bytes)\n", static_cast<unsigned long long>(stats.fNEvictions),
+          static_cast<unsigned long long>(stats.fEvictedBytes));
+}
+
+ROOT::Internal::RDiskCache *ROOT::Internal::RDiskCache::GetGlobal()
+{
+   static std::unique_ptr<RDiskCache> gDiskCache = []() {
+      std::unique_ptr<RDiskCache> cache;
+      std::string directory = gEnv->GetValue("Cache.Directory", "");
+      Long64_t maxSizeMB = gEnv->GetValue("Cache.MaxSize", 1024);
+      if (!directory.empty() && maxSizeMB > 0)
+         cache.reset(new RDiskCache(directory, maxSizeMB * 1024 * 1024));
+      return cache;
+   }();
+   return gDiskCache.get();
+}
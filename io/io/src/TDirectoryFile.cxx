@@ -147,6 +147,7 @@ TDirectoryFile::TDirectoryFile(const char *name, const char *title, Option_t *cl
 void TDirectoryFile::InitDirectoryFile(TClass *cl)
 {
    TFile* f = GetFile(); // NOLINT: silence clang-tidy warnings
+   f->WaitForPipelinedWriters();
    if (f->IsBinary()) {
       if (!cl) {
          cl = IsA(); // NOLINT: silence clang-tidy warnings
@@ -1865,6 +1866,8 @@ Int_t TDirectoryFile::WriteTObject(const TObject *obj, const char *name, Option_
 
    if (!obj) return 0;
 
+   fFile->WaitForPipelinedWriters();
+
    TString opt = option;
    opt.ToLower();
 
@@ -2004,6 +2007,8 @@ Int_t TDirectoryFile::WriteObjectAny(const void *obj, const TClass *cl, const ch
 
    if (!obj) return 0;
 
+   fFile->WaitForPipelinedWriters();
+
    const char *className = cl->GetName();
    const char *oname;
    if (name && *name)
@@ -2079,6 +2084,7 @@ void TDirectoryFile::WriteDirHeader()
 {
    TFile* f = GetFile();
    if (!f) return;
+   f->WaitForPipelinedWriters();
 
    if (!f->IsBinary()) {
       fDatimeM.Set();
@@ -2108,6 +2114,7 @@ void TDirectoryFile::WriteKeys()
 {
    TFile* f = GetFile();
    if (!f) return;
+   f->WaitForPipelinedWriters();
 
    if (!f->IsBinary()) {
       f->DirWriteKeys(this);
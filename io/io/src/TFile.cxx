@@ -128,6 +128,7 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "TObjString.h"
 #include "TStopwatch.h"
 #include "compiledata.h"
+#include <algorithm>
 #include <cmath>
 #include <set>
 #include "TSchemaRule.h"
@@ -880,6 +881,9 @@ void TFile::Close(Option_t *option)
 
    if (!IsOpen()) return;
 
+   // The baskets still being written must be in the file before the objects and the keys
+   WaitForPipelinedWriters();
+
    if (fIsArchive || !fIsRootFile) {
       FlushWriteCache();
       SysClose(fD);
@@ -1057,6 +1061,7 @@ void TFile::DrawMap(const char *keys, Option_t *option)
 void TFile::Flush()
 {
    if (IsOpen() && fWritable) {
+      WaitForPipelinedWriters();
       FlushWriteCache();
       if (SysSync(fD) < 0) {
          // Write the system error only once for this file
@@ -1395,6 +1400,7 @@ Bool_t TFile::IsOpen() const
 
 void TFile::MakeFree(Long64_t first, Long64_t last)
 {
+   WaitForPipelinedWriters();
    TFree *f1      = (TFree*)fFree->First();
    if (!f1) return;
    TFree *newfree = f1->AddFree(fFree,first,last);
@@ -2284,6 +2290,60 @@ void TFile::SumBuffer(Int_t bufsize)
    fSum2Buffer += double(bufsize) * double(bufsize); // avoid reaching MAXINT for temporary
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Register an object that writes baskets to this file in background tasks,
+/// e.g. a TTree with a pipelined Fill (see TTree::SetPipelinedFill).
+///
+/// The tasks only serialize their writes with each other: the other writes to
+/// the file, which are not meant to be concurrent, call WaitForPipelinedWriters
+/// first, which calls `wait` until the writer is unregistered.
+
+void TFile::RegisterPipelinedWriter(const TObject *writer, std::function<void()> wait)
+{
+#ifdef R__USE_IMT
+   UnregisterPipelinedWriter(writer);
+   fPipelinedWriters.emplace_back(writer, std::move(wait));
+#else
+   (void)writer;
+   (void)wait;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Unregister an object registered with RegisterPipelinedWriter. The object
+/// must not have background tasks writing to this file anymore.
+
+void TFile::UnregisterPipelinedWriter(const TObject *writer)
+{
+#ifdef R__USE_IMT
+   fPipelinedWriters.erase(std::remove_if(fPipelinedWriters.begin(), fPipelinedWriters.end(),
+                                          [writer](const std::pair<const TObject *, std::function<void()>> &w) {
+                                             return w.first == writer;
+                                          }),
+                           fPipelinedWriters.end());
+#else
+   (void)writer;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the background tasks of the objects registered with
+/// RegisterPipelinedWriter. Called before writing keys, headers or free
+/// segments to the file, so that these writes cannot interleave with the
+/// writes of the tasks.
+
+void TFile::WaitForPipelinedWriters()
+{
+#ifdef R__USE_IMT
+   if (fPipelinedWriters.empty())
+      return;
+   // A writer may unregister while waiting
+   auto writers = fPipelinedWriters;
+   for (auto &writer : writers)
+      writer.second();
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Write memory objects to this file.
 ///
@@ -2405,6 +2465,7 @@ Int_t TFile::WriteBufferViaCache(const char *buf, Int_t len)
 
 void TFile::WriteFree()
 {
+   WaitForPipelinedWriters();
    //*-* Delete old record if it exists
    if (fSeekFree != 0) {
       MakeFree(fSeekFree, fSeekFree + fNbytesFree -1);
@@ -2477,6 +2538,7 @@ void TFile::WriteFree()
 
 void TFile::WriteHeader()
 {
+   WaitForPipelinedWriters();
    SafeDelete(fInfoCache);
    TFree *lastfree = (TFree*)fFree->Last();
    if (lastfree) fEND  = lastfree->GetFirst();
@@ -3665,6 +3727,8 @@ void TFile::WriteStreamerInfo()
    }
    if (gDebug > 0) Info("WriteStreamerInfo", "called for file %s",GetName());
 
+   WaitForPipelinedWriters();
+
    SafeDelete(fInfoCache);
 
    // build a temporary list with the marked files
@@ -23,6 +23,13 @@
  TXNetFile and TWebFile (via TFile::ReadBuffers()).
  When processing TTree, TChain, a specialized class TTreeCache that
  derives from this class is automatically created.
+
+ If a local disk cache directory is configured with the `Cache.Directory`
+ entry of the ROOT resource file, the blocks of remote files are also kept
+ on local disk, up to `Cache.MaxSize` MB (see ROOT::Internal::RDiskCache),
+ such that repeated passes over the same remote files read them from local
+ disk. The blocks are keyed by the UUID and the size of the file: files that
+ are updated in place must not be read through the disk cache.
 */
 
 #include "TEnv.h"
@@ -31,6 +38,12 @@
 #include "TFileCacheWrite.h"
 #include "TFilePrefetch.h"
 #include "TMathBase.h"
+#include "TUUID.h"
+
+#include <ROOT/RDiskCache.hxx>
+
+#include <cstdio>
+#include <string>
 
 ClassImp(TFileCacheRead);
 
@@ -444,6 +457,68 @@ Int_t TFileCacheRead::ReadBufferExtPrefetch(char *buf, Long64_t pos, Int_t len,
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the local disk cache to use for the file of this cache, if any.
+///
+/// Only remote files that are not being written are kept in the disk cache.
+
+ROOT::Internal::RDiskCache *TFileCacheRead::GetDiskCache() const
+{
+   if (!fFile || fFile->IsWritable() || !strcmp(fFile->GetEndpointUrl()->GetProtocol(), "file"))
+      return nullptr;
+   return ROOT::Internal::RDiskCache::GetGlobal();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the identifier of the content of `file` in the local disk cache:
+/// its UUID and its size.
+
+std::string TFileCacheRead::GetDiskCacheFileId(const TFile *file)
+{
+   // Not using TUUID::AsString(), which returns a static buffer: the
+   // prefetching thread also calls this function.
+   UChar_t uuid[16];
+   file->GetUUID().GetUUID(uuid);
+   std::string fileId;
+   char hex[3];
+   for (auto byte : uuid) {
+      snprintf(hex, sizeof(hex), "%02x", byte);
+      fileId += hex;
+   }
+   return fileId + "-" + std::to_string(file->GetEND());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the sorted blocks [first, first + nblocks) into fBuffer, taking the
+/// blocks found in the local disk cache from there and storing the others
+/// in the disk cache once read from the file. Return kTRUE in case of error.
+
+Bool_t TFileCacheRead::ReadBuffersDiskCache(ROOT::Internal::RDiskCache *diskCache, Int_t first, Int_t nblocks)
+{
+   const std::string fileId = GetDiskCacheFileId(fFile);
+
+   // The blocks are stored in fBuffer in the order of their position, hence a
+   // run of consecutive blocks missing from the disk cache is read with one call.
+   Int_t firstMissing = -1;
+   for (Int_t i = first; i <= first + nblocks; ++i) {
+      if (i < first + nblocks && !diskCache->Get(fileId, fSeekSort[i], &fBuffer[fSeekPos[i]], fSeekSortLen[i])) {
+         if (firstMissing < 0)
+            firstMissing = i;
+         continue;
+      }
+      if (firstMissing >= 0) {
+         if (fFile->ReadBuffers(&fBuffer[fSeekPos[firstMissing]], &fSeekSort[firstMissing],
+                                &fSeekSortLen[firstMissing], i - firstMissing)) {
+            return kTRUE;
+         }
+         for (Int_t j = firstMissing; j < i; ++j)
+            diskCache->Put(fileId, fSeekSort[j], &fBuffer[fSeekPos[j]], fSeekSortLen[j]);
+         firstMissing = -1;
+      }
+   }
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Base function for ReadBuffer.
 ///
@@ -458,8 +533,13 @@ Int_t TFileCacheRead::ReadBufferExtNormal(char *buf, Long64_t pos, Int_t len, In
 
       // If ReadBufferAsync is not supported by this implementation...
       if (!fAsyncReading) {
-         // Then we use the vectored read to read everything now
-         if (fFile->ReadBuffers(fBuffer,fPos,fLen,fNb)) {
+         // Then we use the vectored read to read everything now,
+         // unless (some of) the blocks are in the local disk cache
+         if (ROOT::Internal::RDiskCache *diskCache = GetDiskCache()) {
+            if (ReadBuffersDiskCache(diskCache, 0, fNseek)) {
+               return -1;
+            }
+         } else if (fFile->ReadBuffers(fBuffer,fPos,fLen,fNb)) {
             return -1;
          }
          fIsTransferred = kTRUE;
@@ -10,14 +10,17 @@
  *************************************************************************/
 
 #include "TFilePrefetch.h"
+#include "TEnv.h"
+#include "TFileCacheRead.h"
 #include "TTimeStamp.h"
 #include "TSystem.h"
-#include "TMD5.h"
 #include "TVirtualPerfStats.h"
 #include "TVirtualMonitoring.h"
 #include "TSemaphore.h"
 #include "TFPBlock.h"
 
+#include <ROOT/RDiskCache.hxx>
+
 #include <iostream>
 #include <string>
 #include <sstream>
@@ -28,8 +31,6 @@
 
 static const int kMAX_READ_SIZE    = 2;   //maximum size of the read list of blocks
 
-inline int xtod(char c) { return (c>='0' && c<='9') ? c-'0' : ((c>='A' && c<='F') ? c-'A'+10 : ((c>='a' && c<='f') ? c-'a'+10 : 0)); }
-
 using namespace std;
 
 ClassImp(TFilePrefetch);
@@ -107,21 +108,17 @@ void TFilePrefetch::WaitFinishPrefetch()
 
 void TFilePrefetch::ReadAsync(TFPBlock* block, Bool_t &inCache)
 {
-   char* path = 0;
-
-   if (CheckBlockInCache(path, block)){
-      block->SetBuffer(GetBlockFromCache(path, block->GetDataSize()));
+   if (ReadBlockFromCache(block)) {
       inCache = kTRUE;
    }
    else{
       fFile->ReadBuffers(block->GetBuffer(), block->GetPos(), block->GetLen(), block->GetNoElem());
-      if (fFile->GetArchive()) {
-         for (Int_t i = 0; i < block->GetNoElem(); i++)
-            block->SetPos(i, block->GetPos(i) - fFile->GetArchiveOffset());
-      }
       inCache =kFALSE;
    }
-   delete[] path;
+   if (fFile->GetArchive()) {
+      for (Int_t i = 0; i < block->GetNoElem(); i++)
+         block->SetPos(i, block->GetPos(i) - fFile->GetArchiveOffset());
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -378,82 +375,24 @@ TThread::VoidRtnFunc_t TFilePrefetch::ThreadProc(void* arg)
 //############################# CACHING PART ###################################
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Sum up individual hex values to obtain a decimal value.
+/// Read all the pieces of the block from the local disk cache. Return kFALSE
+/// if the cache is not set or if any piece is missing.
 
-Int_t TFilePrefetch::SumHex(const char *hex)
+Bool_t TFilePrefetch::ReadBlockFromCache(TFPBlock* block)
 {
-   Int_t result = 0;
-   const char* ptr = hex;
-
-   for(Int_t i=0; i < (Int_t)strlen(hex); i++)
-      result += xtod(ptr[i]);
-
-   return result;
-}
-
-////////////////////////////////////////////////////////////////////////////////
-/// Test if the block is in cache.
-
-Bool_t TFilePrefetch::CheckBlockInCache(char*& path, TFPBlock* block)
-{
-   if (fPathCache == "")
-      return false;
-
-   Bool_t found = false;
-   TString fullPath(fPathCache); // path of the cached files.
-
-   Int_t value = 0;
-
-   if (!gSystem->OpenDirectory(fullPath))
-      gSystem->mkdir(fullPath);
-
-   //dir is SHA1 value modulo 16; filename is the value of the SHA1(offset+len)
-   TMD5* md = new TMD5();
-
-   TString concatStr;
-   for (Int_t i=0; i < block->GetNoElem(); i++){
-      concatStr.Form("%lld", block->GetPos(i));
-      md->Update((UChar_t*)concatStr.Data(), concatStr.Length());
-   }
-
-   md->Final();
-   TString fileName( md->AsString() );
-   value = SumHex(fileName);
-   value = value % 16;
-   TString dirName;
-   dirName.Form("%i", value);
-
-   fullPath += "/" + dirName + "/" + fileName;
-
-   FileStat_t stat;
-   if (gSystem->GetPathInfo(fullPath, stat) == 0) {
-      path = new char[fullPath.Length() + 1];
-      strlcpy(path, fullPath,fullPath.Length() + 1);
-      found = true;
-   } else
-      found = false;
-
-   delete md;
-   return found;
-}
-
-////////////////////////////////////////////////////////////////////////////////
-/// Return a buffer from cache.
-
-char* TFilePrefetch::GetBlockFromCache(const char* path, Int_t length)
-{
-   char *buffer = 0;
-   TString strPath = path;
-
-   strPath += "?filetype=raw";
-   TFile* file = new TFile(strPath);
+   if (!fDiskCache)
+      return kFALSE;
 
    Double_t start = 0;
    if (gPerfStats != 0) start = TTimeStamp();
 
-   buffer = (char*) calloc(length, sizeof(char));
-   file->ReadBuffer(buffer, 0, length);
+   const std::string fileId = TFileCacheRead::GetDiskCacheFileId(fFile);
+   for (Int_t i = 0; i < block->GetNoElem(); i++) {
+      if (!fDiskCache->Get(fileId, block->GetPos(i), block->GetPtrToPiece(i), block->GetLen(i)))
+         return kFALSE;
+   }
 
+   Long64_t length = block->GetDataSize();
    fFile->fBytesRead  += length;
    fFile->fgBytesRead += length;
    fFile->SetReadCalls(fFile->GetReadCalls() + 1);
@@ -464,76 +403,45 @@ char* TFilePrefetch::GetBlockFromCache(const char* path, Int_t length)
    if (gPerfStats != 0) {
       gPerfStats->FileReadEvent(fFile, length, start);
    }
-
-   file->Close();
-   delete file;
-   return buffer;
+   return kTRUE;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Save the block content in cache.
+/// Save the pieces of the block, once read by ReadAsync, in the local disk cache.
 
 void TFilePrefetch::SaveBlockInCache(TFPBlock* block)
 {
-   if (fPathCache == "")
+   if (!fDiskCache)
       return;
 
-   //dir is SHA1 value modulo 16; filename is the value of the SHA1
-   TMD5* md = new TMD5();
-
-   TString concatStr;
-   for(Int_t i=0; i< block->GetNoElem(); i++){
-      concatStr.Form("%lld", block->GetPos(i));
-      md->Update((UChar_t*)concatStr.Data(), concatStr.Length());
-   }
-   md->Final();
-
-   TString fileName( md->AsString() );
-   Int_t value = SumHex(fileName);
-   value = value % 16;
-
-   TString fullPath( fPathCache );
-   TString dirName;
-   dirName.Form("%i", value);
-   fullPath += ("/" + dirName);
-
-   if (!gSystem->OpenDirectory(fullPath))
-      gSystem->mkdir(fullPath);
-
-   TFile* file = 0;
-   fullPath += ("/" + fileName);
-   FileStat_t stat;
-   if (gSystem->GetPathInfo(fullPath, stat) == 0) {
-      fullPath += "?filetype=raw";
-      file = TFile::Open(fullPath, "update");
-   } else{
-      fullPath += "?filetype=raw";
-      file = TFile::Open(fullPath, "new");
-   }
-
-   if (file) {
-      // coverity[unchecked_value] We do not print error message, have not error
-      // return code and close the file anyway, not need to check the return value.
-      file->WriteBuffer(block->GetBuffer(), block->GetDataSize());
-      file->Close();
-      delete file;
-   }
-   delete md;
+   // ReadAsync made the positions relative to the archive member, if any
+   Long64_t offset = fFile->GetArchive() ? fFile->GetArchiveOffset() : 0;
+   const std::string fileId = TFileCacheRead::GetDiskCacheFileId(fFile);
+   for (Int_t i = 0; i < block->GetNoElem(); i++)
+      fDiskCache->Put(fileId, block->GetPos(i) + offset, block->GetPtrToPiece(i), block->GetLen(i));
 }
 
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the path of the cache directory.
+///
+/// The blocks are kept in a ROOT::Internal::RDiskCache bounded by the
+/// `Cache.MaxSize` (in MB) entry of the ROOT resource file; a non-positive
+/// size disables the cache.
 
 Bool_t TFilePrefetch::SetCache(const char* path)
 {
-  fPathCache = path;
-
-  if (!gSystem->OpenDirectory(path)){
-    return (!gSystem->mkdir(path) ? true : false);
-  }
-
-  // Directory already exists
-  return true;
+   fPathCache = path;
+   fDiskCache.reset();
+
+   Long64_t maxSizeMB = gEnv->GetValue("Cache.MaxSize", 1024);
+   if (maxSizeMB <= 0)
+      return kTRUE;
+   fDiskCache.reset(new ROOT::Internal::RDiskCache(path, maxSizeMB * 1024 * 1024));
+   if (gSystem->AccessPathName(path, kWritePermission)) {
+      fDiskCache.reset();
+      return kFALSE;
+   }
+   return kTRUE;
 }
 
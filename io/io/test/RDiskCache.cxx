@@ -0,0 +1,120 @@
+#include "ROOT/RDiskCache.hxx"
+#include "TSystem.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using RDiskCache = ROOT::Internal::RDiskCache;
+
+namespace {
+
+/**
+ * An RAII wrapper around a cache directory. It removes the entries and the directory when the wrapper object goes
+ * out of scope.
+ */
+class DirectoryRaii {
+private:
+   std::string fPath;
+public:
+   explicit DirectoryRaii(const std::string &path) : fPath(path) {}
+   DirectoryRaii(const DirectoryRaii&) = delete;
+   DirectoryRaii& operator=(const DirectoryRaii&) = delete;
+   ~DirectoryRaii() {
+      RDiskCache(fPath, 1).Clear();
+      for (int i = 0; i < 256; ++i) {
+         char subdir[3];
+         snprintf(subdir, sizeof(subdir), "%02x", i);
+         gSystem->Unlink((fPath + "/" + subdir).c_str());
+      }
+      gSystem->Unlink(fPath.c_str());
+   }
+   const std::string &GetPath() const { return fPath; }
+};
+
+} // anonymous namespace
+
+
+TEST(RDiskCache, Basics)
+{
+   DirectoryRaii dir("test_rdiskcache_basics");
+   RDiskCache cache(dir.GetPath(), 1024 * 1024);
+
+   char buffer[8];
+   EXPECT_FALSE(cache.Get("file1", 0, buffer, 4));
+   cache.Put("file1", 0, "abcd", 4);
+   cache.Put("file1", 4, "efgh", 4);
+   cache.Put("file2", 0, "ijkl", 4);
+
+   memset(buffer, 0, sizeof(buffer));
+   EXPECT_TRUE(cache.Get("file1", 0, buffer, 4));
+   EXPECT_EQ(std::string("abcd"), std::string(buffer, 4));
+   EXPECT_TRUE(cache.Get("file1", 4, buffer, 4));
+   EXPECT_EQ(std::string("efgh"), std::string(buffer, 4));
+   EXPECT_TRUE(cache.Get("file2", 0, buffer, 4));
+   EXPECT_EQ(std::string("ijkl"), std::string(buffer, 4));
+
+   // Entries are keyed by file, offset and length
+   EXPECT_FALSE(cache.Get("file2", 4, buffer, 4));
+   EXPECT_FALSE(cache.Get("file1", 0, buffer, 8));
+   EXPECT_FALSE(cache.Get("file3", 0, buffer, 4));
+
+   auto stats = cache.GetStats();
+   EXPECT_EQ(3u, stats.fNHits);
+   EXPECT_EQ(12u, stats.fHitBytes);
+   EXPECT_EQ(4u, stats.fNMisses);
+   EXPECT_EQ(3u, stats.fNPuts);
+   EXPECT_DOUBLE_EQ(3. / 7., stats.GetHitRate());
+
+   cache.Clear();
+   EXPECT_FALSE(cache.Get("file1", 0, buffer, 4));
+   EXPECT_EQ(0u, cache.GetSize());
+}
+
+TEST(RDiskCache, Shared)
+{
+   DirectoryRaii dir("test_rdiskcache_shared");
+   // Two instances on the same directory, as in two processes
+   RDiskCache writer(dir.GetPath(), 1024 * 1024);
+   RDiskCache reader(dir.GetPath(), 1024 * 1024);
+
+   std::vector<char> data(1000, 'x');
+   writer.Put("file", 1000, data.data(), data.size());
+
+   std::vector<char> buffer(data.size());
+   EXPECT_TRUE(reader.Get("file", 1000, buffer.data(), buffer.size()));
+   EXPECT_EQ(data, buffer);
+   EXPECT_EQ(1u, reader.GetStats().fNHits);
+   EXPECT_GE(reader.GetSize(), data.size());
+}
+
+TEST(RDiskCache, Eviction)
+{
+   DirectoryRaii dir("test_rdiskcache_eviction");
+   const std::uint64_t maxSize = 10000;
+   RDiskCache cache(dir.GetPath(), maxSize);
+
+   std::vector<char> data(1000, 'y');
+   for (int i = 0; i < 30; ++i)
+      cache.Put("file", i * data.size(), data.data(), data.size());
+
+   EXPECT_LE(cache.GetSize(), maxSize);
+   auto stats = cache.GetStats();
+   EXPECT_EQ(30u, stats.fNPuts);
+   EXPECT_GT(stats.fNEvictions, 0u);
+
+   unsigned nhits = 0;
+   std::vector<char> buffer(data.size());
+   for (int i = 0; i < 30; ++i)
+      nhits += cache.Get("file", i * data.size(), buffer.data(), buffer.size());
+   EXPECT_GT(nhits, 0u);
+   EXPECT_LT(nhits, 30u);
+
+   // Entries larger than the cache are not stored
+   std::vector<char> large(2 * maxSize, 'z');
+   cache.Put("file", 0, large.data(), large.size());
+   EXPECT_EQ(30u, cache.GetStats().fNPuts);
+}
@@ -0,0 +1,31 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RCACHEOPTIONS
+#define ROOT_RCACHEOPTIONS
+
+#include <string>
+
+namespace ROOT {
+
+namespace RDF {
+/// A collection of options to steer the persistent, on-disk caching of columns with RInterface::Cache
+struct RCacheOptions {
+   RCacheOptions() = default;
+   RCacheOptions(const RCacheOptions &) = default;
+   RCacheOptions(RCacheOptions &&) = default;
+   RCacheOptions(const std::string &directory, const std::string &key = "") : fDirectory(directory), fKey(key) {}
+   std::string fDirectory; ///< Directory of the cache files. If empty, the temporary directory of the system is used
+   /// Added to the cache key. Required if the graph contains Filters or Defines with compiled callables: their code is
+   /// not part of the key, so the key must be changed whenever they change. Jitted expressions are hashed anyway.
+   std::string fKey;
+};
+} // ns RDF
+} // ns ROOT
+
+#endif
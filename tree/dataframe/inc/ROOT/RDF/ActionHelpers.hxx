@@ -48,6 +48,8 @@
 namespace ROOT {
 namespace Detail {
 namespace RDF {
+// Helpers that implement `Helper MakeNew(const std::shared_ptr<void> &newResult)`, returning a helper of the same
+// kind that fills `newResult`, can be booked for the systematic variations registered with RInterface::Vary.
 template <typename Helper>
 class RActionImpl {
 public:
@@ -124,6 +126,11 @@ public:
    void Finalize();
    ULong64_t &PartialUpdate(unsigned int slot);
 
+   CountHelper MakeNew(const std::shared_ptr<void> &newResult)
+   {
+      return CountHelper(std::static_pointer_cast<ULong64_t>(newResult), fCounts.size());
+   }
+
    std::string GetActionName() { return "Count"; }
 };
 
@@ -238,6 +245,11 @@ public:
 
    void Finalize();
 
+   FillHelper MakeNew(const std::shared_ptr<void> &newResult)
+   {
+      return FillHelper(std::static_pointer_cast<Hist_t>(newResult), fNSlots);
+   }
+
    std::string GetActionName() { return "Fill"; }
 };
 
@@ -430,6 +442,11 @@ public:
 
    HIST &PartialUpdate(unsigned int slot) { return *fObjects[slot]; }
 
+   FillParHelper MakeNew(const std::shared_ptr<void> &newResult)
+   {
+      return FillParHelper(std::static_pointer_cast<HIST>(newResult), fObjects.size());
+   }
+
    std::string GetActionName() { return "FillPar"; }
 };
 
@@ -744,6 +761,11 @@ public:
 
    ResultType &PartialUpdate(unsigned int slot) { return fMins[slot]; }
 
+   MinHelper MakeNew(const std::shared_ptr<void> &newResult)
+   {
+      return MinHelper(std::static_pointer_cast<ResultType>(newResult), fMins.size());
+   }
+
    std::string GetActionName() { return "Min"; }
 };
 
@@ -789,6 +811,11 @@ public:
 
    ResultType &PartialUpdate(unsigned int slot) { return fMaxs[slot]; }
 
+   MaxHelper MakeNew(const std::shared_ptr<void> &newResult)
+   {
+      return MaxHelper(std::static_pointer_cast<ResultType>(newResult), fMaxs.size());
+   }
+
    std::string GetActionName() { return "Max"; }
 };
 
@@ -847,6 +874,11 @@ public:
 
    ResultType &PartialUpdate(unsigned int slot) { return fSums[slot]; }
 
+   SumHelper MakeNew(const std::shared_ptr<void> &newResult)
+   {
+      return SumHelper(std::static_pointer_cast<ResultType>(newResult), fSums.size());
+   }
+
    std::string GetActionName() { return "Sum"; }
 };
 
@@ -878,6 +910,11 @@ public:
 
    double &PartialUpdate(unsigned int slot);
 
+   MeanHelper MakeNew(const std::shared_ptr<void> &newResult)
+   {
+      return MeanHelper(std::static_pointer_cast<double>(newResult), fSums.size());
+   }
+
    std::string GetActionName() { return "Mean"; }
 };
 
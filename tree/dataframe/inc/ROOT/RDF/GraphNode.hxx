@@ -46,6 +46,8 @@ private:
       fDefinedColumns; ///< Columns defined up to this node. By checking the defined columns between two consecutive
                        ///< nodes, it is possible to know if there was some Define in between.
    std::shared_ptr<GraphNode> fPrevNode;
+   std::string fExpression; ///< The expression of a jitted Filter or Define, empty for the other nodes
+   bool fHasCallable = false; ///< Whether the node is a Filter or Define with a compiled callable
 
    bool fIsExplored = false; ///< When the graph is reconstructed, the first time this node has been explored this flag
    ///< is set and it won't be explored anymore
@@ -97,6 +99,15 @@ public:
 
    bool GetIsNew() { return fIsNew; }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Records the code evaluated by a Filter or Define node: its expression if it was jitted, otherwise the
+   /// fact that it calls a compiled callable. An empty expression denotes a compiled callable.
+   void SetExpression(const std::string &expression)
+   {
+      fExpression = expression;
+      fHasCallable = expression.empty();
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Gives a different shape based on the node type
    void SetRoot()
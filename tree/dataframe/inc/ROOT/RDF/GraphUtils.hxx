@@ -103,6 +103,10 @@ private:
    /// \brief Starting from any leaf (Action, Filter, Range) it draws the dot representation of the branch.
    std::string FromGraphLeafToDot(std::shared_ptr<GraphNode> leaf);
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Starting from any leaf, lists the expressions of the jitted Filters and Defines of the branch.
+   std::string FromGraphLeafToExpressions(std::shared_ptr<GraphNode> leaf, bool &hasCallables);
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Starting by an array of leaves, it draws the entire graph.
    std::string FromGraphActionsToDot(std::vector<std::shared_ptr<GraphNode>> leaves);
@@ -161,6 +165,20 @@ public:
       // The Represent can now start on a clean environment
       return RepresentGraph(node);
    }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the expressions of the jitted Filters and Defines upstream of the node, one per line.
+   /// `hasCallables` is set if some of these nodes call compiled callables instead, whose code is not known.
+   template <typename Proxied, typename DataSource>
+   std::string GetExpressions(RInterface<Proxied, DataSource> &rInterface, bool &hasCallables)
+   {
+      GetStaticFiltersMap() = FiltersNodesMap_t();
+      GetStaticColumnsMap() = ColumnsNodesMap_t();
+      GetStaticRangesMap() = RangesNodesMap_t();
+      GraphNode::ClearCounter();
+      rInterface.GetLoopManager()->Jit();
+      return FromGraphLeafToExpressions(rInterface.GetProxiedPtr()->GetGraph(), hasCallables);
+   }
 };
 
 } // namespace GraphDrawing
@@ -32,6 +32,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
@@ -53,6 +54,7 @@ template<typename T, typename V>
 class RInterface;
 using RNode = RInterface<::ROOT::Detail::RDF::RNodeBase, void>;
 class RDataSource;
+struct RCacheOptions;
 } // namespace RDF
 
 } // namespace ROOT
@@ -81,6 +83,13 @@ ColumnNames_t ConvertRegexToColumns(const RDFInternal::RBookedCustomColumns &cus
                                     ROOT::RDF::RDataSource *dataSource, std::string_view columnNameRegexp,
                                     std::string_view callerName);
 
+/// Return a RDataFrame reading the columns from the persistent cache of `node`, calling `snapshot` to write the
+/// cache file first if it does not exist yet. See RInterface::Cache.
+RInterface<RLoopManager, void>
+GetOrCreatePersistentCache(RNode &node, RLoopManager &loopManager, const ColumnNames_t &validColumns,
+                           const ColumnNames_t &columnNames, const RCacheOptions &options,
+                           const std::function<void(const std::string &, const std::string &)> &snapshot);
+
 /// An helper object that sets and resets gErrorIgnoreLevel via RAII.
 class RIgnoreErrorLevelRAII {
 private:
@@ -592,6 +601,34 @@ template <typename T>
 struct IsDeque_t<std::deque<T>> : std::true_type {};
 // clang-format on
 
+/// The expression of the columns that replace a varied column: it extracts one of the values computed by the
+/// expression passed to RInterface::Vary, which is evaluated once per entry for all variations.
+template <typename T>
+class RVariedValue {
+   std::shared_ptr<RDFDetail::RCustomColumnBase> fVariations; ///< The column that computes all varied values
+   std::string fVariationName;
+   std::size_t fIdx;   ///< The index of the value extracted by this column
+   std::size_t fNTags; ///< The number of values that the expression passed to Vary must return
+
+public:
+   RVariedValue(const std::shared_ptr<RDFDetail::RCustomColumnBase> &variations, const std::string &variationName,
+                std::size_t idx, std::size_t nTags)
+      : fVariations(variations), fVariationName(variationName), fIdx(idx), fNTags(nTags)
+   {
+   }
+
+   T operator()(unsigned int slot, ULong64_t entry)
+   {
+      const auto &values = *static_cast<ROOT::VecOps::RVec<T> *>(fVariations->Update(slot, entry));
+      if (values.size() != fNTags) {
+         throw std::runtime_error("The expression of variation \"" + fVariationName + "\" returned " +
+                                  std::to_string(values.size()) + " values, but " + std::to_string(fNTags) +
+                                  " variation tags were given.");
+      }
+      return values[fIdx];
+   }
+};
+
 } // namespace RDF
 } // namespace Internal
 
@@ -13,6 +13,7 @@
 
 #include "ROOT/RIntegerSequence.hxx"
 #include "ROOT/RDF/RBookedCustomColumns.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/RVec.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 
@@ -49,23 +50,24 @@ using ReaderValueOrArray_t = typename TReaderValueOrArray<T>::Proxy_t;
 /// Initialize a tuple of RColumnValues.
 /// For real TTree branches a TTreeReader{Array,Value} is built and passed to the
 /// RColumnValue. For temporary columns a pointer to the corresponding variable
-/// is passed instead.
+/// is passed instead. If `nodeTimer` is not null, the reads of the tree branches are timed too.
 template <typename RDFValueTuple, std::size_t... S>
 void InitRDFValues(unsigned int slot, RDFValueTuple &valueTuple, TTreeReader *r, const ColumnNames_t &bn,
                    const RBookedCustomColumns &customCols, std::index_sequence<S...>,
-                   const std::array<bool, sizeof...(S)> &isCustomColumn)
+                   const std::array<bool, sizeof...(S)> &isCustomColumn, RNodeTimer *nodeTimer = nullptr)
 {
    // hack to expand a parameter pack without c++17 fold expressions.
    // The statement defines a variable with type std::initializer_list<int>, containing all zeroes, and SetTmpColumn or
    // SetProxy are conditionally executed as the braced init list is expanded. The final ... expands S.
    int expander[] = {(isCustomColumn[S]
                          ? std::get<S>(valueTuple).SetTmpColumn(slot, customCols.GetColumns().at(bn[S]).get())
-                         : std::get<S>(valueTuple).MakeProxy(r, bn[S]),
+                         : std::get<S>(valueTuple).MakeProxy(r, bn[S], slot, GetColumnReadTimer(nodeTimer, bn[S])),
                       0)...,
                      0};
    (void)expander; // avoid "unused variable" warnings for expander on gcc4.9
    (void)slot;     // avoid _bogus_ "unused variable" warnings for slot on gcc 4.9
    (void)r;        // avoid "unused variable" warnings for r on gcc5.2
+   (void)nodeTimer; // avoid "unused variable" warnings for nodeTimer with zero columns
 }
 
 } // namespace RDF
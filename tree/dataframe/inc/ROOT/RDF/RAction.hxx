@@ -17,9 +17,11 @@
 #include "ROOT/RDF/Utils.hxx"      // ColumnNames_t
 #include "ROOT/RDF/RColumnValue.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 
 #include <cstddef> // std::size_t
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -70,15 +72,18 @@ public:
 template <std::size_t... S, typename... ColTypes>
 void InitRDFValues(unsigned int slot, std::vector<RTypeErasedColumnValue> &values, TTreeReader *r,
                    const ColumnNames_t &bn, const RBookedCustomColumns &customCols, std::index_sequence<S...>,
-                   ROOT::TypeTraits::TypeList<ColTypes...>, const std::array<bool, sizeof...(S)> &isTmpColumn)
+                   ROOT::TypeTraits::TypeList<ColTypes...>, const std::array<bool, sizeof...(S)> &isTmpColumn,
+                   RNodeTimer *nodeTimer = nullptr)
 {
    using expander = int[];
    (void)slot; // avoid bogus 'unused parameter' warning
    (void)r; // avoid bogus 'unused parameter' warning
+   (void)nodeTimer; // avoid bogus 'unused parameter' warning
    (void)expander{(values.emplace_back(std::make_unique<RColumnValue<ColTypes>>()), 0)..., 0};
    (void)expander{(isTmpColumn[S]
                       ? values[S].Cast<ColTypes>()->SetTmpColumn(slot, customCols.GetColumns().at(bn.at(S)).get())
-                      : values[S].Cast<ColTypes>()->MakeProxy(r, bn.at(S)),
+                      : values[S].Cast<ColTypes>()->MakeProxy(r, bn.at(S), slot,
+                                                              GetColumnReadTimer(nodeTimer, bn.at(S))),
                    0)...,
                   0};
 }
@@ -145,12 +150,16 @@ public:
    void Run(unsigned int slot, Long64_t entry) final
    {
       // check if entry passes all filters
-      if (fPrevData.CheckFilters(slot, entry))
+      if (fPrevData.CheckFilters(slot, entry)) {
+         RTimedScope timedScope(fTimer, slot);
          static_cast<Action_t *>(this)->Exec(slot, entry, TypeInd_t());
+      }
    }
 
    void TriggerChildrenCount() final { fPrevData.IncrChildrenCount(); }
 
+   std::string GetActionName() final { return fHelper.GetActionName(); }
+
    void FinalizeSlot(unsigned int slot) final
    {
       ClearValueReaders(slot);
@@ -175,7 +184,9 @@ public:
 
       // Action nodes do not need to ask an helper to create the graph nodes. They are never common nodes between
       // multiple branches
-      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>(fHelper.GetActionName());
+      const auto timer = RActionBase::GetTimer();
+      const auto annotation = timer ? timer->GetAnnotation() : std::string();
+      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>(fHelper.GetActionName() + annotation);
       auto evaluatedNode = thisNode;
       for (auto &column : GetCustomColumns().GetColumns()) {
          /* Each column that this node has but the previous hadn't has been defined in between,
@@ -199,6 +210,19 @@ public:
    /// user-defined callback registered via RResultPtr::RegisterCallback
    void *PartialUpdate(unsigned int slot) final { return PartialUpdateImpl(slot); }
 
+   std::unique_ptr<RActionBase>
+   MakeVariedAction(const std::string &variation, std::size_t tagIdx, const std::shared_ptr<void> &newResult) final
+   {
+      auto variedPrev = fPrevData.GetVariedFilter(variation, tagIdx);
+      const auto &customColumns = GetCustomColumns();
+      auto variedColumns = customColumns.GetVaried(variation, tagIdx);
+      if (!variedPrev && !customColumns.HasDifferentColumns(GetColumnNames(), variedColumns))
+         return nullptr;
+
+      std::shared_ptr<RDFDetail::RNodeBase> prev = variedPrev ? std::move(variedPrev) : fPrevDataPtr;
+      return MakeVariedActionImpl(std::move(prev), std::move(variedColumns), newResult, 0);
+   }
+
 private:
    // this overload is SFINAE'd out if Helper does not implement `PartialUpdate`
    // the template parameter is required to defer instantiation of the method to SFINAE time
@@ -210,6 +234,27 @@ private:
 
    // this one is always available but has lower precedence thanks to `...`
    void *PartialUpdateImpl(...) { throw std::runtime_error("This action does not support callbacks!"); }
+
+   // this overload is SFINAE'd out if Helper does not implement `MakeNew`
+   template <typename H = Helper>
+   auto MakeVariedActionImpl(std::shared_ptr<RDFDetail::RNodeBase> prev, RBookedCustomColumns &&customColumns,
+                             const std::shared_ptr<void> &newResult, int)
+      -> decltype(std::declval<H>().MakeNew(newResult), std::unique_ptr<RActionBase>())
+   {
+      using VariedAction_t = RAction<Helper, RDFDetail::RNodeBase, ColumnTypes_t>;
+      std::unique_ptr<RActionBase> action(new VariedAction_t(fHelper.MakeNew(newResult), GetColumnNames(),
+                                                             std::move(prev), std::move(customColumns)));
+      fLoopManager->Book(action.get());
+      return action;
+   }
+
+   // this one is always available but has lower precedence thanks to the `long` parameter
+   std::unique_ptr<RActionBase>
+   MakeVariedActionImpl(std::shared_ptr<RDFDetail::RNodeBase>, RBookedCustomColumns &&, const std::shared_ptr<void> &,
+                        long)
+   {
+      throw std::runtime_error("The " + fHelper.GetActionName() + " action does not support systematic variations.");
+   }
 };
 
 /// An action node in a RDF computation graph.
@@ -227,7 +272,7 @@ public:
    void InitColumnValues(TTreeReader *r, unsigned int slot)
    {
       InitRDFValues(slot, fValues[slot], r, RActionBase::GetColumnNames(), RActionBase::GetCustomColumns(),
-                    typename ActionCRTP_t::TypeInd_t{}, ActionCRTP_t::fIsCustomColumn);
+                    typename ActionCRTP_t::TypeInd_t{}, ActionCRTP_t::fIsCustomColumn, RActionBase::GetTimer());
    }
 
    template <std::size_t... S>
@@ -278,7 +323,8 @@ public:
    void InitColumnValues(TTreeReader *r, unsigned int slot)
    {
       InitRDFValues(slot, fValues[slot], r, RActionBase::GetColumnNames(), RActionBase::GetCustomColumns(),
-                    typename ActionCRTP_t::TypeInd_t{}, ColumnTypes_t{}, ActionCRTP_t::fIsCustomColumn);
+                    typename ActionCRTP_t::TypeInd_t{}, ColumnTypes_t{}, ActionCRTP_t::fIsCustomColumn,
+                    RActionBase::GetTimer());
    }
 
    template <std::size_t... S>
@@ -318,7 +364,8 @@ public:
    void InitColumnValues(TTreeReader *r, unsigned int slot)
    {
       InitRDFValues(slot, fValues[slot], r, RActionBase::GetColumnNames(), RActionBase::GetCustomColumns(),
-                    typename ActionCRTP_t::TypeInd_t{}, ColumnTypes_t{}, ActionCRTP_t::fIsCustomColumn);
+                    typename ActionCRTP_t::TypeInd_t{}, ColumnTypes_t{}, ActionCRTP_t::fIsCustomColumn,
+                    RActionBase::GetTimer());
    }
 
    template <std::size_t... S>
@@ -15,6 +15,8 @@
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
 
+#include <cstddef>
+#include <map>
 #include <memory>
 #include <string>
 
@@ -35,6 +37,9 @@ class GraphNode;
 
 using namespace ROOT::Detail::RDF;
 
+class RNodeTimer;
+class RProfiler;
+
 // fwd decl for RActionBase
 namespace GraphDrawing {
 bool CheckIfDefaultOrDSColumn(const std::string &name,
@@ -54,6 +59,9 @@ private:
 
    RBookedCustomColumns fCustomColumns;
 
+protected:
+   RNodeTimer *fTimer = nullptr; ///< Times the executions of this action if profiling is enabled
+
 public:
    RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, RBookedCustomColumns &&customColumns);
    RActionBase(const RActionBase &) = delete;
@@ -74,12 +82,22 @@ public:
    /// This method is invoked to update a partial result during the event loop, right before passing the result to a
    /// user-defined callback registered via RResultPtr::RegisterCallback
    virtual void *PartialUpdate(unsigned int slot) = 0;
+   /// Return the systematic variations registered upstream of this action, by variation name
+   virtual const std::map<std::string, RVariationInfo> &GetVariations() { return fCustomColumns.GetVariations(); }
+   /// Book a copy of this action that processes the given tag of a systematic variation and fills `newResult`.
+   /// Returns nullptr if neither the input columns nor the upstream selection depend on that variation.
+   virtual std::unique_ptr<RActionBase>
+   MakeVariedAction(const std::string &variation, std::size_t tagIdx, const std::shared_ptr<void> &newResult) = 0;
 
    // overridden by RJittedAction
    virtual bool HasRun() const { return fHasRun; }
    virtual void SetHasRun() { fHasRun = true; }
 
    virtual std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> GetGraph() = 0;
+   virtual std::string GetActionName() = 0;
+   /// Set the profiler of this action and of the custom columns it can read, or unset it with nullptr
+   virtual void SetProfiler(RProfiler *profiler);
+   RNodeTimer *GetTimer() const { return fTimer; }
 };
 
 } // ns RDF
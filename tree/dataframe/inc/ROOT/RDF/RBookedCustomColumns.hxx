@@ -16,6 +16,7 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <cstddef>
 #include "TString.h"
 
 namespace ROOT {
@@ -30,6 +31,14 @@ namespace RDF {
 
 namespace RDFDetail = ROOT::Detail::RDF;
 
+/// A systematic variation of a column, registered with RInterface::Vary
+struct RVariationInfo {
+   std::string fColumnName;        ///< The column whose values are varied
+   std::vector<std::string> fTags; ///< The names of the variations, e.g. "up" and "down"
+   /// One column per tag, each replacing fColumnName in the varied branches of the computation graph
+   std::vector<std::shared_ptr<RDFDetail::RCustomColumnBase>> fVariedColumns;
+};
+
 /**
  * \class ROOT::Internal::RDF::RBookedCustomColumns
  * \ingroup dataframe
@@ -39,14 +48,17 @@ namespace RDFDetail = ROOT::Detail::RDF;
 class RBookedCustomColumns {
    using RCustomColumnBasePtrMap_t = std::map<std::string, std::shared_ptr<RDFDetail::RCustomColumnBase>>;
    using ColumnNames_t = std::vector<std::string>;
+   using RVariationsMap_t = std::map<std::string, RVariationInfo>;
 
    // Since RBookedCustomColumns is meant to be an immutable, copy-on-write object, the actual values are set as const
    using RCustomColumnBasePtrMapPtr_t = std::shared_ptr<const RCustomColumnBasePtrMap_t>;
    using ColumnNamesPtr_t = std::shared_ptr<const ColumnNames_t>;
+   using RVariationsMapPtr_t = std::shared_ptr<const RVariationsMap_t>;
 
 private:
    RCustomColumnBasePtrMapPtr_t fCustomColumns;
    ColumnNamesPtr_t fCustomColumnsNames;
+   RVariationsMapPtr_t fVariations;
 
 public:
    ////////////////////////////////////////////////////////////////////////////
@@ -63,8 +75,9 @@ public:
 
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates the object starting from the provided maps
-   RBookedCustomColumns(RCustomColumnBasePtrMapPtr_t customColumns, ColumnNamesPtr_t customColumnNames)
-      : fCustomColumns(customColumns), fCustomColumnsNames(customColumnNames)
+   RBookedCustomColumns(RCustomColumnBasePtrMapPtr_t customColumns, ColumnNamesPtr_t customColumnNames,
+                        RVariationsMapPtr_t variations = std::make_shared<RVariationsMap_t>())
+      : fCustomColumns(customColumns), fCustomColumnsNames(customColumnNames), fVariations(variations)
    {
    }
 
@@ -72,7 +85,7 @@ public:
    /// \brief Creates a new wrapper with empty maps
    RBookedCustomColumns()
       : fCustomColumns(std::make_shared<RCustomColumnBasePtrMap_t>()),
-        fCustomColumnsNames(std::make_shared<ColumnNames_t>())
+        fCustomColumnsNames(std::make_shared<ColumnNames_t>()), fVariations(std::make_shared<RVariationsMap_t>())
    {
    }
 
@@ -95,6 +108,23 @@ public:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Internally it recreates the map with the new column name, and swaps with the old one.
    void AddName(std::string_view name);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the systematic variations registered so far, by variation name
+   const RVariationsMap_t &GetVariations() const { return *fVariations; }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Internally it recreates the map of variations with the new one, and swaps with the old one.
+   void AddVariation(std::string_view name, RVariationInfo variation);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the columns as seen by the given tag of a variation: the varied column is replaced by its
+   /// variation and every column that depends on it is replaced by a varied clone.
+   RBookedCustomColumns GetVaried(const std::string &variation, std::size_t tagIdx) const;
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Check if any of the given columns is bound to a different node in `other`
+   bool HasDifferentColumns(const ColumnNames_t &names, const RBookedCustomColumns &other) const;
 };
 
 } // Namespace RDF
@@ -12,6 +12,7 @@
 #define ROOT_RCOLUMNVALUE
 
 #include <ROOT/RDF/RCustomColumnBase.hxx>
+#include <ROOT/RDF/RProfiler.hxx>
 #include <ROOT/RDF/Utils.hxx> // IsRVec_t, TypeID2TypeName
 #include <ROOT/RIntegerSequence.hxx>
 #include <ROOT/RMakeUnique.hxx>
@@ -84,12 +85,10 @@ class R__CLING_PTRCHECK(off) RColumnValue {
 
    /// Owning ptrs to a TTreeReaderValue or TTreeReaderArray. Only used for Tree columns.
    std::unique_ptr<TreeReader_t> fTreeReader;
-   /// Non-owning ptrs to the value of a custom column.
-   T *fCustomValuePtr;
-   /// Non-owning ptrs to the value of a data-source column.
-   T **fDSValuePtr;
    /// Non-owning ptrs to the node responsible for the custom column. Needed when querying custom values.
    RCustomColumnBase *fCustomColumn;
+   /// Times the reads of tree columns if profiling is enabled, nullptr otherwise
+   RNodeTimer *fReadTimer = nullptr;
    /// Enumerator for the different properties of the branch storage in memory
    enum class EStorageType : char { kContiguous, kUnknown, kSparse };
    /// Signal whether we ever checked that the branch we are reading with a TTreeReaderArray stores array elements
@@ -99,6 +98,14 @@ class R__CLING_PTRCHECK(off) RColumnValue {
    RVec<ColumnValue_t> fRVec;
    bool fCopyWarningPrinted = false;
 
+   /// Custom columns return the address of their value for the given entry, data-source columns the address of
+   /// the pointer to their value.
+   T &GetCustomValue(Long64_t entry)
+   {
+      void *valuePtr = fCustomColumn->Update(fSlot, entry);
+      return fColumnKind == EColumnKind::kCustomColumn ? *static_cast<T *>(valuePtr) : **static_cast<T **>(valuePtr);
+   }
+
 public:
    RColumnValue(){};
 
@@ -135,19 +142,15 @@ public:
          throw std::runtime_error(errMsg);
       }
 
-      if (customColumn->IsDataSourceColumn()) {
-         fColumnKind = EColumnKind::kDataSource;
-         fDSValuePtr = static_cast<T **>(customColumn->GetValuePtr(slot));
-      } else {
-         fColumnKind = EColumnKind::kCustomColumn;
-         fCustomValuePtr = static_cast<T *>(customColumn->GetValuePtr(slot));
-      }
+      fColumnKind = customColumn->IsDataSourceColumn() ? EColumnKind::kDataSource : EColumnKind::kCustomColumn;
       fSlot = slot;
    }
 
-   void MakeProxy(TTreeReader *r, const std::string &bn)
+   void MakeProxy(TTreeReader *r, const std::string &bn, unsigned int slot = 0, RNodeTimer *readTimer = nullptr)
    {
       fColumnKind = EColumnKind::kTree;
+      fSlot = slot;
+      fReadTimer = readTimer;
       fTreeReader = std::make_unique<TreeReader_t>(*r, bn.c_str());
    }
 
@@ -159,10 +162,10 @@ public:
    T &Get(Long64_t entry)
    {
       if (fColumnKind == EColumnKind::kTree) {
+         RTimedScope timedScope(fReadTimer, fSlot);
          return *(fTreeReader->Get());
       } else {
-         fCustomColumn->Update(fSlot, entry);
-         return fColumnKind == EColumnKind::kCustomColumn ? *fCustomValuePtr : **fDSValuePtr;
+         return GetCustomValue(entry);
       }
    }
 
@@ -175,6 +178,7 @@ public:
    T &Get(Long64_t entry)
    {
       if (fColumnKind == EColumnKind::kTree) {
+         RTimedScope timedScope(fReadTimer, fSlot);
          auto &readerArray = *fTreeReader;
          // We only use TTreeReaderArrays to read columns that users flagged as type `RVec`, so we need to check
          // that the branch stores the array as contiguous memory that we can actually wrap in an `RVec`.
@@ -226,8 +230,7 @@ public:
          return fRVec;
 
       } else {
-         fCustomColumn->Update(fSlot, entry);
-         return fColumnKind == EColumnKind::kCustomColumn ? *fCustomValuePtr : **fDSValuePtr;
+         return GetCustomValue(entry);
       }
    }
 
@@ -242,6 +245,7 @@ public:
    T &Get(Long64_t entry)
    {
       if (fColumnKind == EColumnKind::kTree) {
+         RTimedScope timedScope(fReadTimer, fSlot);
          auto &readerArray = *fTreeReader;
          const auto readerArraySize = readerArray.GetSize();
          if (readerArraySize > 0) {
@@ -255,8 +259,7 @@ public:
          return fRVec;
       } else {
          // business as usual
-         fCustomColumn->Update(fSlot, entry);
-         return fColumnKind == EColumnKind::kCustomColumn ? *fCustomValuePtr : **fDSValuePtr;
+         return GetCustomValue(entry);
       }
    }
 
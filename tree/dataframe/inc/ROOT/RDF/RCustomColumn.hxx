@@ -20,7 +20,12 @@
 #include "ROOT/TypeTraits.hxx"
 #include "RtypesCore.h"
 
+#include <cstddef>
 #include <deque>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -67,6 +72,10 @@ class RCustomColumn final : public RCustomColumnBase {
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsCustomColumn;
 
+   /// Clones of this column for the systematic variations it depends on, by variation and tag index.
+   /// Null entries mark the variations this column does not depend on.
+   std::map<std::string, std::shared_ptr<RCustomColumnBase>> fVariedClones;
+
    template <std::size_t... S>
    void UpdateHelper(unsigned int slot, Long64_t entry, std::index_sequence<S...>, NoneTag)
    {
@@ -94,6 +103,21 @@ class RCustomColumn final : public RCustomColumnBase {
       (void)entry;
    }
 
+   // varied clones evaluate a copy of the expression on the varied input columns
+   template <typename G = F, typename std::enable_if<std::is_copy_constructible<G>::value, int>::type = 0>
+   std::shared_ptr<RCustomColumnBase> MakeVariedClone(const RDFInternal::RBookedCustomColumns &customColumns)
+   {
+      return std::make_shared<RCustomColumn>(fName, fType, fExpression, fColumnNames, fNSlots, customColumns,
+                                             fIsDataSourceColumn);
+   }
+
+   template <typename G = F, typename std::enable_if<!std::is_copy_constructible<G>::value, int>::type = 0>
+   std::shared_ptr<RCustomColumnBase> MakeVariedClone(const RDFInternal::RBookedCustomColumns &)
+   {
+      throw std::runtime_error("Column \"" + fName +
+                               "\" depends on a systematic variation, but its expression cannot be copied.");
+   }
+
 public:
    RCustomColumn(std::string_view name, std::string_view type, F expression, const ColumnNames_t &columns,
                  unsigned int nSlots, const RDFInternal::RBookedCustomColumns &customColumns, bool isDSColumn = false)
@@ -112,20 +136,21 @@ public:
    {
       if (!fIsInitialized[slot]) {
          fIsInitialized[slot] = true;
-         RDFInternal::InitRDFValues(slot, fValues[slot], r, fColumnNames, fCustomColumns, TypeInd_t(), fIsCustomColumn);
+         RDFInternal::InitRDFValues(slot, fValues[slot], r, fColumnNames, fCustomColumns, TypeInd_t(), fIsCustomColumn,
+                                    fTimer);
          fLastCheckedEntry[slot] = -1;
       }
    }
 
-   void *GetValuePtr(unsigned int slot) final { return static_cast<void *>(&fLastResults[slot]); }
-
-   void Update(unsigned int slot, Long64_t entry) final
+   void *Update(unsigned int slot, Long64_t entry) final
    {
       if (entry != fLastCheckedEntry[slot]) {
-         // evaluate this filter, cache the result
+         // evaluate this custom column, cache the result
+         RDFInternal::RTimedScope timedScope(fTimer, slot);
          UpdateHelper(slot, entry, TypeInd_t(), ExtraArgsTag{});
          fLastCheckedEntry[slot] = entry;
       }
+      return static_cast<void *>(&fLastResults[slot]);
    }
 
    const std::type_info &GetTypeId() const
@@ -140,6 +165,25 @@ public:
          fIsInitialized[slot] = false;
       }
    }
+
+   std::shared_ptr<RCustomColumnBase> GetVariedColumn(const std::string &variation, std::size_t tagIdx) final
+   {
+      // a variation registered downstream of this column cannot affect it
+      if (fCustomColumns.GetVariations().count(variation) == 0)
+         return nullptr;
+
+      const auto key = variation + ':' + std::to_string(tagIdx);
+      const auto it = fVariedClones.find(key);
+      if (it != fVariedClones.end())
+         return it->second;
+
+      std::shared_ptr<RCustomColumnBase> clone;
+      const auto variedColumns = fCustomColumns.GetVaried(variation, tagIdx);
+      if (fCustomColumns.HasDifferentColumns(fColumnNames, variedColumns))
+         clone = MakeVariedClone(variedColumns);
+      fVariedClones[key] = clone;
+      return clone;
+   }
 };
 
 } // ns RDF
@@ -14,6 +14,7 @@
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RBookedCustomColumns.hxx"
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
@@ -22,6 +23,13 @@
 class TTreeReader;
 
 namespace ROOT {
+namespace Internal {
+namespace RDF {
+class RNodeTimer;
+class RProfiler;
+} // ns RDF
+} // ns Internal
+
 namespace Detail {
 namespace RDF {
 
@@ -41,6 +49,8 @@ protected:
    const unsigned int fID = GetNextID();
    RDFInternal::RBookedCustomColumns fCustomColumns;
    std::deque<bool> fIsInitialized; // because vector<bool> is not thread-safe
+   RDFInternal::RNodeTimer *fTimer = nullptr; ///< Times the evaluations of this column if profiling is enabled
+   std::string fExpression; ///< The expression of a jitted column, empty if the column calls a compiled callable
 
    static unsigned int GetNextID();
 
@@ -52,15 +62,23 @@ public:
    RCustomColumnBase &operator=(RCustomColumnBase &&) = delete;
    virtual ~RCustomColumnBase();
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
-   virtual void *GetValuePtr(unsigned int slot) = 0;
    virtual const std::type_info &GetTypeId() const = 0;
    std::string GetName() const;
    std::string GetTypeName() const;
-   virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Evaluate the column for the given entry, if needed, and return the address of the value
+   virtual void *Update(unsigned int slot, Long64_t entry) = 0;
    virtual void ClearValueReaders(unsigned int slot) = 0;
+   /// Return a clone of this column that reads the given tag of a systematic variation, or nullptr if the values of
+   /// this column do not depend on that variation
+   virtual std::shared_ptr<RCustomColumnBase> GetVariedColumn(const std::string &variation, std::size_t tagIdx) = 0;
    bool IsDataSourceColumn() const { return fIsDataSourceColumn; }
    /// Return the unique identifier of this RCustomColumnBase.
    unsigned int GetID() const { return fID; }
+   /// Set the profiler of this column, or unset it with nullptr
+   virtual void SetProfiler(RDFInternal::RProfiler *profiler);
+   RDFInternal::RNodeTimer *GetTimer() const { return fTimer; }
+   void SetExpression(std::string_view expression) { fExpression = std::string(expression); }
+   const std::string &GetExpression() const { return fExpression; }
 };
 
 } // ns RDF
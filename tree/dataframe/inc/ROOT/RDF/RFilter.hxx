@@ -23,7 +23,9 @@
 
 #include <algorithm>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace ROOT {
@@ -75,6 +77,22 @@ public:
          fIsCustomColumn[i] = fCustomColumns.HasName(fColumnNames[i]);
    }
 
+   // varied clones are unnamed: they do not appear in cut-flow reports
+   template <typename G = FilterF, typename std::enable_if<std::is_copy_constructible<G>::value, int>::type = 0>
+   std::shared_ptr<RNodeBase>
+   MakeVariedClone(std::shared_ptr<RNodeBase> prev, const RDFInternal::RBookedCustomColumns &customColumns)
+   {
+      auto clone = std::make_shared<RFilter<FilterF, RNodeBase>>(fFilter, fColumnNames, std::move(prev), customColumns);
+      fLoopManager->Book(clone.get());
+      return clone;
+   }
+
+   template <typename G = FilterF, typename std::enable_if<!std::is_copy_constructible<G>::value, int>::type = 0>
+   std::shared_ptr<RNodeBase> MakeVariedClone(std::shared_ptr<RNodeBase>, const RDFInternal::RBookedCustomColumns &)
+   {
+      throw std::runtime_error("A filter depends on a systematic variation, but its expression cannot be copied.");
+   }
+
    RFilter(const RFilter &) = delete;
    RFilter &operator=(const RFilter &) = delete;
    // must call Deregister here, before fPrevDataFrame is destroyed,
@@ -89,6 +107,7 @@ public:
             fLastResult[slot] = false;
          } else {
             // evaluate this filter, cache the result
+            RDFInternal::RTimedScope timedScope(fTimer, slot);
             auto passed = CheckFilterHelper(slot, entry, TypeInd_t());
             passed ? ++fAccepted[slot] : ++fRejected[slot];
             fLastResult[slot] = passed;
@@ -111,7 +130,8 @@ public:
    {
       for (auto &bookedBranch : fCustomColumns.GetColumns())
          bookedBranch.second->InitSlot(r, slot);
-      RDFInternal::InitRDFValues(slot, fValues[slot], r, fColumnNames, fCustomColumns, TypeInd_t(), fIsCustomColumn);
+      RDFInternal::InitRDFValues(slot, fValues[slot], r, fColumnNames, fCustomColumns, TypeInd_t(), fIsCustomColumn,
+                                 fTimer);
    }
 
    // recursive chain of `Report`s
@@ -165,6 +185,30 @@ public:
       ClearValueReaders(slot);
    }
 
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variation, std::size_t tagIdx) final
+   {
+      const auto key = variation + ':' + std::to_string(tagIdx);
+      const auto it = fVariedNodes.find(key);
+      if (it != fVariedNodes.end())
+         return it->second;
+
+      std::shared_ptr<RNodeBase> clone;
+      auto variedPrev = fPrevData.GetVariedFilter(variation, tagIdx);
+      if (fCustomColumns.GetVariations().count(variation) == 0) {
+         // the variation was registered downstream of this filter, only the upstream selection can depend on it
+         if (variedPrev)
+            clone = MakeVariedClone(std::move(variedPrev), fCustomColumns);
+      } else {
+         auto variedColumns = fCustomColumns.GetVaried(variation, tagIdx);
+         if (variedPrev || fCustomColumns.HasDifferentColumns(fColumnNames, variedColumns)) {
+            std::shared_ptr<RNodeBase> prev = variedPrev ? std::move(variedPrev) : fPrevDataPtr;
+            clone = MakeVariedClone(std::move(prev), variedColumns);
+         }
+      }
+      fVariedNodes[key] = clone;
+      return clone;
+   }
+
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
    {
       // Recursively call for the previous node.
@@ -27,6 +27,13 @@ namespace RDF {
 class RCutFlowReport;
 } // ns RDF
 
+namespace Internal {
+namespace RDF {
+class RNodeTimer;
+class RProfiler;
+} // ns RDF
+} // ns Internal
+
 namespace Detail {
 namespace RDF {
 namespace RDFInternal = ROOT::Internal::RDF;
@@ -43,6 +50,8 @@ protected:
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
 
    RDFInternal::RBookedCustomColumns fCustomColumns;
+   RDFInternal::RNodeTimer *fTimer = nullptr; ///< Times the evaluations of this filter if profiling is enabled
+   std::string fExpression; ///< The expression of a jitted filter, empty if the filter calls a compiled callable
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
@@ -67,6 +76,11 @@ public:
    virtual void ClearTask(unsigned int slot) = 0;
    virtual void InitNode();
    virtual void AddFilterName(std::vector<std::string> &filters) = 0;
+   /// Set the profiler of this filter and of the custom columns it can read, or unset it with nullptr
+   virtual void SetProfiler(RDFInternal::RProfiler *profiler);
+   RDFInternal::RNodeTimer *GetTimer() const { return fTimer; }
+   void SetExpression(std::string_view expression) { fExpression = std::string(expression); }
+   const std::string &GetExpression() const { return fExpression; }
 };
 
 } // ns RDF
@@ -20,6 +20,7 @@
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RIntegerSequence.hxx"
 #include "ROOT/RDF/RLazyDSImpl.hxx"
+#include "ROOT/RCacheOptions.hxx"
 #include "ROOT/RResultPtr.hxx"
 #include "ROOT/RSnapshotOptions.hxx"
 #include "ROOT/RStringView.hxx"
@@ -424,6 +425,97 @@ public:
       return newInterface;
    }
 
+   // clang-format off
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for a column.
+   /// \param[in] colName The name of the column whose values are varied.
+   /// \param[in] expression Function, lambda expression, functor class or any other callable object producing the varied values. Returns an RVec with one value per variation tag, of the same type as the column.
+   /// \param[in] inputColumns Names of the columns/branches in input to the expression.
+   /// \param[in] variationTags Names of the variations, e.g. `{"down", "up"}`.
+   /// \param[in] variationName The name of the systematic variation, defaults to `colName`.
+   /// \return the first node of the computation graph for which the variations are registered.
+   ///
+   /// The nominal values of the column are not affected: downstream transformations and actions work as usual. The
+   /// variations come into play when ROOT::RDF::Experimental::VariationsFor is called on a result: for each tag, the
+   /// Defines, Filters and the action that depend on the varied column, directly or through other nodes, are
+   /// cloned and run on the varied values in the same event loop as the nominal result. Nodes that do not depend on
+   /// the variation are shared by all variations, and `expression` is evaluated once per entry for all tags.
+   ///
+   /// Nodes affected by a variation must have copyable expressions, and only the Count, Fill/Histo, Min, Max, Sum and
+   /// Mean actions support variations. The expression must be a compiled callable.
+   ///
+   /// An exception is thrown if no tags are given or if a variation with the same name was already registered in
+   /// this branch of the computation graph.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto scaled = [](double pt) { return ROOT::RVec<double>{0.9 * pt, 1.1 * pt}; };
+   /// auto h = df.Vary("pt", scaled, {"pt"}, {"down", "up"}).Filter("pt > 10").Histo1D<double>("pt");
+   /// auto hs = ROOT::RDF::Experimental::VariationsFor(h); // keys: "nominal", "pt:down", "pt:up"
+   /// ~~~
+   template <typename F>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F expression, const ColumnNames_t &inputColumns,
+                                  const std::vector<std::string> &variationTags, std::string_view variationName = "")
+   {
+      using RetType = typename TTraits::CallableTraits<F>::ret_type;
+      static_assert(RDFInternal::IsRVec_t<RetType>::value,
+                    "Error in `Vary`: the expression must return an RVec with one value per variation tag");
+      using ValueType_t = typename RetType::value_type;
+      using ColTypes_t = typename TTraits::CallableTraits<F>::arg_types;
+      constexpr auto nColumns = ColTypes_t::list_size;
+
+      const std::string name = variationName.empty() ? std::string(colName) : std::string(variationName);
+      if (variationTags.empty())
+         throw std::runtime_error("Vary: no variation tags were given for variation \"" + name + "\".");
+      if (fCustomColumns.GetVariations().count(name) > 0)
+         throw std::runtime_error("Vary: a variation named \"" + name + "\" was already registered.");
+
+      const auto variedColName = GetValidatedColumnNames(1, {std::string(colName)})[0];
+      const auto validColumnNames = GetValidatedColumnNames(nColumns, inputColumns);
+      auto newCols = CheckAndFillDSColumns(validColumnNames, std::make_index_sequence<nColumns>(), ColTypes_t());
+
+      // The values of all variations are computed together. The column is booked without a name: only the varied
+      // columns read it, and the nodes downstream initialize it with the other custom columns.
+      const auto nSlots = fLoopManager->GetNSlots();
+      const auto variationsColName = "rdfvariation_" + name + "_";
+      auto variationsColumn = std::make_shared<RDFDetail::RCustomColumn<F>>(
+         variationsColName, RDFInternal::TypeID2TypeName(typeid(RetType)), std::move(expression), validColumnNames,
+         nSlots, newCols);
+      newCols.AddColumn(variationsColumn, variationsColName);
+
+      RDFInternal::RVariationInfo variation;
+      variation.fColumnName = variedColName;
+      variation.fTags = variationTags;
+      const auto valueTypeName = RDFInternal::TypeID2TypeName(typeid(ValueType_t));
+      using VariedCol_t =
+         RDFDetail::RCustomColumn<RDFInternal::RVariedValue<ValueType_t>, RDFDetail::CustomColExtraArgs::SlotAndEntry>;
+      for (std::size_t i = 0; i < variationTags.size(); ++i) {
+         RDFInternal::RVariedValue<ValueType_t> value(variationsColumn, name, i, variationTags.size());
+         variation.fVariedColumns.emplace_back(std::make_shared<VariedCol_t>(
+            variedColName, valueTypeName, std::move(value), ColumnNames_t{}, nSlots, newCols));
+      }
+      newCols.AddVariation(name, std::move(variation));
+
+      RInterface<Proxied, DS_t> newInterface(fProxiedPtr, *fLoopManager, std::move(newCols), fDataSource);
+
+      return newInterface;
+   }
+   // clang-format on
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for a column, with tags "0", "1", ... "nVariations - 1".
+   ///
+   /// Refer to the first overload of this method for the full documentation.
+   template <typename F>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F expression, const ColumnNames_t &inputColumns,
+                                  std::size_t nVariations, std::string_view variationName = "")
+   {
+      std::vector<std::string> variationTags;
+      for (std::size_t i = 0; i < nVariations; ++i)
+         variationTags.emplace_back(std::to_string(i));
+      return Vary(colName, std::move(expression), inputColumns, variationTags, variationName);
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Save selected columns to disk, in a new TTree `treename` in file `filename`.
    /// \tparam ColumnTypes variadic list of branch/column types.
@@ -670,6 +762,47 @@ public:
       return Cache(selectedColumns);
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns in a file that is reused by later invocations, possibly in other processes
+   /// \param[in] columnList The list of names of the columns to be cached.
+   /// \param[in] options RCacheOptions struct with the location of the cache files and a user-defined key.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// The selected columns are written with Snapshot to a ROOT file in `options.fDirectory`, whose name is a hash of:
+   /// - the computation graph upstream of this node, i.e. its kinds of nodes and the names of columns and filters
+   /// - the expressions of the jitted Filters and Defines upstream of this node
+   /// - the names of the cached columns
+   /// - the name of the input tree and the names, sizes and modification times of the input files, or the number of
+   ///   entries of an empty source
+   /// - `options.fKey`
+   ///
+   /// If a file with the same name already exists, the event loop does not run and the returned `RDataFrame` reads
+   /// the columns from that file: iterative analysis development can then skip an expensive, rarely changing
+   /// preselection. The code of Filters and Defines that call compiled callables cannot be hashed: if there are any,
+   /// `options.fKey` must be set, and changed whenever they change, otherwise an exception is thrown. Data sources are
+   /// not supported, as their inputs cannot be identified.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDF::RCacheOptions opts("/scratch/rdfcache", "preselection-v2");
+   /// auto cached = df.Filter("nMuon == 2").Define("pt2", "Muon_pt * Muon_pt").Cache({"pt2"}, opts);
+   /// ~~~
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList, const RCacheOptions &options)
+   {
+      if (fDataSource)
+         throw std::runtime_error("Cache: persistent caching is not supported for data sources.");
+      if (columnList.empty())
+         throw std::runtime_error("Cache: persistent caching requires at least one column.");
+
+      const auto validColumnNames = GetValidatedColumnNames(columnList.size(), columnList);
+      auto snapshot = [this, &columnList](const std::string &treeName, const std::string &fileName) {
+         Snapshot(treeName, fileName, columnList);
+      };
+      RNode node(*this);
+      return RDFInternal::GetOrCreatePersistentCache(node, *fLoopManager, validColumnNames, columnList, options,
+                                                     snapshot);
+   }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates a node that filters entries based on range: [begin, end)
@@ -679,7 +812,13 @@ public:
    /// \return the first node of the computation graph for which the event loop is limited to a certain range of entries.
    ///
    /// Note that in case of previous Ranges and Filters the selected range refers to the transformed dataset.
-   /// Ranges are only available if EnableImplicitMT has _not_ been called. Multi-thread ranges are not supported.
+   /// If EnableImplicitMT has been called, ranges must be applied directly to the dataset (possibly after Defines): the
+   /// entries are then selected by their entry number in the dataset (or in its TEntryList), independently in every
+   /// thread, and the event loop does not process the entries beyond the end of the ranges.
+   /// Multi-thread ranges after Filters and other Ranges are not supported, as the entries they select depend on the
+   /// number of entries accepted by the tasks that process the preceding entries. For the same reason, multi-thread
+   /// ranges on data sources that skip entries (RDataSource::SetEntry returns false) count the skipped entries too,
+   /// unlike sequential ranges.
    ///
    /// ### Example usage:
    /// ~~~{.cpp}
@@ -693,7 +832,9 @@ public:
       // check invariants
       if (stride == 0 || (end != 0 && end < begin))
          throw std::runtime_error("Range: stride must be strictly greater than 0 and end must be greater than begin.");
-      CheckIMTDisabled("Range");
+      if (fLoopManager->IsMultiThreaded() && static_cast<RDFDetail::RNodeBase *>(fProxiedPtr.get()) != fLoopManager)
+         throw std::runtime_error("Range was called with ImplicitMT enabled after a Filter or a Range, but "
+                                  "multi-thread ranges can only be applied directly to the dataset.");
 
       using Range_t = RDFDetail::RRange<Proxied>;
       auto rangePtr = std::make_shared<Range_t>(begin, end, stride, fProxiedPtr);
@@ -1976,6 +2117,47 @@ public:
    /// ~~~
    unsigned int GetNRuns() const { return fLoopManager->GetNRuns(); }
 
+   /// \brief Gets the time spent in just-in-time compilation
+   /// \return Pairs of a description of what was jitted and the wall-clock time it took, in seconds
+   ///
+   /// Each Filter and Define with a string expression reports the time taken to compile its expression, when it is
+   /// booked. The code that creates the jitted nodes is compiled in one go before the first event loop: that time
+   /// is reported once, and also covers the nodes of other RDataFrames that were pending at that point.
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// for (const auto &t : df.GetJitTimes())
+   ///    std::cout << t.first << ": " << t.second << " s" << std::endl;
+   /// ~~~
+   const std::vector<std::pair<std::string, double>> &GetJitTimes() const { return fLoopManager->GetJitTimes(); }
+
+   /// \brief Time the nodes of the computation graph in the next event loops
+   /// \param[in] samplingPeriod One entry every `samplingPeriod` is timed, in each processing slot
+   ///
+   /// Profiling is opt-in and sampled, so that its overhead stays low: when an entry is sampled, the wall-clock and
+   /// thread CPU times of all filters, defines and actions that process it are measured, together with the time spent
+   /// reading each column of the input tree (or the time spent by the data source to load the entry). Times are scaled
+   /// by the sampling period to estimate the time spent for all entries. The "self" time of a node excludes the time
+   /// spent in the nodes and column reads it triggered, e.g. a Filter that reads a Define. A wall-clock time much
+   /// larger than the CPU time points to a node that waits, e.g. for I/O.
+   ///
+   /// Profiling applies to the whole computation graph and to all event loops that run after this call. The results
+   /// are available via GetProfileReport(), and the estimated self times are shown in the labels of the nodes in the
+   /// output of ROOT::RDF::SaveGraph (only for the nodes that were profiled).
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df("t", "f.root");
+   /// df.EnableProfiling(10);
+   /// auto h = df.Define("x2", "x*x").Filter("x2 > 4").Histo1D("x2");
+   /// h->Draw();
+   /// df.GetProfileReport().Print();
+   /// ~~~
+   void EnableProfiling(unsigned int samplingPeriod = 100) { fLoopManager->EnableProfiling(samplingPeriod); }
+
+   /// \brief Return the per-node timings of the event loops that ran since EnableProfiling was called
+   ROOT::RDF::RProfileReport GetProfileReport() const { return fLoopManager->GetProfileReport(); }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Execute a user-defined accumulation operation on the processed column values in each processing slot
@@ -45,9 +45,14 @@ public:
    void FinalizeSlot(unsigned int) final;
    void Finalize() final;
    void *PartialUpdate(unsigned int slot) final;
+   const std::map<std::string, RVariationInfo> &GetVariations() final;
+   std::unique_ptr<RActionBase>
+   MakeVariedAction(const std::string &variation, std::size_t tagIdx, const std::shared_ptr<void> &newResult) final;
    bool HasRun() const final;
    void SetHasRun() final;
    void ClearValueReaders(unsigned int slot) final;
+   std::string GetActionName() final;
+   void SetProfiler(RProfiler *profiler) final;
 
    std::shared_ptr<GraphDrawing::GraphNode> GetGraph();
 };
@@ -40,10 +40,11 @@ public:
    void SetCustomColumn(std::unique_ptr<RCustomColumnBase> c) { fConcreteCustomColumn = std::move(c); }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
-   void *GetValuePtr(unsigned int slot) final;
    const std::type_info &GetTypeId() const final;
-   void Update(unsigned int slot, Long64_t entry) final;
+   void *Update(unsigned int slot, Long64_t entry) final;
    void ClearValueReaders(unsigned int slot) final;
+   std::shared_ptr<RCustomColumnBase> GetVariedColumn(const std::string &variation, std::size_t tagIdx) final;
+   void SetProfiler(RDFInternal::RProfiler *profiler) final;
 };
 
 } // ns RDF
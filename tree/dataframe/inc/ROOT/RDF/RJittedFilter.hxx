@@ -57,8 +57,10 @@ public:
    void ResetReportCount() final;
    void ClearValueReaders(unsigned int slot) final;
    void InitNode() final;
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variation, std::size_t tagIdx) final;
    void AddFilterName(std::vector<std::string> &filters) final;
    void ClearTask(unsigned int slot) final;
+   void SetProfiler(RDFInternal::RProfiler *profiler) final;
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph();
 };
 
@@ -13,11 +13,14 @@
 
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/NodesUtils.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 // forward declarations
@@ -113,6 +116,14 @@ class RLoopManager : public RNodeBase {
    std::vector<TCallback> fCallbacks;                      ///< Registered callbacks
    std::vector<TOneTimeCallback> fCallbacksOnce; ///< Registered callbacks to invoke just once before running the loop
    unsigned int fNRuns{0}; ///< Number of event loops run
+   /// Wall-clock seconds spent jitting each node of this computation graph, and the pending code in Jit()
+   std::vector<std::pair<std::string, double>> fJitTimes;
+   /// Sampled timings of the nodes of the computation graph, null unless profiling was enabled
+   std::unique_ptr<RDFInternal::RProfiler> fProfiler;
+   /// Times RDataSource::SetEntry if profiling is enabled, nullptr otherwise
+   RDFInternal::RNodeTimer *fEntryReadTimer = nullptr;
+   /// Entries from this entry number onwards are not needed by any node (see EvalEntryBound)
+   ULong64_t fEntryBound{std::numeric_limits<ULong64_t>::max()};
 
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
@@ -130,6 +141,7 @@ class RLoopManager : public RNodeBase {
    void CleanUpNodes();
    void CleanUpTask(unsigned int slot);
    void EvalChildrenCounts();
+   void EvalEntryBound();
 
 public:
    RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches);
@@ -155,6 +167,7 @@ public:
    void Deregister(RRangeBase *rangePtr);
    bool CheckFilters(unsigned int, Long64_t) final;
    unsigned int GetNSlots() const { return fNSlots; }
+   bool IsMultiThreaded() const;
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
    void PartialReport(ROOT::RDF::RCutFlowReport &) const final {}
@@ -166,9 +179,15 @@ public:
    const std::map<std::string, std::string> &GetAliasMap() const { return fAliasColumnNameMap; }
    void RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f);
    unsigned int GetNRuns() const { return fNRuns; }
+   void AddJitTime(const std::string &what, double seconds) { fJitTimes.emplace_back(what, seconds); }
+   const std::vector<std::pair<std::string, double>> &GetJitTimes() const { return fJitTimes; }
+   void EnableProfiling(unsigned int samplingPeriod);
+   ROOT::RDF::RProfileReport GetProfileReport() const;
 
    /// End of recursive chain of calls, does nothing
    void AddFilterName(std::vector<std::string> &) {}
+   /// End of recursive chain of calls, the dataset is the same for all variations
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &, std::size_t) final { return nullptr; }
    /// For each booked filter, returns either the name or "Unnamed Filter"
    std::vector<std::string> GetFiltersNames();
 
@@ -13,6 +13,8 @@
 
 #include "RtypesCore.h"
 
+#include <cstddef>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -43,6 +45,9 @@ protected:
    RLoopManager *fLoopManager;
    unsigned int fNChildren{0};      ///< Number of nodes of the functional graph hanging from this object
    unsigned int fNStopsReceived{0}; ///< Number of times that a children node signaled to stop processing entries.
+   /// Clones of this node for the systematic variations that affect it, by variation and tag index.
+   /// Null entries mark the variations that do not affect this node.
+   std::map<std::string, std::shared_ptr<RNodeBase>> fVariedNodes;
 
 public:
    RNodeBase(RLoopManager *lm = nullptr) : fLoopManager(lm) {}
@@ -54,6 +59,9 @@ public:
    virtual void StopProcessing() = 0;
    virtual void AddFilterName(std::vector<std::string> &filters) = 0;
    virtual std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> GetGraph() = 0;
+   /// Return the node that selects entries for the given tag of a systematic variation, or nullptr if the selection
+   /// performed by this node and its upstream nodes does not depend on that variation
+   virtual std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variation, std::size_t tagIdx) = 0;
 
    virtual void ResetChildrenCount()
    {
@@ -0,0 +1,92 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RPROFILEREPORT
+#define ROOT_RPROFILEREPORT
+
+#include "RtypesCore.h"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+
+namespace Internal {
+namespace RDF {
+class RNodeTimer;
+class RProfiler;
+} // End NS RDF
+} // End NS Internal
+
+namespace RDF {
+
+/// The time spent in one node of a computation graph, or in reading one column, estimated from sampled entries
+class RNodeProfile {
+   friend class ROOT::Internal::RDF::RNodeTimer;
+
+private:
+   const std::string fKind;
+   const std::string fName;
+   const ULong64_t fNSamples;
+   const std::vector<double> fTotalTimes;
+   const std::vector<double> fSelfTimes;
+   const std::vector<double> fTotalCpuTimes;
+   const std::vector<double> fSelfCpuTimes;
+   RNodeProfile(const std::string &kind, const std::string &name, ULong64_t nSamples,
+                std::vector<double> &&totalTimes, std::vector<double> &&selfTimes,
+                std::vector<double> &&totalCpuTimes, std::vector<double> &&selfCpuTimes)
+      : fKind(kind), fName(name), fNSamples(nSamples), fTotalTimes(std::move(totalTimes)),
+        fSelfTimes(std::move(selfTimes)), fTotalCpuTimes(std::move(totalCpuTimes)),
+        fSelfCpuTimes(std::move(selfCpuTimes))
+   {
+   }
+
+public:
+   /// "Filter", "Define", "Action" or "Read"
+   const std::string &GetKind() const { return fKind; }
+   /// The name of the filter, column or action
+   const std::string &GetName() const { return fName; }
+   /// The number of times this node was timed
+   ULong64_t GetNSamples() const { return fNSamples; }
+   /// Estimated wall-clock time in seconds, including the nodes and column reads this node triggered
+   double GetTotalTime() const;
+   /// Estimated wall-clock time in seconds, excluding the nodes and column reads this node triggered
+   double GetSelfTime() const;
+   /// Same as GetSelfTime(), for each processing slot
+   const std::vector<double> &GetSelfTimePerSlot() const { return fSelfTimes; }
+   /// Estimated thread CPU time in seconds, including the nodes and column reads this node triggered
+   double GetTotalCpuTime() const;
+   /// Estimated thread CPU time in seconds, excluding the nodes and column reads this node triggered
+   double GetSelfCpuTime() const;
+   /// Same as GetSelfCpuTime(), for each processing slot
+   const std::vector<double> &GetSelfCpuTimePerSlot() const { return fSelfCpuTimes; }
+};
+
+/// The per-node timings of the event loops of a computation graph, see RInterface::EnableProfiling
+class RProfileReport {
+   friend class ROOT::Internal::RDF::RProfiler;
+
+private:
+   std::vector<RNodeProfile> fProfiles;
+   void AddProfile(RNodeProfile &&profile) { fProfiles.emplace_back(std::move(profile)); }
+
+public:
+   using const_iterator = typename std::vector<RNodeProfile>::const_iterator;
+   /// Print a table of the profiles, sorted by decreasing self time
+   void Print() const;
+   const_iterator begin() const { return fProfiles.begin(); }
+   const_iterator end() const { return fProfiles.end(); }
+   std::size_t size() const { return fProfiles.size(); }
+};
+
+} // End NS RDF
+} // End NS ROOT
+
+#endif
@@ -0,0 +1,159 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RPROFILER
+#define ROOT_RDF_RPROFILER
+
+#include "ROOT/RDF/RProfileReport.hxx"
+#include "RtypesCore.h"
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+class RProfiler;
+
+/// The per-slot states are written at every entry by their slot. Each one ends with this many bytes of padding, an
+/// estimate of the cache line size, such that two slots never write to the same cache line (false sharing). Padding,
+/// unlike alignas, does not depend on the alignment of the allocations of the vectors of states.
+constexpr std::size_t kCacheLineSize = 64;
+
+/// A wall-clock and a thread CPU time, in seconds
+struct RTimes {
+   double fWall = 0.;
+   double fCpu = 0.;
+};
+
+/// The CPU time consumed so far by the calling thread, in seconds
+double GetThreadCpuTime();
+
+/// Sampled wall-clock and CPU times of one node of the computation graph, or of the reads of one column, per slot
+class RNodeTimer {
+   struct RSlotStats {
+      ULong64_t fNSamples = 0;
+      RTimes fTotalTime; ///< Sum of the sampled times
+      RTimes fSelfTime;  ///< Same as fTotalTime, minus the time spent in the timed scopes nested in this one
+      char fPadding[kCacheLineSize];
+   };
+
+   RProfiler &fProfiler;
+   const std::string fKind;
+   const std::string fName;
+   std::vector<RSlotStats> fStats;
+
+public:
+   RNodeTimer(RProfiler &profiler, const std::string &kind, const std::string &name, unsigned int nSlots)
+      : fProfiler(profiler), fKind(kind), fName(name), fStats(nSlots)
+   {
+   }
+
+   RProfiler &GetProfiler() const { return fProfiler; }
+   bool IsSampled(unsigned int slot) const;
+   /// Begin a timed scope, return the time already spent in the scopes nested in the enclosing one
+   RTimes StartScope(unsigned int slot);
+   /// End a timed scope that took `elapsed`
+   void EndScope(unsigned int slot, const RTimes &elapsed, const RTimes &outerNestedTime);
+   ROOT::RDF::RNodeProfile GetProfile() const;
+   /// A short summary of the estimated self times, for the graph representation of the node
+   std::string GetAnnotation() const;
+};
+
+/// The state of the opt-in profiling of the event loops of a RLoopManager.
+/// One entry every fSamplingPeriod is timed, per slot: all the nodes and column reads of that entry are timed, so
+/// that the time of nested evaluations (e.g. a Define evaluated by the Filter that reads it) can be subtracted.
+class RProfiler {
+   struct RSlotState {
+      ULong64_t fNEntries = 0;
+      bool fIsSampled = true;
+      RTimes fNestedTime; ///< Time spent in timed scopes nested in the innermost open one
+      char fPadding[kCacheLineSize];
+   };
+
+   const unsigned int fNSlots;
+   const unsigned int fSamplingPeriod;
+   std::vector<RSlotState> fSlots;
+   std::vector<std::unique_ptr<RNodeTimer>> fTimers; ///< In order of creation
+   /// Index in fTimers of the timer of each node, by node address and name
+   std::map<std::pair<const void *, std::string>, std::size_t> fTimerIndices;
+   std::mutex fMutex; ///< Column read timers are requested concurrently by the slots
+
+public:
+   RProfiler(unsigned int nSlots, unsigned int samplingPeriod);
+
+   /// Return the timer of a node, creating it if needed
+   RNodeTimer *GetTimer(const void *node, const std::string &kind, const std::string &name);
+   /// Return the timer of the reads of a column of the input dataset, creating it if needed
+   RNodeTimer *GetColumnReadTimer(const std::string &column) { return GetTimer(nullptr, "Read", column); }
+
+   unsigned int GetSamplingPeriod() const { return fSamplingPeriod; }
+   bool IsSampled(unsigned int slot) const { return fSlots[slot].fIsSampled; }
+   RTimes &NestedTime(unsigned int slot) { return fSlots[slot].fNestedTime; }
+   /// Decide whether the next entry processed by this slot is timed
+   void NextEntry(unsigned int slot)
+   {
+      auto &state = fSlots[slot];
+      state.fIsSampled = ++state.fNEntries % fSamplingPeriod == 0;
+      state.fNestedTime = RTimes();
+   }
+
+   ROOT::RDF::RProfileReport GetReport() const;
+};
+
+/// Return the timer of the reads of `column` if the node with timer `nodeTimer` is profiled, nullptr otherwise
+inline RNodeTimer *GetColumnReadTimer(RNodeTimer *nodeTimer, const std::string &column)
+{
+   return nodeTimer ? nodeTimer->GetProfiler().GetColumnReadTimer(column) : nullptr;
+}
+
+/// Time the enclosing scope with `timer`, if not null and if the current entry of `slot` is sampled
+class RTimedScope {
+   using Clock_t = std::chrono::steady_clock;
+
+   RNodeTimer *const fTimer;
+   const unsigned int fSlot;
+   RTimes fOuterNestedTime;
+   Clock_t::time_point fStart;
+   double fCpuStart = 0.;
+
+public:
+   RTimedScope(RNodeTimer *timer, unsigned int slot)
+      : fTimer(timer && timer->IsSampled(slot) ? timer : nullptr), fSlot(slot)
+   {
+      if (fTimer) {
+         fOuterNestedTime = fTimer->StartScope(slot);
+         fStart = Clock_t::now();
+         fCpuStart = GetThreadCpuTime();
+      }
+   }
+   RTimedScope(const RTimedScope &) = delete;
+   RTimedScope &operator=(const RTimedScope &) = delete;
+
+   ~RTimedScope()
+   {
+      if (fTimer) {
+         const double cpuElapsed = GetThreadCpuTime() - fCpuStart;
+         const std::chrono::duration<double> elapsed = Clock_t::now() - fStart;
+         fTimer->EndScope(fSlot, {elapsed.count(), cpuElapsed}, fOuterNestedTime);
+      }
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RPROFILER
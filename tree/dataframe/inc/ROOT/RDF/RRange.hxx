@@ -15,7 +15,9 @@
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "RtypesCore.h"
 
+#include <cstddef>
 #include <memory>
+#include <string>
 
 namespace ROOT {
 
@@ -39,7 +41,9 @@ class RRange final : public RRangeBase {
 
 public:
    RRange(unsigned int start, unsigned int stop, unsigned int stride, std::shared_ptr<PrevData> pd)
-      : RRangeBase(pd->GetLoopManagerUnchecked(), start, stop, stride, pd->GetLoopManagerUnchecked()->GetNSlots()),
+      : RRangeBase(pd->GetLoopManagerUnchecked(), start, stop, stride, pd->GetLoopManagerUnchecked()->GetNSlots(),
+                   pd->GetLoopManagerUnchecked()->IsMultiThreaded() &&
+                      static_cast<RNodeBase *>(pd.get()) == pd->GetLoopManagerUnchecked()),
         fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr) {}
 
    RRange(const RRange &) = delete;
@@ -51,6 +55,10 @@ public:
    /// Ranges act as filters when it comes to selecting entries that downstream nodes should process
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
+      // entries are numbered from 0, the range counts them from 1
+      if (fIsEntryBased)
+         return IsInRange(entry + 1);
+
       if (entry != fLastCheckedEntry) {
          if (fHasStopped)
             return false;
@@ -60,11 +68,7 @@ public:
          } else {
             // apply range filter logic, cache the result
             ++fNProcessedEntries;
-            if (fNProcessedEntries <= fStart || (fStop > 0 && fNProcessedEntries > fStop) ||
-                (fStride != 1 && fNProcessedEntries % fStride != 0))
-               fLastResult = false;
-            else
-               fLastResult = true;
+            fLastResult = IsInRange(fNProcessedEntries);
             if (fNProcessedEntries == fStop) {
                fHasStopped = true;
                fPrevData.StopProcessing();
@@ -96,6 +100,25 @@ public:
          fPrevData.IncrChildrenCount();
    }
 
+   /// A range is cloned if the selection upstream depends on the variation
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variation, std::size_t tagIdx) final
+   {
+      const auto key = variation + ':' + std::to_string(tagIdx);
+      const auto it = fVariedNodes.find(key);
+      if (it != fVariedNodes.end())
+         return it->second;
+
+      std::shared_ptr<RNodeBase> clone;
+      auto variedPrev = fPrevData.GetVariedFilter(variation, tagIdx);
+      if (variedPrev) {
+         auto range = std::make_shared<RRange<RNodeBase>>(fStart, fStop, fStride, std::move(variedPrev));
+         fLoopManager->Book(range.get());
+         clone = std::move(range);
+      }
+      fVariedNodes[key] = clone;
+      return clone;
+   }
+
    /// This function must be defined by all nodes, but only the filters will add their name
    void AddFilterName(std::vector<std::string> &filters) { fPrevData.AddFilterName(filters); }
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
@@ -39,17 +39,28 @@ protected:
    ULong64_t fNProcessedEntries{0};
    bool fHasStopped{false};    ///< True if the end of the range has been reached
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
+   /// In multi-thread event loops the range is applied directly to the dataset and selects entries by their entry
+   /// number, which requires neither ordering nor shared counters among the processing slots.
+   const bool fIsEntryBased;
 
    void ResetCounters();
+   /// Whether the nth entry (starting from 1) that reaches the range is selected
+   bool IsInRange(ULong64_t n) const
+   {
+      return n > fStart && (fStop == 0 || n <= fStop) && (fStride == 1 || n % fStride == 0);
+   }
 
 public:
    RRangeBase(RLoopManager *implPtr, unsigned int start, unsigned int stop, unsigned int stride,
-              const unsigned int nSlots);
+              const unsigned int nSlots, bool isEntryBased);
 
    RRangeBase &operator=(const RRangeBase &) = delete;
    virtual ~RRangeBase();
 
    void InitNode() { ResetCounters(); }
+   bool IsEntryBased() const { return fIsEntryBased; }
+   unsigned int GetStop() const { return fStop; }
+   bool HasChildren() const { return fNChildren > 0; }
    virtual std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph() = 0;
 };
 
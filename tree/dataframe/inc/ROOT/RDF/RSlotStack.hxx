@@ -11,23 +11,32 @@
 #ifndef ROOT_RSLOTSTACK
 #define ROOT_RSLOTSTACK
 
-#include <ROOT/TSpinMutex.hxx>
-
-#include <stack>
+#include <atomic>
+#include <cstdint>
+#include <vector>
 
 namespace ROOT {
 namespace Internal {
 namespace RDF {
 
-/// This is an helper class to allow to pick a slot resorting to a map
-/// indexed by thread ids.
+/// This is an helper class to allow to pick a free processing slot when a task starts, and to give it back
+/// when the task ends.
 /// WARNING: this class does not work as a regular stack. The size is
 /// fixed at construction time and no blocking is foreseen.
+///
+/// Free slots are tracked by a bitmask updated with atomic operations, so that no lock is taken when tasks start and
+/// end. Each thread first tries to get back the slot it returned last: slot-local state (TTreeReaders, partial results
+/// of actions) is then reused by the same thread and stays in the memory close to the core that filled it.
 class RSlotStack {
 private:
+   using Word_t = std::uint64_t;
+   static constexpr unsigned int kBitsPerWord = 64;
+
    const unsigned int fSize;
-   std::stack<unsigned int> fStack;
-   ROOT::TSpinMutex fMutex;
+   std::vector<std::atomic<Word_t>> fFreeSlots; ///< Bit `i % 64` of word `i / 64` is set if slot `i` is free
+   std::atomic<int> fNFree;                     ///< Number of free slots not reserved by a call to GetSlot yet
+
+   bool TryAcquire(unsigned int slot);
 
 public:
    RSlotStack() = delete;
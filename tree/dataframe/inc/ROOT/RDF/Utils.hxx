@@ -176,6 +176,10 @@ void InterpreterDeclare(const std::string &code);
 /// The pointer returned by the call to TInterpreter::Calc is returned in case of success.
 Long64_t InterpreterCalc(const std::string &code, const std::string &context = "");
 
+/// Directory of the persistent cache of compiled Filter and Define expressions, empty if the cache is disabled.
+/// See ROOT::RDF::Experimental::SetJitCacheDirectory.
+std::string &GetJitCacheDirectory();
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
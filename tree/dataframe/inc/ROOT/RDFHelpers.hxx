@@ -15,6 +15,8 @@
 
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/RDF/GraphUtils.hxx>
+#include <ROOT/RResultHandle.hxx>
+#include <ROOT/RResultMap.hxx>
 #include <ROOT/RIntegerSequence.hxx>
 #include <ROOT/TypeTraits.hxx>
 
@@ -146,6 +148,52 @@ RNode AsRNode(NodeType node)
    return node;
 }
 
+// clang-format off
+/// Trigger the event loops of multiple RDataFrames concurrently.
+/// \param[in] handles A vector of RResultHandles, whose computation graphs are run together
+/// \return The number of distinct computation graphs that have been processed
+///
+/// The code of all pending RDataFrames that requires just-in-time compilation is compiled up front, in one go.
+/// With ImplicitMT enabled, the event loops then run as tasks of the same thread pool: the tasks of the different
+/// computation graphs are interleaved, so that small datasets do not leave workers idle at the end of their loop.
+/// Without ImplicitMT, the event loops run one after the other.
+///
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df1("tree1", "file1.root");
+/// auto r1 = df1.Histo1D("var1");
+///
+/// ROOT::RDataFrame df2("tree2", "file2.root");
+/// auto r2 = df2.Sum("var2");
+///
+/// // RResultPtr -> RResultHandle conversion is automatic
+/// ROOT::RDF::RunGraphs({r1, r2});
+/// ~~~
+// clang-format on
+unsigned int RunGraphs(std::vector<RResultHandle> handles);
+
+namespace Experimental {
+// clang-format off
+/// Enable the persistent cache of the Filter and Define expressions that are compiled just in time.
+/// \param[in] dir The directory of the cache. It is created if needed. An empty string disables the cache.
+///
+/// Each string expression is compiled with ACLiC, in a shared library of `dir` named after a hash of the expression,
+/// of the types of the columns it reads and of the ROOT version. Later processes load that library instead of
+/// compiling the body of the expression again. The libraries are built the first time an expression is jitted, which
+/// makes that first run slower. Expressions that cannot be compiled on their own, e.g. because they call functions
+/// declared to the interpreter, are recorded as such and are always jitted. Several processes can share the
+/// directory: each library is built under a name unique to the building process and then renamed into place.
+///
+/// The time spent jitting the nodes of a computation graph is reported by RInterface::GetJitTimes().
+///
+/// ~~~{.cpp}
+/// ROOT::RDF::Experimental::SetJitCacheDirectory("/scratch/rdfjit");
+/// ROOT::RDataFrame df("tree", "file.root");
+/// auto h = df.Filter("x > 0").Define("y", "sqrt(x)").Histo1D("y");
+/// ~~~
+// clang-format on
+void SetJitCacheDirectory(const std::string &dir);
+} // namespace Experimental
+
 } // namespace RDF
 } // namespace ROOT
 #endif
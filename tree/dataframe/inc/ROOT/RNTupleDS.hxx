@@ -33,6 +33,10 @@ class REntry;
 
 
 class RNTupleDS final : public ROOT::RDF::RDataSource {
+   /// The entry ranges are aligned to cluster boundaries. Neighboring clusters are grouped in order to create
+   /// about kTasksPerSlot ranges per slot, which allows for load balancing between the slots.
+   static constexpr unsigned int kTasksPerSlot = 10;
+
    /// Clones of the first reader, one for each slot
    std::vector<std::unique_ptr<ROOT::Experimental::RNTupleReader>> fReaders;
    std::vector<std::unique_ptr<ROOT::Experimental::REntry>> fEntries;
@@ -42,6 +46,10 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    bool fHasSeenAllRanges = false;
    std::vector<std::string> fColumnNames;
    std::vector<std::string> fColumnTypes;
+   /// If set, only the entry ranges that can pass the range filter are processed (see SetRangeFilter())
+   std::string fFilterFieldName;
+   double fFilterMin = 0.0;
+   double fFilterMax = 0.0;
 
 public:
    explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::RNTupleReader> ntuple);
@@ -51,6 +59,9 @@ public:
    bool HasColumn(std::string_view colName) const final;
    std::string GetTypeName(std::string_view colName) const final;
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
+   /// Skips the clusters and pages whose stored value range of the given field does not overlap with [min, max].
+   /// This is a pre-selection only, the entries of the remaining ranges still need to be filtered.
+   void SetRangeFilter(std::string_view fieldName, double min, double max);
 
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
 
@@ -0,0 +1,112 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RRESULTHANDLE
+#define ROOT_RRESULTHANDLE
+
+#include "ROOT/RResultPtr.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // TypeID2TypeName
+
+#include <memory>
+#include <sstream>
+#include <typeinfo>
+#include <stdexcept> // std::runtime_error
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+
+class RResultHandle;
+unsigned int RunGraphs(std::vector<RResultHandle> handles);
+
+/// A type-erased version of RResultPtr, which allows to put results of different types (and of different
+/// RDataFrames) in the same collection, e.g. to run their event loops concurrently with RunGraphs().
+class RResultHandle {
+   /// Non-owning pointer to the RLoopManager at the root of the computation graph of the result
+   ROOT::Detail::RDF::RLoopManager *fLoopManager = nullptr;
+   std::shared_ptr<void> fObjPtr; ///< Type-erased shared pointer encapsulating the wrapped result
+   /// Owning pointer to the action that will produce this result
+   std::shared_ptr<ROOT::Internal::RDF::RActionBase> fActionPtr;
+   const std::type_info *fType = nullptr; ///< Type of the wrapped result
+
+   friend unsigned int RunGraphs(std::vector<RResultHandle> handles);
+
+   /// Get the pointer to the encapsulated result, triggering the event loop if needed
+   void *Get()
+   {
+      if (!fActionPtr->HasRun())
+         fLoopManager->Run();
+      return fObjPtr.get();
+   }
+
+   /// Compare the type of the result with the requested type
+   void CheckType(const std::type_info &type)
+   {
+      if (*fType != type) {
+         std::stringstream ss;
+         ss << "Got the type " << ROOT::Internal::RDF::TypeID2TypeName(type)
+            << " but the RResultHandle refers to a result of type " << ROOT::Internal::RDF::TypeID2TypeName(*fType)
+            << ".";
+         throw std::runtime_error(ss.str());
+      }
+   }
+
+   void ThrowIfNull()
+   {
+      if (fObjPtr == nullptr)
+         throw std::runtime_error("Trying to access the contents of a null RResultHandle.");
+   }
+
+public:
+   template <class T>
+   RResultHandle(const RResultPtr<T> &resultPtr)
+      : fLoopManager(resultPtr.fLoopManager), fObjPtr(resultPtr.fObjPtr), fActionPtr(resultPtr.fActionPtr),
+        fType(&typeid(T))
+   {
+   }
+
+   RResultHandle(const RResultHandle &) = default;
+   RResultHandle(RResultHandle &&) = default;
+   RResultHandle &operator=(const RResultHandle &) = default;
+   RResultHandle &operator=(RResultHandle &&) = default;
+
+   /// Get the pointer to the encapsulated object.
+   /// Triggers event loop and execution of all actions booked in the associated RLoopManager.
+   /// \tparam T Type of the action result
+   template <class T>
+   T *GetPtr()
+   {
+      ThrowIfNull();
+      CheckType(typeid(T));
+      return static_cast<T *>(Get());
+   }
+
+   /// Get a const reference to the encapsulated object.
+   /// Triggers event loop and execution of all actions booked in the associated RLoopManager.
+   /// \tparam T Type of the action result
+   template <class T>
+   const T &GetValue()
+   {
+      ThrowIfNull();
+      CheckType(typeid(T));
+      return *static_cast<T *>(Get());
+   }
+
+   /// Check whether the result has already been computed
+   bool IsReady() const { return fActionPtr->HasRun(); }
+
+   bool operator==(const RResultHandle &rhs) const { return fObjPtr == rhs.fObjPtr; }
+   bool operator!=(const RResultHandle &rhs) const { return !(fObjPtr == rhs.fObjPtr); }
+};
+
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RRESULTHANDLE
@@ -0,0 +1,137 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RRESULTMAP
+#define ROOT_RRESULTMAP
+
+#include "ROOT/RResultPtr.hxx"
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+// Varied results are managed by their shared_ptr, like the nominal ones: copies of histograms must not be attached
+// to the current directory
+template <typename T>
+auto DetachFromDirectory(T &obj, int) -> decltype(obj.SetDirectory(nullptr), void())
+{
+   obj.SetDirectory(nullptr);
+}
+
+template <typename T>
+void DetachFromDirectory(T &, long)
+{
+}
+} // namespace RDF
+} // namespace Internal
+
+namespace RDF {
+namespace Experimental {
+
+/// A collection of the results of an action for the nominal values of its inputs and for each of the systematic
+/// variations registered upstream with RInterface::Vary. Produced by VariationsFor().
+///
+/// The keys are "nominal" and, for each variation, "<variation name>:<tag>". Accessing any of the results triggers
+/// the event loop that produces all of them, if it has not run yet.
+template <typename T>
+class RResultMap {
+   std::vector<std::string> fKeys; ///< The keys of the results, in booking order
+   std::unordered_map<std::string, RResultPtr<T>> fResults;
+
+   template <typename T1>
+   friend RResultMap<T1> VariationsFor(RResultPtr<T1> resPtr);
+
+   RResultMap() = default;
+
+   void Add(const std::string &key, RResultPtr<T> result)
+   {
+      fKeys.emplace_back(key);
+      fResults.emplace(key, std::move(result));
+   }
+
+public:
+   /// Return the result for the given key, triggering the event loop if needed
+   T &operator[](const std::string &key)
+   {
+      auto it = fResults.find(key);
+      if (it == fResults.end())
+         throw std::runtime_error("RResultMap: no result for \"" + key + "\". Keys are \"nominal\" and "
+                                  "\"<variation>:<tag>\" for the variations that affect the result.");
+      return *it->second;
+   }
+
+   /// Return the keys of the results, "nominal" first
+   const std::vector<std::string> &GetKeys() const { return fKeys; }
+
+   std::size_t size() const { return fKeys.size(); }
+};
+
+/// Book the varied counterparts of an action: one result for each tag of each systematic variation, registered with
+/// RInterface::Vary, that affects the inputs of the action or the selection of its entries.
+/// The varied results are filled in the same event loop as the nominal one, and columns or filters that are not
+/// affected by a variation are evaluated once per entry for all of them.
+///
+/// The varied results start as copies of the nominal result, so this must be called before the event loop runs.
+/// An exception is thrown if a node affected by a variation cannot be cloned, e.g. because its action does not
+/// support variations or its expression is not copyable.
+///
+/// ### Example usage:
+/// ~~~{.cpp}
+/// auto h = df.Vary("pt", [](double pt) { return RVec<double>{0.9 * pt, 1.1 * pt}; }, {"pt"}, {"down", "up"})
+///             .Filter("pt > 10")
+///             .Histo1D("pt");
+/// auto hs = ROOT::RDF::Experimental::VariationsFor(h);
+/// hs["nominal"].Draw();
+/// hs["pt:up"].Draw("SAME");
+/// ~~~
+template <typename T>
+RResultMap<T> VariationsFor(RResultPtr<T> resPtr)
+{
+   if (!resPtr)
+      throw std::runtime_error("VariationsFor: called on a null RResultPtr.");
+   if (resPtr.fActionPtr->HasRun())
+      throw std::runtime_error("VariationsFor: the event loop that produces this result has already run, varied "
+                               "results must be booked before the nominal one is computed.");
+
+   auto &lm = *resPtr.fLoopManager;
+   // jitted nodes must exist before they can be cloned
+   lm.Jit();
+
+   RResultMap<T> results;
+   const auto nominal = resPtr.fObjPtr;
+   const auto actionPtr = resPtr.fActionPtr;
+   results.Add("nominal", std::move(resPtr));
+   for (const auto &variation : actionPtr->GetVariations()) {
+      const auto &tags = variation.second.fTags;
+      for (std::size_t i = 0; i < tags.size(); ++i) {
+         auto variedResult = std::make_shared<T>(*nominal);
+         ROOT::Internal::RDF::DetachFromDirectory(*variedResult, 0);
+         auto variedAction = actionPtr->MakeVariedAction(variation.first, i, variedResult);
+         if (!variedAction)
+            break; // all tags of a variation affect the same nodes
+         results.Add(variation.first + ':' + tags[i],
+                     ROOT::Detail::RDF::MakeResultPtr(variedResult, lm, std::move(variedAction)));
+      }
+   }
+   return results;
+}
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RRESULTMAP
@@ -33,6 +33,17 @@ namespace RDF {
 template <typename T>
 class RResultPtr;
 
+// Fwd decl for friend declaration
+class RResultHandle;
+
+namespace Experimental {
+template <typename T>
+class RResultMap;
+
+template <typename T>
+RResultMap<T> VariationsFor(RResultPtr<T> resPtr);
+} // ns Experimental
+
 } // ns RDF
 
 namespace Detail {
@@ -95,6 +106,11 @@ class RResultPtr {
 
    friend class ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper;
 
+   friend class RResultHandle;
+
+   template <typename T1>
+   friend Experimental::RResultMap<T1> Experimental::VariationsFor(RResultPtr<T1> resPtr);
+
    /// \cond HIDDEN_SYMBOLS
    template <typename V, bool hasBeginEnd = TTraits::HasBeginAndEnd<V>::value>
    struct RIterationHelper {
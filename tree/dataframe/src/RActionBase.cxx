@@ -9,7 +9,9 @@
  *************************************************************************/
 
 #include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RCustomColumnBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 
 using namespace ROOT::Internal::RDF;
 
@@ -18,3 +20,10 @@ RActionBase::RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, RBooke
 
 // outlined to pin virtual table
 RActionBase::~RActionBase() {}
+
+void RActionBase::SetProfiler(RProfiler *profiler)
+{
+   fTimer = profiler ? profiler->GetTimer(this, "Action", GetActionName()) : nullptr;
+   for (auto &column : fCustomColumns.GetColumns())
+      column.second->SetProfiler(profiler);
+}
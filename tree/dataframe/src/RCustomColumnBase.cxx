@@ -9,6 +9,8 @@
  *************************************************************************/
 
 #include "ROOT/RDF/RCustomColumnBase.hxx"
+#include "ROOT/RDF/InterfaceUtils.hxx" // IsInternalColumn
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/RStringView.hxx"
 #include "RtypesCore.h" // Long64_t
 
@@ -44,3 +46,10 @@ std::string RCustomColumnBase::GetTypeName() const
 {
    return fType;
 }
+
+void RCustomColumnBase::SetProfiler(RDFInternal::RProfiler *profiler)
+{
+   // the values of data source columns are read by RDataSource::SetEntry, which the RLoopManager times
+   const bool isProfiled = profiler && !fIsDataSourceColumn && !RDFInternal::IsInternalColumn(fName);
+   fTimer = isProfiled ? profiler->GetTimer(this, "Define", fName) : nullptr;
+}
@@ -1,4 +1,5 @@
 #include "ROOT/RDF/RBookedCustomColumns.hxx"
+#include "ROOT/RDF/RCustomColumnBase.hxx"
 
 namespace ROOT {
 namespace Internal {
@@ -25,6 +26,51 @@ void RBookedCustomColumns::AddName(std::string_view name)
    fCustomColumnsNames = newColsNames;
 }
 
+void RBookedCustomColumns::AddVariation(std::string_view name, RVariationInfo variation)
+{
+   auto newVariations = std::make_shared<RVariationsMap_t>(GetVariations());
+   (*newVariations)[std::string(name)] = std::move(variation);
+   fVariations = newVariations;
+}
+
+RBookedCustomColumns RBookedCustomColumns::GetVaried(const std::string &variation, std::size_t tagIdx) const
+{
+   const auto &info = fVariations->at(variation);
+   auto newCols = std::make_shared<RCustomColumnBasePtrMap_t>(GetColumns());
+   for (auto &column : *newCols) {
+      if (column.first == info.fColumnName)
+         continue;
+      // columns defined downstream of the variation are cloned if they read it, directly or indirectly
+      auto variedColumn = column.second->GetVariedColumn(variation, tagIdx);
+      if (variedColumn)
+         column.second = std::move(variedColumn);
+   }
+   (*newCols)[info.fColumnName] = info.fVariedColumns[tagIdx];
+
+   auto newColsNames = fCustomColumnsNames;
+   if (!HasName(info.fColumnName)) {
+      // the varied column is a dataset column: its variations are custom columns
+      auto names = std::make_shared<ColumnNames_t>(GetNames());
+      names->emplace_back(info.fColumnName);
+      newColsNames = names;
+   }
+
+   return RBookedCustomColumns(newCols, newColsNames, fVariations);
+}
+
+bool RBookedCustomColumns::HasDifferentColumns(const ColumnNames_t &names, const RBookedCustomColumns &other) const
+{
+   for (const auto &name : names) {
+      const auto it = fCustomColumns->find(name);
+      const auto otherIt = other.fCustomColumns->find(name);
+      const auto *column = it == fCustomColumns->end() ? nullptr : it->second.get();
+      const auto *otherColumn = otherIt == other.fCustomColumns->end() ? nullptr : otherIt->second.get();
+      if (column != otherColumn)
+         return true;
+   }
+   return false;
+}
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
@@ -1,4 +1,5 @@
 #include "ROOT/RDF/GraphUtils.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 
 namespace ROOT {
 namespace Internal {
@@ -25,6 +26,20 @@ std::string GraphCreatorHelper::FromGraphLeafToDot(std::shared_ptr<GraphNode> le
    return "digraph {\n" + dotStringLabels.str() + dotStringGraph.str() + "}";
 }
 
+std::string GraphCreatorHelper::FromGraphLeafToExpressions(std::shared_ptr<GraphNode> leaf, bool &hasCallables)
+{
+   std::stringstream expressions;
+   hasCallables = false;
+   while (leaf) {
+      if (leaf->fHasCallable)
+         hasCallables = true;
+      else if (!leaf->fExpression.empty())
+         expressions << leaf->fCounter << ": " << leaf->fExpression << "\n";
+      leaf = leaf->fPrevNode;
+   }
+   return expressions.str();
+}
+
 std::string GraphCreatorHelper::FromGraphActionsToDot(std::vector<std::shared_ptr<GraphNode>> leaves)
 {
    // Only the mapping between node id and node label (i.e. name)
@@ -88,8 +103,10 @@ CreateDefineNode(const std::string &columnName, const ROOT::Detail::RDF::RCustom
       return duplicateDefine;
    }
 
-   auto node = std::make_shared<GraphNode>("Define\n" + columnName);
+   const auto annotation = columnPtr->GetTimer() ? columnPtr->GetTimer()->GetAnnotation() : std::string();
+   auto node = std::make_shared<GraphNode>("Define\n" + columnName + annotation);
    node->SetDefine();
+   node->SetExpression(columnPtr->GetExpression());
 
    sColumnsMap[columnPtr] = node;
    return node;
@@ -106,10 +123,12 @@ std::shared_ptr<GraphNode> CreateFilterNode(const ROOT::Detail::RDF::RFilterBase
       return duplicateFilter;
    }
    auto filterName = (filterPtr->HasName() ? filterPtr->GetName() : "Filter");
-   auto node = std::make_shared<GraphNode>(filterName);
+   const auto annotation = filterPtr->GetTimer() ? filterPtr->GetTimer()->GetAnnotation() : std::string();
+   auto node = std::make_shared<GraphNode>(filterName + annotation);
 
    sFiltersMap[filterPtr] = node;
    node->SetFilter();
+   node->SetExpression(filterPtr->GetExpression());
    return node;
 }
 
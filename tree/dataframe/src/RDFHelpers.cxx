@@ -0,0 +1,75 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDFHelpers.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/Utils.hxx" // GetJitCacheDirectory
+#include "RConfigure.h" // R__USE_IMT
+#include "TError.h" // Warning
+#include "TROOT.h" // IsImplicitMTEnabled
+#include "TSystem.h" // mkdir
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+unsigned int ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
+{
+   if (handles.empty()) {
+      Warning("RunGraphs", "Got an empty list of handles");
+      return 0;
+   }
+
+   // Results that are already available do not need an event loop
+   const std::size_t nToRun =
+      std::count_if(handles.begin(), handles.end(), [](const RResultHandle &h) { return !h.IsReady(); });
+   if (nToRun < handles.size()) {
+      Warning("RunGraphs", "Got %lu handles from which %lu link to results which are already ready.",
+              handles.size(), handles.size() - nToRun);
+   }
+   if (nToRun == 0)
+      return 0;
+
+   // Find the unique event loops
+   std::set<ROOT::Detail::RDF::RLoopManager *> seen;
+   std::vector<ROOT::Detail::RDF::RLoopManager *> loops;
+   for (const auto &h : handles) {
+      if (h.IsReady())
+         continue;
+      if (seen.insert(h.fLoopManager).second)
+         loops.emplace_back(h.fLoopManager);
+   }
+
+   // One call jits the code required by all computation graphs
+   loops[0]->Jit();
+
+   auto run = [](ROOT::Detail::RDF::RLoopManager *lm) { lm->Run(); };
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(run, loops);
+      return loops.size();
+   }
+#endif
+   std::for_each(loops.begin(), loops.end(), run);
+   return loops.size();
+}
+
+void ROOT::RDF::Experimental::SetJitCacheDirectory(const std::string &dir)
+{
+   if (!dir.empty() && gSystem->AccessPathName(dir.c_str()) && gSystem->mkdir(dir.c_str(), /*recursive=*/true) != 0)
+      throw std::runtime_error("SetJitCacheDirectory: could not create the directory " + dir + ".");
+   ROOT::Internal::RDF::GetJitCacheDirectory() = dir;
+}
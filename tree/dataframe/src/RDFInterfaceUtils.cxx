@@ -9,20 +9,26 @@
  *************************************************************************/
 
 #include <ROOT/RDF/InterfaceUtils.hxx>
+#include <ROOT/RCacheOptions.hxx>
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDF/GraphUtils.hxx>
 #include <ROOT/RDF/RInterface.hxx>
 #include <ROOT/RStringView.hxx>
 #include <ROOT/TSeq.hxx>
 #include <RtypesCore.h>
+#include <RVersion.h> // ROOT_RELEASE
 #include <TDirectory.h>
 #include <TChain.h>
 #include <TClass.h>
 #include <TClassEdit.h>
+#include <TFile.h>
 #include <TFriendElement.h>
 #include <TInterpreter.h>
+#include <TMD5.h>
 #include <TObject.h>
 #include <TPRegexp.h>
 #include <TString.h>
+#include <TSystem.h>
 #include <TTree.h>
 
 // pragma to disable warnings on Rcpp which have
@@ -38,6 +44,8 @@
 #endif
 
 #include <algorithm>
+#include <chrono>
+#include <fstream>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -190,35 +198,129 @@ static std::unordered_map<std::string, std::string> &GetJittedExprs() {
    return jittedExpressions;
 }
 
-static std::string
-BuildLambdaString(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
+/// Return the parameter list of a jitted lambda, e.g. "float& x, int& y"
+static std::string BuildLambdaParams(const ColumnNames_t &vars, const ColumnNames_t &varTypes)
 {
    R__ASSERT(vars.size() == varTypes.size());
 
-   TPRegexp re(R"(\breturn\b)");
-   const bool hasReturnStmt = re.Match(expr) == 1;
-
    std::stringstream ss;
-   ss << "[](";
    for (auto i = 0u; i < vars.size(); ++i) {
       // We pass by reference to avoid expensive copies
       // It can't be const reference in general, as users might want/need to call non-const methods on the values
       ss << varTypes[i] << "& " << vars[i] << ", ";
    }
+   auto params = ss.str();
    if (!vars.empty())
-      ss.seekp(-2, ss.cur);
+      params.resize(params.size() - 2);
+   return params;
+}
+
+/// Return the body of a jitted lambda, adding the return statement if the expression has none
+static std::string BuildLambdaBody(const std::string &expr)
+{
+   TPRegexp re(R"(\breturn\b)");
+   const bool hasReturnStmt = re.Match(expr) == 1;
 
    if (hasReturnStmt)
-      ss << "){";
-   else
-      ss << "){return ";
-   ss << expr << "\n;}";
+      return "{" + expr + "\n;}";
+   return "{return " + expr + "\n;}";
+}
+
+static std::string
+BuildLambdaString(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
+{
+   return "[](" + BuildLambdaParams(vars, varTypes) + ")" + BuildLambdaBody(expr);
+}
 
-   return ss.str();
+/// Each jitted lambda comes with a lambda_ret_t type alias for its return type.
+/// Resolve that alias and return the true type as string.
+static std::string RetTypeOfLambda(const std::string &lambdaName)
+{
+   auto *ti = gInterpreter->TypedefInfo_Factory((lambdaName + "_ret_t").c_str());
+   const char *type = gInterpreter->TypedefInfo_TrueName(ti);
+   return type;
+}
+
+/// The first line of the source of a cached expression: it is followed by the return type of the expression once
+/// its library has been built, and by kJitCacheFailed if the expression cannot be compiled on its own
+static const std::string kJitCacheTag = "// RDataFrame jitted expression, returns ";
+static const std::string kJitCacheFailed = "<not compilable>";
+
+/// Return the path, without extension, of the persistent cache entry of a lambda expression
+static std::string GetJitCacheEntry(const std::string &lambdaExpr)
+{
+   // libraries built by another ROOT version cannot be reused
+   const std::string key = lambdaExpr + "\n" + ROOT_RELEASE;
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+   md5.Final();
+   return ROOT::Internal::RDF::GetJitCacheDirectory() + "/rdfjit_" + md5.AsString();
+}
+
+/// Read the state of a cache entry from the first line of its source: the return type of the compiled expression,
+/// kJitCacheFailed, or an empty string if the entry does not exist or is being built
+static std::string ReadJitCacheEntry(const std::string &entry)
+{
+   std::ifstream source(entry + ".C");
+   std::string firstLine;
+   if (!source || !std::getline(source, firstLine) || firstLine.compare(0, kJitCacheTag.size(), kJitCacheTag) != 0)
+      return "";
+   return firstLine.substr(kJitCacheTag.size());
+}
+
+/// Write `content` to `fileName` atomically, so that concurrent processes never read partial cache entries
+static void WriteJitCacheFile(const std::string &fileName, const std::string &content)
+{
+   const auto tmpFileName = fileName + ".tmp" + std::to_string(gSystem->GetPid());
+   {
+      std::ofstream out(tmpFileName);
+      out << content;
+   }
+   gSystem->Rename(tmpFileName.c_str(), fileName.c_str());
+}
+
+/// Build the library of a cache entry: a non-inline function `funcName` with the parameters and body of the lambda.
+/// Only the declaration of the function needs to be jitted by later processes.
+static void BuildJitCacheEntry(const std::string &entry, const std::string &funcName, const std::string &params,
+                               const std::string &body, const std::string &retType, const ColumnNames_t &varTypes)
+{
+   std::stringstream code;
+   code << "#include \"Rtypes.h\"\n#include \"ROOT/RVec.hxx\"\n";
+   auto types = varTypes;
+   types.emplace_back(retType);
+   for (const auto &type : types) {
+      auto cl = TClass::GetClass(type.c_str());
+      if (cl && cl->GetDeclFileName() && cl->GetDeclFileName()[0] != '\0')
+         code << "#include \"" << cl->GetDeclFileName() << "\"\n";
+   }
+   code << "namespace __rdf {\n" << retType << " " << funcName << "(" << params << ")" << body << "\n}\n";
+
+   // Concurrent processes may build the same entry: each one builds under its own name and renames the library into
+   // place, so that no process compiles over, or loads, a library that another process is writing. The auxiliary
+   // files of the build (e.g. the dictionary pcm, which the library refers to by name) keep the unique name.
+   const auto buildName = entry + "_" + std::to_string(gSystem->GetPid());
+   const auto buildSourceName = buildName + ".C";
+   {
+      std::ofstream out(buildSourceName);
+      out << code.str();
+   }
+   bool built = gSystem->CompileMacro(buildSourceName.c_str(), "kcOs", buildName.c_str()) == 1;
+   gSystem->Unlink(buildSourceName.c_str());
+   if (built) {
+      const auto soExt = std::string(".") + gSystem->GetSoExt();
+      const auto buildLibName = buildName + soExt;
+      built = gSystem->Rename(buildLibName.c_str(), (entry + soExt).c_str()) == 0;
+      if (!built)
+         gSystem->Unlink(buildLibName.c_str());
+   }
+   // the tag marks the entry as usable: it is written after the library is in place
+   WriteJitCacheFile(entry + ".C", kJitCacheTag + (built ? retType : kJitCacheFailed) + "\n" + code.str());
 }
 
 /// Declare a lambda expression to the interpreter in namespace __rdf, return the name of the jitted lambda.
 /// If the lambda expression is already in GetJittedExprs, return the name for the lambda that has already been jitted.
+/// If the persistent cache of expressions is enabled, the body of the lambda is taken from a library compiled by an
+/// earlier process, or such a library is built for later processes.
 static std::string DeclareLambda(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
 {
    const auto lambdaExpr = BuildLambdaString(expr, vars, varTypes);
@@ -233,28 +335,40 @@ static std::string DeclareLambda(const std::string &expr, const ColumnNames_t &v
    // new expression
    const auto lambdaBaseName = "lambda" + std::to_string(exprMap.size());
    const auto lambdaFullName = "__rdf::" + lambdaBaseName;
-
-   const auto toDeclare = "namespace __rdf {\nauto " + lambdaBaseName + " = " + lambdaExpr + ";\nusing " +
-                          lambdaBaseName + "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" +
-                          lambdaBaseName + ")>::ret_type;\n}";
+   const auto retTypeAlias = "using " + lambdaBaseName + "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" +
+                             lambdaBaseName + ")>::ret_type;\n}";
+
+   const bool useCache = !ROOT::Internal::RDF::GetJitCacheDirectory().empty();
+   const auto cacheEntry = useCache ? GetJitCacheEntry(lambdaExpr) : "";
+   const auto cacheState = useCache ? ReadJitCacheEntry(cacheEntry) : "";
+   const auto funcName = cacheEntry.substr(cacheEntry.find_last_of('/') + 1);
+   const auto params = BuildLambdaParams(vars, varTypes);
+   const auto libName = cacheEntry + "." + gSystem->GetSoExt();
+   const bool isCached = !cacheState.empty() && cacheState != kJitCacheFailed && gSystem->Load(libName.c_str()) >= 0;
+
+   std::string toDeclare;
+   if (isCached) {
+      // the lambda forwards to the compiled function, whose body is not jitted
+      std::string args;
+      for (const auto &var : vars)
+         args += (args.empty() ? "" : ", ") + var;
+      toDeclare = "namespace __rdf {\n" + cacheState + " " + funcName + "(" + params + ");\nauto " + lambdaBaseName +
+                  " = [](" + params + ") { return " + funcName + "(" + args + "); };\n" + retTypeAlias;
+   } else {
+      toDeclare = "namespace __rdf {\nauto " + lambdaBaseName + " = " + lambdaExpr + ";\n" + retTypeAlias;
+   }
    ROOT::Internal::RDF::InterpreterDeclare(toDeclare.c_str());
 
    // InterpreterDeclare could throw. If it doesn't, mark the lambda as already jitted
    exprMap.insert({lambdaExpr, lambdaFullName});
 
-   return lambdaFullName;
-}
+   if (useCache && cacheState.empty())
+      BuildJitCacheEntry(cacheEntry, funcName, params, BuildLambdaBody(expr), RetTypeOfLambda(lambdaFullName),
+                         varTypes);
 
-/// Each jitted lambda comes with a lambda_ret_t type alias for its return type.
-/// Resolve that alias and return the true type as string.
-static std::string RetTypeOfLambda(const std::string &lambdaName)
-{
-   auto *ti = gInterpreter->TypedefInfo_Factory((lambdaName + "_ret_t").c_str());
-   const char *type = gInterpreter->TypedefInfo_TrueName(ti);
-   return type;
+   return lambdaFullName;
 }
 
-
 static void GetTopLevelBranchNamesImpl(TTree &t, std::set<std::string> &bNamesReg, ColumnNames_t &bNames,
                                        std::set<TTree *> &analysedTrees)
 {
@@ -317,6 +431,34 @@ static bool IsValidCppVarName(const std::string &var)
    return true;
 }
 
+/// Append the names of the files read by a tree or a chain, and by their friends, to fileNames
+void GetInputFileNames(TTree &tree, std::vector<std::string> &fileNames)
+{
+   if (auto chain = dynamic_cast<TChain *>(&tree)) {
+      for (const auto element : *chain->GetListOfFiles())
+         fileNames.emplace_back(element->GetTitle());
+   } else if (auto file = tree.GetCurrentFile()) {
+      fileNames.emplace_back(file->GetName());
+   }
+
+   if (auto friends = tree.GetListOfFriends()) {
+      for (const auto fr : *friends) {
+         if (auto friendTree = static_cast<TFriendElement *>(fr)->GetTree())
+            GetInputFileNames(*friendTree, fileNames);
+      }
+   }
+}
+
+/// A cache file is only usable if it contains the cached tree: files are written under a temporary name and then
+/// renamed, but they can still be truncated or corrupted by other means
+bool IsValidCacheFile(const std::string &fileName, const std::string &treeName)
+{
+   if (gSystem->AccessPathName(fileName.c_str()))
+      return false;
+   std::unique_ptr<TFile> file(TFile::Open(fileName.c_str(), "READ"));
+   return file && !file->IsZombie() && file->Get(treeName.c_str()) != nullptr;
+}
+
 } // anonymous namespace
 
 namespace ROOT {
@@ -411,6 +553,68 @@ ColumnNames_t ConvertRegexToColumns(const RDFInternal::RBookedCustomColumns & cu
    return selectedColumns;
 }
 
+RInterface<RLoopManager, void>
+GetOrCreatePersistentCache(RNode &node, RLoopManager &loopManager, const ColumnNames_t &validColumns,
+                           const ColumnNames_t &columnNames, const RCacheOptions &options,
+                           const std::function<void(const std::string &, const std::string &)> &snapshot)
+{
+   // The graph names the Filters and Defines but not the code they evaluate: the expressions of the jitted ones are
+   // hashed too, while the code of compiled callables is unknown and must be versioned by the user through fKey.
+   bool hasCallables = false;
+   const auto expressions = GraphDrawing::GraphCreatorHelper().GetExpressions(node, hasCallables);
+   if (hasCallables && options.fKey.empty())
+      throw std::runtime_error("Cache: the computation graph contains Filters or Defines with compiled callables, "
+                               "whose code cannot be part of the cache key. Set RCacheOptions::fKey to cache it "
+                               "persistently, and change the key whenever these callables change.");
+
+   std::stringstream key;
+   key << options.fKey << '\n';
+   for (const auto &col : validColumns)
+      key << col << '\n';
+   key << GraphDrawing::GraphCreatorHelper()(node) << '\n';
+   key << expressions;
+
+   if (auto tree = loopManager.GetTree()) {
+      std::vector<std::string> fileNames;
+      GetInputFileNames(*tree, fileNames);
+      if (fileNames.empty())
+         throw std::runtime_error("Cache: the input tree is not read from a file, it cannot be cached persistently.");
+      key << tree->GetName() << '\n';
+      for (const auto &fileName : fileNames) {
+         key << fileName;
+         FileStat_t stat;
+         if (gSystem->GetPathInfo(fileName.c_str(), stat) == 0)
+            key << ' ' << stat.fSize << ' ' << stat.fMtime;
+         key << '\n';
+      }
+   } else {
+      key << loopManager.GetNEmptyEntries() << '\n';
+   }
+
+   const auto keyStr = key.str();
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(keyStr.data()), keyStr.size());
+   md5.Final();
+
+   const std::string dir = options.fDirectory.empty() ? gSystem->TempDirectory() : options.fDirectory;
+   gSystem->mkdir(dir.c_str(), /*recursive=*/true);
+   const std::string fileName = dir + "/rdfcache_" + md5.AsString() + ".root";
+   const std::string treeName = "rdfcache";
+
+   if (!IsValidCacheFile(fileName, treeName)) {
+      // concurrent processes can fill the same cache: only complete files are made visible under the final name
+      const std::string tmpFileName = fileName + ".tmp" + std::to_string(gSystem->GetPid());
+      snapshot(treeName, tmpFileName);
+      if (gSystem->Rename(tmpFileName.c_str(), fileName.c_str()) != 0) {
+         gSystem->Unlink(tmpFileName.c_str());
+         throw std::runtime_error("Cache: could not create the cache file " + fileName + ".");
+      }
+   }
+
+   ::TDirectory::TContext ctxt;
+   return ROOT::RDataFrame(treeName, fileName, columnNames);
+}
+
 void CheckCustomColumn(std::string_view definedCol, TTree *treePtr, const ColumnNames_t &customCols,
                        const std::map<std::string, std::string> &aliasMap, const ColumnNames_t &dataSourceColumns)
 {
@@ -545,10 +749,15 @@ void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter,
       ParseRDFExpression(std::string(expression), branches, customCols.GetNames(), dsColumns, aliasMap);
    const auto exprVarTypes =
       GetValidatedArgTypes(parsedExpr.fUsedCols, customCols, tree, ds, "Filter", /*vector2rvec=*/true);
+   const auto start = std::chrono::steady_clock::now();
    const auto lambdaName = DeclareLambda(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
    const auto type = RetTypeOfLambda(lambdaName);
+   const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+   auto lm = jittedFilter->GetLoopManagerUnchecked();
+   lm->AddJitTime("Filter " + std::string(name.empty() ? expression : name), elapsed.count());
    if (type != "bool")
       std::runtime_error("Filter: the following expression does not evaluate to bool:\n" + std::string(expression));
+   jittedFilter->SetExpression(expression);
 
    // columnsOnHeap is deleted by the jitted call to JitFilterHelper
    ROOT::Internal::RDF::RBookedCustomColumns *columnsOnHeap = new ROOT::Internal::RDF::RBookedCustomColumns(customCols);
@@ -574,7 +783,6 @@ void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter,
                     << "reinterpret_cast<ROOT::Internal::RDF::RBookedCustomColumns*>(" << columnsOnHeapAddr << ")"
                     << ");\n";
 
-   auto lm = jittedFilter->GetLoopManagerUnchecked();
    lm->ToJitExec(filterInvocation.str());
 }
 
@@ -592,12 +800,16 @@ std::shared_ptr<RJittedCustomColumn> BookDefineJit(std::string_view name, std::s
       ParseRDFExpression(std::string(expression), branches, customCols.GetNames(), dsColumns, aliasMap);
    const auto exprVarTypes =
       GetValidatedArgTypes(parsedExpr.fUsedCols, customCols, tree, ds, "Define", /*vector2rvec=*/true);
+   const auto start = std::chrono::steady_clock::now();
    const auto lambdaName = DeclareLambda(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
    const auto type = RetTypeOfLambda(lambdaName);
+   const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+   lm.AddJitTime("Define " + std::string(name), elapsed.count());
 
    auto customColumnsCopy = new RDFInternal::RBookedCustomColumns(customCols);
    auto customColumnsAddr = PrettyPrintAddr(customColumnsCopy);
    auto jittedCustomColumn = std::make_shared<RDFDetail::RJittedCustomColumn>(name, type, lm.GetNSlots());
+   jittedCustomColumn->SetExpression(expression);
 
    std::stringstream defineInvocation;
    defineInvocation << "ROOT::Internal::RDF::JitDefineHelper(" << lambdaName << ", {";
@@ -311,6 +311,12 @@ Long64_t InterpreterCalc(const std::string &code, const std::string &context)
    return res;
 }
 
+std::string &GetJitCacheDirectory()
+{
+   static std::string cacheDir;
+   return cacheDir;
+}
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
@@ -70,6 +70,7 @@ Transformations are a way to manipulate the data.
 | [DefineSlotEntry](classROOT_1_1RDF_1_1RInterface.html#a4f17074d5771916e3df18f8458186de7) | Same as `DefineSlot`, but the entry number is passed in addition to the slot number. This is meant as a helper in case some dependency on the entry number needs to be honoured. |
 | [Filter](classROOT_1_1RDF_1_1RInterface.html#a70284a3bedc72b19610aaa91b5007ebd) | Filter the rows of the dataset. |
 | [Range](classROOT_1_1RDF_1_1RInterface.html#a1b36b7868831de2375e061bb06cfc225) | Creates a node that filters entries based on range of entries |
+| [Vary](classROOT_1_1RDF_1_1RInterface.html) | Registers systematic variations of a column, see [systematic variations](#systematics). |
 
 ### Actions
 Actions are a way to produce a result out of the data. Each one is described in more detail in the reference guide.
@@ -85,7 +86,7 @@ produce several different results in one event loop. Instant actions trigger the
 |------------------|-----------------|
 | [Aggregate](classROOT_1_1RDF_1_1RInterface.html#ae540b00addc441f9b504cbae0ef0a24d) | Execute a user-defined accumulation operation on the processed column values. |
 | [Book](classROOT_1_1RDF_1_1RInterface.html#a9b2f61f3333d1669e57055b9ae8be9d9) | Book execution of a custom action using a user-defined helper object. |
-| [Cache](classROOT_1_1RDF_1_1RInterface.html#aaaa0a7bb8eb21315d8daa08c3e25f6c9) | Caches in contiguous memory columns' entries. Custom columns can be cached as well, filtered entries are not cached. Users can specify which columns to save (default is all). |
+| [Cache](classROOT_1_1RDF_1_1RInterface.html#aaaa0a7bb8eb21315d8daa08c3e25f6c9) | Caches in contiguous memory columns' entries. Custom columns can be cached as well, filtered entries are not cached. Users can specify which columns to save (default is all). With RCacheOptions, columns are cached in a file that later runs reuse if the computation graph and its inputs did not change. |
 | [Count](classROOT_1_1RDF_1_1RInterface.html#a37f9e00c2ece7f53fae50b740adc1456) | Return the number of events processed. |
 | [Display](classROOT_1_1RDF_1_1RInterface.html#aee68f4411f16f00a1d46eccb6d296f01) | Obtains the events in the dataset for the requested columns. The method returns a [RDisplay](classROOT_1_1RDF_1_1RDisplay.html) instance which can be queried to get a compressed tabular representation on the standard output or a complete representation as a string. |
 | [Fill](classROOT_1_1RDF_1_1RInterface.html#a0cac4d08297c23d16de81ff25545440a) | Fill a user-defined object with the values of the specified branches, as if by calling `Obj.Fill(branch1, branch2, ...). |
@@ -121,6 +122,7 @@ produce several different results in one event loop. Instant actions trigger the
 | [Display](classROOT_1_1RDF_1_1RInterface.html#a652f9ab3e8d2da9335b347b540a9a941) | Provides an ASCII representation of the columns types and contents of the dataset printable by the user. |
 | [SaveGraph](namespaceROOT_1_1RDF.html#adc17882b283c3d3ba85b1a236197c533) | Store the computation graph of an RDataFrame in graphviz format for easy inspection. |
 | [GetNRuns](classROOT_1_1RDF_1_1RInterface.html#adfb0562a9f7732c3afb123aefa07e0df) | Get the number of event loops run by this RDataFrame instance. |
+| [EnableProfiling](classROOT_1_1RDF_1_1RInterface.html) | Time the nodes of the computation graph on a sample of the entries of the next event loops, see GetProfileReport. |
 
 
 ## <a name="introduction"></a>Introduction
@@ -351,8 +353,8 @@ auto d15on = d.Range(15, 0);
 // We can specify a stride too, in this case we pick an event every 3
 auto d15each3 = d.Range(0, 15, 3);
 ~~~
-Note that ranges are not available when multi-threading is enabled. More information on ranges is available
-[here](#ranges).
+Note that when multi-threading is enabled, ranges can only be applied directly to the dataset. More information on
+ranges is available [here](#ranges).
 
 ### Executing multiple actions in the same event loop
 As a final example let us apply two different cuts on branch "MET" and fill two different histograms with the "pt\_v" of
@@ -757,8 +759,7 @@ Stats are stored in the same order as named filters have been added to the graph
 that has been run using the relevant `RDataFrame`.
 
 ### <a name="ranges"></a>Ranges
-When `RDataFrame` is not being used in a multi-thread environment (i.e. no call to `EnableImplicitMT` was made),
-`Range` transformations are available. These act very much like filters but instead of basing their decision on
+`Range` transformations act very much like filters but instead of basing their decision on
 a filter expression, they rely on `begin`,`end` and `stride` parameters.
 
 - `begin`: initial entry number considered for this range.
@@ -776,6 +777,17 @@ preceding filter*.
 Ranges allow "early quitting": if all branches of execution of a functional graph reached their `end` value of
 processed entries, the event-loop is immediately interrupted. This is useful for debugging and quick data explorations.
 
+In a multi-thread environment (i.e. after a call to `EnableImplicitMT`), ranges are supported provided that they are
+applied directly to the dataset (possibly after `Define`s), not after filters or other ranges: the entries selected by
+such ranges would depend on the number of entries accepted by the tasks that process the preceding entries. Every
+thread selects the entries of its own tasks based on their entry number in the dataset (for TTrees, in the whole
+TChain, or in its TEntryList if one is set), which gives the same result as the sequential event loop, with one
+exception: for data sources that skip entries (RDataSource::SetEntry returns false), the multi-thread range counts
+the skipped entries too, while the sequential range only counts the entries that the data source provides. If all branches
+of execution start with a range, the entries beyond the largest `end` are not processed at all: with TTrees, the
+clusters beyond it are not read. Note that multi-thread ranges on TTrees require the headers of all the files of the
+dataset to be opened before the event loop starts.
+
 ### <a name="custom-columns"></a> Custom columns
 Custom columns are created by invoking `Define(name, f, columnList)`. As usual, `f` can be any callable object
 (function, lambda expression, functor class...); it takes the values of the columns listed in `columnList` (a list of
@@ -812,6 +824,25 @@ first parameter is the slot number which ranges from 0 to ROOT::GetThreadPoolSiz
 - `DefineSlotEntry(name, f, columnList)`. In this case the callable f has this signature `R(unsigned int, ULong64_t,
 T1, T2, ...)`: the first parameter is the slot number while the second one the number of the entry being processed.
 
+### <a name="systematics"></a> Systematic variations
+`Vary(colName, f, columnList, tags)` registers variations of a column: `f` takes the values of the columns in
+`columnList` and returns an `RVec` with one varied value of `colName` per tag. The nominal values of the column are not
+changed. Calling `ROOT::RDF::Experimental::VariationsFor` on a result booked downstream returns the nominal result
+together with one result per tag, all produced by the same event loop:
+
+~~~{.cpp}
+auto h = df.Vary("pt", [](double pt) { return RVec<double>{0.9 * pt, 1.1 * pt}; }, {"pt"}, {"down", "up"})
+           .Filter([](double pt) { return pt > 10; }, {"pt"})
+           .Histo1D<double>("pt");
+auto hs = ROOT::RDF::Experimental::VariationsFor(h); // include ROOT/RDFHelpers.hxx
+hs["nominal"].Draw();
+hs["pt:down"].Draw("SAME");
+~~~
+
+Only the Defines, Filters and actions that depend on a varied column are cloned for each tag; the other nodes are
+evaluated once per entry for all variations, and so is `f`. Variations are supported by the Count, Fill/Histo, Min, Max,
+Sum and Mean actions, and require the affected expressions to be copyable.
+
 ##  <a name="actions"></a>Actions
 ### Instant and lazy actions
 Actions can be **instant** or **lazy**. Instant actions are executed as soon as they are called, while lazy actions are
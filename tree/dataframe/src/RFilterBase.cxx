@@ -9,7 +9,9 @@
  *************************************************************************/
 
 #include "ROOT/RDF/RCutFlowReport.hxx"
+#include "ROOT/RDF/RCustomColumnBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include <numeric> // std::accumulate
 
 using namespace ROOT::Detail::RDF;
@@ -47,3 +49,10 @@ void RFilterBase::InitNode()
    if (!fName.empty()) // if this is a named filter we care about its report count
       ResetReportCount();
 }
+
+void RFilterBase::SetProfiler(RDFInternal::RProfiler *profiler)
+{
+   fTimer = profiler ? profiler->GetTimer(this, "Filter", HasName() ? fName : "Filter") : nullptr;
+   for (auto &column : fCustomColumns.GetColumns())
+      column.second->SetProfiler(profiler);
+}
@@ -13,7 +13,10 @@
 #include "ROOT/RDF/RJittedAction.hxx"
 #include "TError.h"
 
+using ROOT::Internal::RDF::RActionBase;
 using ROOT::Internal::RDF::RJittedAction;
+using ROOT::Internal::RDF::RProfiler;
+using ROOT::Internal::RDF::RVariationInfo;
 using ROOT::Detail::RDF::RLoopManager;
 
 RJittedAction::RJittedAction(RLoopManager &lm) : RActionBase(&lm, {}, ROOT::Internal::RDF::RBookedCustomColumns{}) { }
@@ -60,6 +63,19 @@ void *RJittedAction::PartialUpdate(unsigned int slot)
    return fConcreteAction->PartialUpdate(slot);
 }
 
+const std::map<std::string, RVariationInfo> &RJittedAction::GetVariations()
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetVariations();
+}
+
+std::unique_ptr<RActionBase> RJittedAction::MakeVariedAction(const std::string &variation, std::size_t tagIdx,
+                                                             const std::shared_ptr<void> &newResult)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->MakeVariedAction(variation, tagIdx, newResult);
+}
+
 bool RJittedAction::HasRun() const
 {
    if (fConcreteAction != nullptr) {
@@ -82,6 +98,18 @@ void RJittedAction::ClearValueReaders(unsigned int slot)
    return fConcreteAction->ClearValueReaders(slot);
 }
 
+std::string RJittedAction::GetActionName()
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetActionName();
+}
+
+void RJittedAction::SetProfiler(RProfiler *profiler)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   fConcreteAction->SetProfiler(profiler);
+}
+
 std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> RJittedAction::GetGraph()
 {
    R__ASSERT(fConcreteAction != nullptr);
@@ -19,22 +19,16 @@ void RJittedCustomColumn::InitSlot(TTreeReader *r, unsigned int slot)
    fConcreteCustomColumn->InitSlot(r, slot);
 }
 
-void *RJittedCustomColumn::GetValuePtr(unsigned int slot)
-{
-   R__ASSERT(fConcreteCustomColumn != nullptr);
-   return fConcreteCustomColumn->GetValuePtr(slot);
-}
-
 const std::type_info &RJittedCustomColumn::GetTypeId() const
 {
    R__ASSERT(fConcreteCustomColumn != nullptr);
    return fConcreteCustomColumn->GetTypeId();
 }
 
-void RJittedCustomColumn::Update(unsigned int slot, Long64_t entry)
+void *RJittedCustomColumn::Update(unsigned int slot, Long64_t entry)
 {
    R__ASSERT(fConcreteCustomColumn != nullptr);
-   fConcreteCustomColumn->Update(slot, entry);
+   return fConcreteCustomColumn->Update(slot, entry);
 }
 
 void RJittedCustomColumn::ClearValueReaders(unsigned int slot)
@@ -42,3 +36,18 @@ void RJittedCustomColumn::ClearValueReaders(unsigned int slot)
    R__ASSERT(fConcreteCustomColumn != nullptr);
    fConcreteCustomColumn->ClearValueReaders(slot);
 }
+
+std::shared_ptr<RCustomColumnBase>
+RJittedCustomColumn::GetVariedColumn(const std::string &variation, std::size_t tagIdx)
+{
+   R__ASSERT(fConcreteCustomColumn != nullptr);
+   return fConcreteCustomColumn->GetVariedColumn(variation, tagIdx);
+}
+
+void RJittedCustomColumn::SetProfiler(RDFInternal::RProfiler *profiler)
+{
+   R__ASSERT(fConcreteCustomColumn != nullptr);
+   fConcreteCustomColumn->SetProfiler(profiler);
+   // share the timer of the concrete column, which is the one that measures the evaluations
+   fTimer = fConcreteCustomColumn->GetTimer();
+}
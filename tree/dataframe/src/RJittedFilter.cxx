@@ -21,6 +21,8 @@ RJittedFilter::RJittedFilter(RLoopManager *lm, std::string_view name)
 void RJittedFilter::SetFilter(std::unique_ptr<RFilterBase> f)
 {
    fConcreteFilter = std::move(f);
+   // The concrete filter is the one that represents this filter in the computation graph
+   fConcreteFilter->SetExpression(fExpression);
 }
 
 void RJittedFilter::InitSlot(TTreeReader *r, unsigned int slot)
@@ -118,3 +120,17 @@ std::shared_ptr<RDFGraphDrawing::GraphNode> RJittedFilter::GetGraph()
    }
    throw std::runtime_error("The Jitting should have been invoked before this method.");
 }
+
+std::shared_ptr<RNodeBase> RJittedFilter::GetVariedFilter(const std::string &variation, std::size_t tagIdx)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetVariedFilter(variation, tagIdx);
+}
+
+void RJittedFilter::SetProfiler(RDFInternal::RProfiler *profiler)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   fConcreteFilter->SetProfiler(profiler);
+   // share the timer of the concrete filter, which is the one that measures the evaluations
+   fTimer = fConcreteFilter->GetTimer();
+}
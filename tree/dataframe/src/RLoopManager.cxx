@@ -19,10 +19,13 @@
 #include "ROOT/TTreeProcessorMT.hxx"
 #endif
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <exception>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -265,12 +268,13 @@ void RLoopManager::RunEmptySourceMT()
 #ifdef R__USE_IMT
    RSlotStack slotStack(fNSlots);
    // Working with an empty tree.
-   // Evenly partition the entries according to fNSlots. Produce around 2 tasks per slot.
-   const auto nEntriesPerSlot = fNEmptyEntries / (fNSlots * 2);
-   auto remainder = fNEmptyEntries % (fNSlots * 2);
+   // Evenly partition the entries that are needed according to fNSlots. Produce around 2 tasks per slot.
+   const auto nEntries = std::min(fNEmptyEntries, fEntryBound);
+   const auto nEntriesPerSlot = nEntries / (fNSlots * 2);
+   auto remainder = nEntries % (fNSlots * 2);
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
    ULong64_t start = 0;
-   while (start < fNEmptyEntries) {
+   while (start < nEntries) {
       ULong64_t end = start + nEntriesPerSlot;
       if (remainder > 0) {
          ++end;
@@ -328,18 +332,28 @@ void RLoopManager::RunTreeProcessorMT()
    RSlotStack slotStack(fNSlots);
    const auto &entryList = fTree->GetEntryList() ? *fTree->GetEntryList() : TEntryList();
    auto tp = std::make_unique<ROOT::TTreeProcessorMT>(*fTree, entryList, fNSlots);
+   // ranges select the entries by their entry number in the whole dataset (see RRange::CheckFilters)
+   const bool hasEntryBasedRanges = std::any_of(fBookedRanges.begin(), fBookedRanges.end(),
+                                                [](RRangeBase *rangePtr) { return rangePtr->IsEntryBased(); });
+   tp->SetGlobalEntryNumbers(hasEntryBasedRanges);
 
    std::atomic<ULong64_t> entryCount(0ull);
 
-   tp->Process([this, &slotStack, &entryCount](TTreeReader &r) -> void {
+   tp->Process([this, &slotStack, &entryCount, hasEntryBasedRanges](TTreeReader &r) -> void {
+      const auto entryRange = r.GetEntriesRange(); // we trust TTreeProcessorMT to call SetEntriesRange
+      // tasks beyond the end of the ranges have nothing to process
+      if (hasEntryBasedRanges && static_cast<ULong64_t>(entryRange.first) >= fEntryBound)
+         return;
       auto slot = slotStack.GetSlot();
       InitNodeSlots(&r, slot);
-      const auto entryRange = r.GetEntriesRange(); // we trust TTreeProcessorMT to call SetEntriesRange
       const auto nEntries = entryRange.second - entryRange.first;
-      auto count = entryCount.fetch_add(nEntries);
+      ULong64_t count = hasEntryBasedRanges ? entryRange.first : entryCount.fetch_add(nEntries);
+      // the entries beyond the end of the ranges are not needed
+      const ULong64_t end = hasEntryBasedRanges ? std::min<ULong64_t>(entryRange.second, fEntryBound)
+                                                : std::numeric_limits<ULong64_t>::max();
       try {
          // recursive call to check filters and conditionally execute actions
-         while (r.Next()) {
+         while (count < end && r.Next()) {
             RunAndCheckFilters(slot, count++);
          }
       } catch (...) {
@@ -394,7 +408,12 @@ void RLoopManager::RunDataSource()
          for (const auto &range : ranges) {
             auto end = range.second;
             for (auto entry = range.first; entry < end; ++entry) {
-               if (fDataSource->SetEntry(0u, entry)) {
+               bool isGoodEntry;
+               {
+                  RDFInternal::RTimedScope timedScope(fEntryReadTimer, 0u);
+                  isGoodEntry = fDataSource->SetEntry(0u, entry);
+               }
+               if (isGoodEntry) {
                   RunAndCheckFilters(0u, entry);
                }
             }
@@ -421,13 +440,20 @@ void RLoopManager::RunDataSourceMT()
 
    // Each task works on a subrange of entries
    auto runOnRange = [this, &slotStack](const std::pair<ULong64_t, ULong64_t> &range) {
+      const auto end = std::min(range.second, fEntryBound);
+      if (range.first >= end)
+         return;
       const auto slot = slotStack.GetSlot();
       InitNodeSlots(nullptr, slot);
       fDataSource->InitSlot(slot, range.first);
-      const auto end = range.second;
       try {
          for (auto entry = range.first; entry < end; ++entry) {
-            if (fDataSource->SetEntry(slot, entry)) {
+            bool isGoodEntry;
+            {
+               RDFInternal::RTimedScope timedScope(fEntryReadTimer, slot);
+               isGoodEntry = fDataSource->SetEntry(slot, entry);
+            }
+            if (isGoodEntry) {
                RunAndCheckFilters(slot, entry);
             }
          }
@@ -461,6 +487,8 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       namedFilterPtr->CheckFilters(slot, entry);
    for (auto &callback : fCallbacks)
       callback(slot);
+   if (fProfiler)
+      fProfiler->NextEntry(slot);
 }
 
 /// Build TTreeReaderValues for all nodes
@@ -485,12 +513,21 @@ void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 void RLoopManager::InitNodes()
 {
    EvalChildrenCounts();
+   EvalEntryBound();
    for (auto &filter : fBookedFilters)
       filter->InitNode();
    for (auto &range : fBookedRanges)
       range->InitNode();
    for (auto &ptr : fBookedActions)
       ptr->Initialize();
+   if (fProfiler) {
+      for (auto &filter : fBookedFilters)
+         filter->SetProfiler(fProfiler.get());
+      for (auto &ptr : fBookedActions)
+         ptr->SetProfiler(fProfiler.get());
+      if (fDataSource)
+         fEntryReadTimer = fProfiler->GetTimer(fDataSource.get(), "Read", "data source entries");
+   }
 }
 
 /// Perform clean-up operations. To be called at the end of each event loop.
@@ -530,11 +567,16 @@ void RLoopManager::CleanUpTask(unsigned int slot)
 /// This method also clears the contents of GetCodeToJit().
 void RLoopManager::Jit()
 {
-   const std::string code = std::move(GetCodeToJit());
-   if (code.empty())
+   // check before moving: RunGraphs jits up front, then the event loops call Jit() concurrently on the empty code
+   if (GetCodeToJit().empty())
       return;
+   const std::string code = std::move(GetCodeToJit());
 
+   const auto start = std::chrono::steady_clock::now();
    RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+   const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+   // the code of the nodes of all computation graphs is compiled in one go
+   AddJitTime("Jit of all pending nodes", elapsed.count());
 }
 
 /// Trigger counting of number of children nodes for each node of the functional graph.
@@ -551,6 +593,26 @@ void RLoopManager::EvalChildrenCounts()
       namedFilterPtr->TriggerChildrenCount();
 }
 
+/// In multi-thread event loops, ranges are applied directly to the dataset and select entries by entry number.
+/// If every active branch of the computation graph starts with such a range, the entries beyond the largest range
+/// end are not needed and the event loop does not schedule them.
+void RLoopManager::EvalEntryBound()
+{
+   fEntryBound = std::numeric_limits<ULong64_t>::max();
+   unsigned int nBoundedRanges = 0;
+   ULong64_t bound = 0;
+   for (auto rangePtr : fBookedRanges) {
+      if (!rangePtr->IsEntryBased() || !rangePtr->HasChildren())
+         continue;
+      if (rangePtr->GetStop() == 0)
+         return;
+      ++nBoundedRanges;
+      bound = std::max<ULong64_t>(bound, rangePtr->GetStop());
+   }
+   if (nBoundedRanges > 0 && nBoundedRanges == fNChildren)
+      fEntryBound = bound;
+}
+
 /// Start the event loop with a different mechanism depending on IMT/no IMT, data source/no data source.
 /// Also perform a few setup and clean-up operations (jit actions if necessary, clear booked actions after the loop...).
 void RLoopManager::Run()
@@ -581,6 +643,12 @@ const ColumnNames_t &RLoopManager::GetDefaultColumnNames() const
    return fDefaultColumns;
 }
 
+bool RLoopManager::IsMultiThreaded() const
+{
+   return fLoopType == ELoopType::kNoFilesMT || fLoopType == ELoopType::kROOTFilesMT ||
+          fLoopType == ELoopType::kDataSourceMT;
+}
+
 TTree *RLoopManager::GetTree() const
 {
    return fTree.get();
@@ -648,6 +716,26 @@ void RLoopManager::RegisterCallback(ULong64_t everyNEvents, std::function<void(u
       fCallbacks.emplace_back(everyNEvents, std::move(f), fNSlots);
 }
 
+/// Time one entry every `samplingPeriod` in each processing slot, starting from the next event loop
+void RLoopManager::EnableProfiling(unsigned int samplingPeriod)
+{
+   if (samplingPeriod == 0u)
+      throw std::runtime_error("EnableProfiling: the sampling period must be greater than zero.");
+   if (fProfiler && fProfiler->GetSamplingPeriod() != samplingPeriod)
+      throw std::runtime_error("EnableProfiling: profiling is already enabled with a sampling period of " +
+                               std::to_string(fProfiler->GetSamplingPeriod()) + ".");
+   if (!fProfiler)
+      fProfiler = std::make_unique<RDFInternal::RProfiler>(fNSlots, samplingPeriod);
+}
+
+ROOT::RDF::RProfileReport RLoopManager::GetProfileReport() const
+{
+   if (!fProfiler)
+      throw std::runtime_error("GetProfileReport: profiling is not enabled, call EnableProfiling before the event "
+                               "loop runs.");
+   return fProfiler->GetReport();
+}
+
 std::vector<std::string> RLoopManager::GetFiltersNames()
 {
    std::vector<std::string> filters;
@@ -19,6 +19,7 @@
 
 #include <TError.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -67,27 +68,63 @@ bool RNTupleDS::SetEntry(unsigned int slot, ULong64_t entryIndex)
 
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
-   // TODO(jblomer): use cluster boundaries for the entry ranges
    std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
    if (fHasSeenAllRanges) return ranges;
+   fHasSeenAllRanges = true;
 
-   auto nEntries = fReaders[0]->GetNEntries();
-   const auto chunkSize = nEntries / fNSlots;
-   const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
-   auto start = 0UL;
-   auto end = 0UL;
-   for (auto i : ROOT::TSeqU(fNSlots)) {
-      start = end;
-      end += chunkSize;
-      ranges.emplace_back(start, end);
-      (void)i;
+   const auto &desc = fReaders[0]->GetDescriptor();
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> entryRanges;
+   if (fFilterFieldName.empty()) {
+      entryRanges.emplace_back(0, desc.GetNEntries());
+   } else {
+      auto fieldId = desc.FindFieldId(fFilterFieldName);
+      R__ASSERT(fieldId != kInvalidDescriptorId);
+      entryRanges = desc.FindEntryRanges(fieldId, fFilterMin, fFilterMax);
+   }
+
+   // Cut the entry ranges at the cluster boundaries, so that no cluster is shared between two tasks
+   std::vector<NTupleSize_t> clusterBoundaries;
+   for (DescriptorId_t i = 0; i < desc.GetNClusters(); ++i)
+      clusterBoundaries.emplace_back(desc.GetClusterDescriptor(i).GetFirstEntryIndex());
+   std::sort(clusterBoundaries.begin(), clusterBoundaries.end());
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> pieces;
+   NTupleSize_t nEntries = 0;
+   for (const auto &r : entryRanges) {
+      nEntries += r.second - r.first;
+      auto itrBoundary = std::upper_bound(clusterBoundaries.begin(), clusterBoundaries.end(), r.first);
+      auto start = r.first;
+      for (; (itrBoundary != clusterBoundaries.end()) && (*itrBoundary < r.second); ++itrBoundary) {
+         pieces.emplace_back(start, *itrBoundary);
+         start = *itrBoundary;
+      }
+      if (start < r.second)
+         pieces.emplace_back(start, r.second);
+   }
+
+   // Small neighboring clusters are grouped such that there are about kTasksPerSlot tasks per slot. The tasks are
+   // not bound to a particular slot; idle slots pick up the remaining tasks.
+   const NTupleSize_t taskSize = std::max(NTupleSize_t(1), nEntries / (fNSlots * kTasksPerSlot));
+   for (const auto &p : pieces) {
+      if (!ranges.empty() && (ranges.back().second == p.first) &&
+          (ranges.back().second - ranges.back().first + p.second - p.first <= taskSize))
+      {
+         ranges.back().second = p.second;
+         continue;
+      }
+      ranges.emplace_back(p.first, p.second);
    }
-   ranges.back().second += reminder;
-   fHasSeenAllRanges = true;
    return ranges;
 }
 
 
+void RNTupleDS::SetRangeFilter(std::string_view fieldName, double min, double max)
+{
+   fFilterFieldName = std::string(fieldName);
+   fFilterMin = min;
+   fFilterMax = max;
+}
+
+
 std::string RNTupleDS::GetTypeName(std::string_view colName) const
 {
    const auto index = std::distance(
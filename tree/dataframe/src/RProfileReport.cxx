@@ -0,0 +1,61 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RProfileReport.hxx"
+#include "TString.h" // Printf
+
+#include <algorithm>
+#include <numeric>
+
+namespace ROOT {
+
+namespace RDF {
+
+double RNodeProfile::GetTotalTime() const
+{
+   return std::accumulate(fTotalTimes.begin(), fTotalTimes.end(), 0.);
+}
+
+double RNodeProfile::GetSelfTime() const
+{
+   return std::accumulate(fSelfTimes.begin(), fSelfTimes.end(), 0.);
+}
+
+double RNodeProfile::GetTotalCpuTime() const
+{
+   return std::accumulate(fTotalCpuTimes.begin(), fTotalCpuTimes.end(), 0.);
+}
+
+double RNodeProfile::GetSelfCpuTime() const
+{
+   return std::accumulate(fSelfCpuTimes.begin(), fSelfCpuTimes.end(), 0.);
+}
+
+void RProfileReport::Print() const
+{
+   std::vector<const RNodeProfile *> sorted;
+   for (const auto &p : fProfiles)
+      sorted.emplace_back(&p);
+   std::stable_sort(sorted.begin(), sorted.end(),
+                    [](const RNodeProfile *p1, const RNodeProfile *p2) { return p1->GetSelfTime() > p2->GetSelfTime(); });
+   double allSelf = 0.;
+   for (const auto p : sorted)
+      allSelf += p->GetSelfTime();
+
+   Printf("%-6s  %-30s  %10s  %12s  %12s  %12s  %7s", "Kind", "Name", "Samples", "Self [s]", "Self CPU [s]",
+          "Total [s]", "Self %");
+   for (const auto p : sorted) {
+      const auto fraction = allSelf > 0. ? 100. * p->GetSelfTime() / allSelf : 0.;
+      Printf("%-6s  %-30s  %10llu  %12.4g  %12.4g  %12.4g  %6.2f%%", p->GetKind().c_str(), p->GetName().c_str(),
+             p->GetNSamples(), p->GetSelfTime(), p->GetSelfCpuTime(), p->GetTotalTime(), fraction);
+   }
+}
+
+} // End NS RDF
+
+} // End NS ROOT
@@ -0,0 +1,130 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RProfiler.hxx"
+#include "TError.h" // R__ASSERT
+
+#include <iomanip>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+double GetThreadCpuTime()
+{
+#ifdef _WIN32
+   FILETIME creation, exit, kernel, user;
+   if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+      return 0.;
+   // FILETIMEs count units of 100 ns
+   auto toSeconds = [](const FILETIME &t) {
+      return ((static_cast<ULong64_t>(t.dwHighDateTime) << 32) | t.dwLowDateTime) * 1e-7;
+   };
+   return toSeconds(kernel) + toSeconds(user);
+#else
+   timespec ts;
+   if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+      return 0.;
+   return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+bool RNodeTimer::IsSampled(unsigned int slot) const
+{
+   return fProfiler.IsSampled(slot);
+}
+
+RTimes RNodeTimer::StartScope(unsigned int slot)
+{
+   auto &nested = fProfiler.NestedTime(slot);
+   const auto outer = nested;
+   nested = RTimes();
+   return outer;
+}
+
+void RNodeTimer::EndScope(unsigned int slot, const RTimes &elapsed, const RTimes &outerNestedTime)
+{
+   auto &nested = fProfiler.NestedTime(slot);
+   auto &stats = fStats[slot];
+   ++stats.fNSamples;
+   stats.fTotalTime.fWall += elapsed.fWall;
+   stats.fTotalTime.fCpu += elapsed.fCpu;
+   stats.fSelfTime.fWall += elapsed.fWall - nested.fWall;
+   stats.fSelfTime.fCpu += elapsed.fCpu - nested.fCpu;
+   // for the enclosing scope, this whole scope is nested time
+   nested.fWall = outerNestedTime.fWall + elapsed.fWall;
+   nested.fCpu = outerNestedTime.fCpu + elapsed.fCpu;
+}
+
+ROOT::RDF::RNodeProfile RNodeTimer::GetProfile() const
+{
+   // one entry every GetSamplingPeriod() is timed: scale the sampled times to estimate those of all entries
+   const double scale = fProfiler.GetSamplingPeriod();
+   ULong64_t nSamples = 0;
+   std::vector<double> totalTimes;
+   std::vector<double> selfTimes;
+   std::vector<double> totalCpuTimes;
+   std::vector<double> selfCpuTimes;
+   for (const auto &stats : fStats) {
+      nSamples += stats.fNSamples;
+      totalTimes.emplace_back(stats.fTotalTime.fWall * scale);
+      selfTimes.emplace_back(stats.fSelfTime.fWall * scale);
+      totalCpuTimes.emplace_back(stats.fTotalTime.fCpu * scale);
+      selfCpuTimes.emplace_back(stats.fSelfTime.fCpu * scale);
+   }
+   return ROOT::RDF::RNodeProfile(fKind, fName, nSamples, std::move(totalTimes), std::move(selfTimes),
+                                  std::move(totalCpuTimes), std::move(selfCpuTimes));
+}
+
+std::string RNodeTimer::GetAnnotation() const
+{
+   const auto profile = GetProfile();
+   if (profile.GetNSamples() == 0)
+      return "";
+   std::stringstream ss;
+   ss << std::setprecision(3) << "\nself: " << profile.GetSelfTime() << " s (CPU " << profile.GetSelfCpuTime()
+      << " s)";
+   return ss.str();
+}
+
+RProfiler::RProfiler(unsigned int nSlots, unsigned int samplingPeriod)
+   : fNSlots(nSlots), fSamplingPeriod(samplingPeriod), fSlots(nSlots)
+{
+   R__ASSERT(samplingPeriod > 0 && "The sampling period must be strictly positive");
+}
+
+RNodeTimer *RProfiler::GetTimer(const void *node, const std::string &kind, const std::string &name)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   const auto key = std::make_pair(node, kind + ':' + name);
+   const auto it = fTimerIndices.find(key);
+   if (it != fTimerIndices.end())
+      return fTimers[it->second].get();
+   fTimerIndices.emplace(key, fTimers.size());
+   fTimers.emplace_back(new RNodeTimer(*this, kind, name, fNSlots));
+   return fTimers.back().get();
+}
+
+ROOT::RDF::RProfileReport RProfiler::GetReport() const
+{
+   ROOT::RDF::RProfileReport report;
+   for (const auto &timer : fTimers)
+      report.AddProfile(timer->GetProfile());
+   return report;
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
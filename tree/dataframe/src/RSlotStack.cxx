@@ -8,30 +8,60 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
-#include <ROOT/TSeq.hxx>
 #include <ROOT/RDF/RSlotStack.hxx>
 #include <TError.h> // R__ASSERT
 
-#include <mutex> // std::lock_guard
+namespace {
+/// The slot the current thread returned last, to any RSlotStack: all slot stacks hand out the slots of a RLoopManager
+thread_local unsigned int gPreferredSlot = 0u;
+} // anonymous namespace
 
-ROOT::Internal::RDF::RSlotStack::RSlotStack(unsigned int size) : fSize(size)
+ROOT::Internal::RDF::RSlotStack::RSlotStack(unsigned int size)
+   : fSize(size), fFreeSlots((size + kBitsPerWord - 1) / kBitsPerWord), fNFree(size)
 {
-   for (auto i : ROOT::TSeqU(size))
-      fStack.push(i);
+   for (auto i = 0u; i < fFreeSlots.size(); ++i) {
+      const auto nSlots = size - i * kBitsPerWord;
+      fFreeSlots[i] = nSlots >= kBitsPerWord ? ~Word_t(0) : (Word_t(1) << nSlots) - 1;
+   }
+}
+
+/// Mark `slot` as used, return false if it was not free
+bool ROOT::Internal::RDF::RSlotStack::TryAcquire(unsigned int slot)
+{
+   const auto mask = Word_t(1) << (slot % kBitsPerWord);
+   auto &word = fFreeSlots[slot / kBitsPerWord];
+   if (!(word.load(std::memory_order_relaxed) & mask))
+      return false;
+   return word.fetch_and(~mask, std::memory_order_acquire) & mask;
 }
 
 void ROOT::Internal::RDF::RSlotStack::ReturnSlot(unsigned int slot)
 {
-   std::lock_guard<ROOT::TSpinMutex> guard(fMutex);
-   R__ASSERT(fStack.size() < fSize && "Trying to put back a slot to a full stack!");
-   fStack.push(slot);
+   R__ASSERT(slot < fSize && "Trying to put back a slot that does not belong to this stack!");
+   const auto mask = Word_t(1) << (slot % kBitsPerWord);
+   const auto wasFree = fFreeSlots[slot / kBitsPerWord].fetch_or(mask, std::memory_order_release) & mask;
+   R__ASSERT(!wasFree && "Trying to put back a slot to a full stack!");
+   // the slot must be visible in the bitmask before other threads can reserve it
+   fNFree.fetch_add(1, std::memory_order_release);
+   gPreferredSlot = slot;
 }
 
 unsigned int ROOT::Internal::RDF::RSlotStack::GetSlot()
 {
-   std::lock_guard<ROOT::TSpinMutex> guard(fMutex);
-   R__ASSERT(!fStack.empty() && "Trying to pop a slot from an empty stack!");
-   const auto slot = fStack.top();
-   fStack.pop();
-   return slot;
+   // reserve one of the free slots, then look for it: it is guaranteed to be found, possibly after other threads
+   // complete a ReturnSlot
+   const auto nFree = fNFree.fetch_sub(1, std::memory_order_acquire);
+   R__ASSERT(nFree > 0 && "Trying to pop a slot from an empty stack!");
+
+   // threads start looking from their preferred slot, so that they spread over the bitmask when they do not get it
+   const auto first = gPreferredSlot < fSize ? gPreferredSlot : 0u;
+   while (true) {
+      for (auto i = 0u; i < fSize; ++i) {
+         const auto slot = (first + i) % fSize;
+         if (TryAcquire(slot)) {
+            gPreferredSlot = slot;
+            return slot;
+         }
+      }
+   }
 }
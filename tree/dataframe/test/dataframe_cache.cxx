@@ -346,3 +346,90 @@ TEST(Cache, Alias)
    auto df4 = df3.Cache({"y"});
    EXPECT_EQ(df4.Sum("y").GetValue(), 3u);
 }
+
+namespace {
+void RemoveDirectory(const std::string &dirName)
+{
+   if (auto dir = gSystem->OpenDirectory(dirName.c_str())) {
+      while (auto entry = gSystem->GetDirEntry(dir)) {
+         const std::string entryName(entry);
+         if (entryName != "." && entryName != "..")
+            gSystem->Unlink((dirName + "/" + entryName).c_str());
+      }
+      gSystem->FreeDirectory(dir);
+   }
+   gSystem->Unlink(dirName.c_str());
+}
+} // namespace
+
+TEST(Cache, Persistent)
+{
+   const std::string dirName = "dataframe_cache_persistent";
+   RemoveDirectory(dirName);
+   ROOT::RDF::RCacheOptions opts(dirName, "v1");
+   int nCalls = 0;
+   auto makeCache = [&nCalls, &opts]() {
+      ROOT::RDataFrame df(10);
+      return df
+         .Define("x",
+                 [&nCalls](ULong64_t e) {
+                    ++nCalls;
+                    return double(e);
+                 },
+                 {"rdfentry_"})
+         .Filter([](double x) { return x > 4; }, {"x"}, "x > 4")
+         .Cache({"x"}, opts);
+   };
+
+   auto c1 = makeCache();
+   EXPECT_EQ(nCalls, 10);
+   EXPECT_DOUBLE_EQ(*c1.Sum<double>("x"), 35.);
+
+   // the cache file is reused, the upstream computation graph does not run again
+   auto c2 = makeCache();
+   EXPECT_EQ(nCalls, 10);
+   EXPECT_DOUBLE_EQ(*c2.Sum<double>("x"), 35.);
+   EXPECT_EQ(*c2.Count(), 5u);
+
+   // a different key invalidates the cache
+   opts.fKey = "v2";
+   auto c3 = makeCache();
+   EXPECT_EQ(nCalls, 20);
+   EXPECT_DOUBLE_EQ(*c3.Sum<double>("x"), 35.);
+
+   RemoveDirectory(dirName);
+}
+
+TEST(Cache, PersistentJittedExpressions)
+{
+   const std::string dirName = "dataframe_cache_persistent_jitted";
+   RemoveDirectory(dirName);
+   ROOT::RDF::RCacheOptions opts(dirName);
+   auto makeCache = [&opts](const std::string &filter) {
+      ROOT::RDataFrame df(10);
+      return df.Define("x", "double(rdfentry_)").Filter(filter).Cache({"x"}, opts);
+   };
+
+   // the expressions are part of the cache key: the caches of the two filters do not collide
+   auto c1 = makeCache("x > 4");
+   EXPECT_EQ(*c1.Count(), 5u);
+   auto c2 = makeCache("x > 5");
+   EXPECT_EQ(*c2.Count(), 4u);
+   auto c3 = makeCache("x > 4");
+   EXPECT_EQ(*c3.Count(), 5u);
+
+   RemoveDirectory(dirName);
+}
+
+TEST(Cache, PersistentCallablesWithoutKey)
+{
+   const std::string dirName = "dataframe_cache_persistent_nokey";
+   RemoveDirectory(dirName);
+   ROOT::RDataFrame df(10);
+   auto filtered = df.Filter([](ULong64_t e) { return e > 4; }, {"rdfentry_"});
+   // the code of compiled callables cannot be hashed: an explicit key is required
+   EXPECT_THROW(filtered.Cache({"rdfentry_"}, ROOT::RDF::RCacheOptions(dirName)), std::runtime_error);
+   EXPECT_EQ(*filtered.Count(), 5u);
+
+   RemoveDirectory(dirName);
+}
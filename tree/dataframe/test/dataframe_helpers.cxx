@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <deque>
+#include <memory>
+#include <stdexcept>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -275,3 +277,72 @@ TEST(RDFHelpers, SaveGraphToFile)
 
    gSystem->Unlink(outFileName);
 }
+
+TEST(RDFHelpers, SaveGraphWithProfiling)
+{
+   ROOT::RDataFrame df(100);
+   df.EnableProfiling(1);
+   auto c = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+               .Filter([](double x) { return x > 10.; }, {"x"}, "myFilter")
+               .Count();
+
+   // Nothing was timed yet
+   auto strOut = SaveGraph(c);
+   EXPECT_EQ(std::string::npos, strOut.find("self:")) << strOut;
+
+   EXPECT_EQ(89ull, *c);
+   // The labels of the profiled nodes show their estimated self times
+   strOut = SaveGraph(c);
+   for (const auto label : {"\"Define\nx\nself: ", "\"myFilter\nself: ", "\"Count\nself: "})
+      EXPECT_NE(std::string::npos, strOut.find(label)) << label << " not in " << strOut;
+   EXPECT_NE(std::string::npos, strOut.find(" s (CPU ")) << strOut;
+
+   // Without profiling, the labels are the names of the nodes
+   ROOT::RDataFrame df2(100);
+   auto c2 = df2.Filter([](ULong64_t e) { return e > 10; }, {"rdfentry_"}, "myFilter").Count();
+   EXPECT_EQ(89ull, *c2);
+   strOut = SaveGraph(c2);
+   EXPECT_EQ(std::string::npos, strOut.find("self:")) << strOut;
+   EXPECT_NE(std::string::npos, strOut.find("[label=\"myFilter\", ")) << strOut;
+}
+
+TEST(RDFHelpers, RunGraphs)
+{
+   ROOT::RDataFrame df1(10);
+   auto c1 = df1.Count();
+   auto s1 = df1.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"}).Sum<double>("x");
+   ROOT::RDataFrame df2(20);
+   auto c2 = df2.Filter("rdfentry_ % 2 == 0").Count();
+
+   EXPECT_EQ(2u, RunGraphs({c1, s1, c2}));
+   EXPECT_EQ(1u, df1.GetNRuns());
+   EXPECT_EQ(1u, df2.GetNRuns());
+   EXPECT_EQ(10u, *c1);
+   EXPECT_DOUBLE_EQ(45., *s1);
+   EXPECT_EQ(10u, *c2);
+
+   // all results are ready, nothing to run
+   EXPECT_EQ(0u, RunGraphs({c1, c2}));
+}
+
+TEST(RDFHelpers, RunGraphsMT)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+   std::vector<RResultHandle> handles;
+   std::vector<RResultPtr<ULong64_t>> counts;
+   std::vector<std::unique_ptr<ROOT::RDataFrame>> dfs;
+   for (auto i = 1u; i <= 8u; ++i) {
+      dfs.emplace_back(new ROOT::RDataFrame(i * 100));
+      counts.emplace_back(dfs.back()->Filter("rdfentry_ >= 50").Count());
+      handles.emplace_back(counts.back());
+   }
+   EXPECT_EQ(8u, RunGraphs(handles));
+   for (auto i = 1u; i <= 8u; ++i) {
+      EXPECT_EQ(i * 100 - 50, *counts[i - 1]);
+      EXPECT_EQ(i * 100 - 50, handles[i - 1].GetValue<ULong64_t>());
+   }
+   EXPECT_THROW(handles[0].GetValue<double>(), std::runtime_error);
+   ROOT::DisableImplicitMT();
+#endif
+}
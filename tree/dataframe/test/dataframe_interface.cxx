@@ -1,9 +1,18 @@
 #include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
 #include "ROOT/RTrivialDS.hxx"
+#include "TInterpreter.h"
 #include "TMemFile.h"
 #include "TSystem.h"
 #include "TTree.h"
 
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 using namespace ROOT;
@@ -358,6 +367,154 @@ TEST(RDataFrameInterface, GetNSlots)
 #endif
 }
 
+TEST(RDataFrameInterface, GetJitTimes)
+{
+   ROOT::RDataFrame df(10);
+   EXPECT_TRUE(df.GetJitTimes().empty());
+   auto c = df.Define("x", "rdfentry_ * 2").Filter("x > 4", "xcut").Count();
+   const auto &times = df.GetJitTimes();
+   ASSERT_EQ(times.size(), 2u);
+   EXPECT_EQ(times[0].first, "Define x");
+   EXPECT_EQ(times[1].first, "Filter xcut");
+   EXPECT_EQ(*c, 7u);
+   ASSERT_EQ(times.size(), 3u);
+   for (const auto &t : times)
+      EXPECT_GE(t.second, 0.);
+}
+
+namespace {
+/// The first lines of the sources of the entries of a jit cache directory
+std::vector<std::string> GetJitCacheTags(const std::string &dirName)
+{
+   std::vector<std::string> tags;
+   if (auto dir = gSystem->OpenDirectory(dirName.c_str())) {
+      while (auto entry = gSystem->GetDirEntry(dir)) {
+         const TString entryName(entry);
+         if (!entryName.BeginsWith("rdfjit_") || !entryName.EndsWith(".C"))
+            continue;
+         std::ifstream source(dirName + "/" + entry);
+         std::string firstLine;
+         std::getline(source, firstLine);
+         tags.emplace_back(firstLine);
+      }
+      gSystem->FreeDirectory(dir);
+   }
+   return tags;
+}
+
+void RemoveJitCacheDirectory(const std::string &dirName)
+{
+   if (auto dir = gSystem->OpenDirectory(dirName.c_str())) {
+      while (auto entry = gSystem->GetDirEntry(dir)) {
+         const std::string entryName(entry);
+         if (entryName != "." && entryName != "..")
+            gSystem->Unlink((dirName + "/" + entryName).c_str());
+      }
+      gSystem->FreeDirectory(dir);
+   }
+   gSystem->Unlink(dirName.c_str());
+}
+} // namespace
+
+TEST(RDataFrameInterface, JitCache)
+{
+   const std::string dirName = "dataframe_interface_jitcache";
+   RemoveJitCacheDirectory(dirName);
+   ROOT::RDF::Experimental::SetJitCacheDirectory(dirName);
+
+   // first run: the expression is jitted and its library is built for later processes
+   ROOT::RDataFrame df(10);
+   EXPECT_EQ(*df.Define("x", "rdfentry_ * 3 + 1").Sum<ULong64_t>("x"), 145ull);
+   auto tags = GetJitCacheTags(dirName);
+   ASSERT_EQ(tags.size(), 1u);
+   EXPECT_EQ(tags[0].find("<not compilable>"), std::string::npos);
+   EXPECT_NE(tags[0].find("returns "), std::string::npos);
+
+   // second run, in another process: the library is loaded instead of jitting the expression
+   const std::string macroName = "dataframe_interface_jitcache_run.C";
+   {
+      std::ofstream macro(macroName);
+      macro << "void dataframe_interface_jitcache_run() {\n"
+            << "   ROOT::RDF::Experimental::SetJitCacheDirectory(\"" << dirName << "\");\n"
+            << "   ROOT::RDataFrame df(10);\n"
+            << "   auto s = df.Define(\"x\", \"rdfentry_ * 3 + 1\").Sum<ULong64_t>(\"x\");\n"
+            << "   const bool loaded = TString(gSystem->GetLibraries()).Contains(\"rdfjit_\");\n"
+            << "   gSystem->Exit(*s == 145 && loaded ? 0 : 1);\n"
+            << "}\n";
+   }
+   EXPECT_EQ(gSystem->Exec(("root.exe -l -b -q " + macroName).c_str()), 0);
+   gSystem->Unlink(macroName.c_str());
+   EXPECT_EQ(GetJitCacheTags(dirName).size(), 1u);
+
+   // expressions that only compile with the declarations of the interpreter are marked and always jitted
+   gInterpreter->Declare("ULong64_t JitCacheTestHelper(ULong64_t e) { return e * 5; }");
+   EXPECT_EQ(*df.Define("y", "JitCacheTestHelper(rdfentry_)").Sum<ULong64_t>("y"), 225ull);
+   tags = GetJitCacheTags(dirName);
+   ASSERT_EQ(tags.size(), 2u);
+   EXPECT_EQ(std::count_if(tags.begin(), tags.end(),
+                           [](const std::string &tag) { return tag.find("<not compilable>") != std::string::npos; }),
+             1);
+
+   ROOT::RDF::Experimental::SetJitCacheDirectory("");
+   RemoveJitCacheDirectory(dirName);
+}
+
+TEST(RDataFrameInterface, Profiling)
+{
+   ROOT::RDataFrame df(100);
+   EXPECT_THROW(df.GetProfileReport(), std::runtime_error);
+   EXPECT_THROW(df.EnableProfiling(0), std::runtime_error);
+   df.EnableProfiling(1);
+   auto dfx = df.Define("x", "rdfentry_ * 2").Filter([](ULong64_t x) { return x > 4; }, {"x"}, "xcut");
+   auto s = dfx.Sum<ULong64_t>("x");
+   EXPECT_EQ(*s, 9894u);
+
+   const auto report = df.GetProfileReport();
+   std::set<std::string> kinds;
+   for (const auto &profile : report) {
+      kinds.insert(profile.GetKind());
+      EXPECT_GT(profile.GetNSamples(), 0u);
+      EXPECT_GE(profile.GetTotalTime(), profile.GetSelfTime());
+      EXPECT_GE(profile.GetTotalCpuTime(), profile.GetSelfCpuTime());
+      EXPECT_EQ(profile.GetSelfTimePerSlot().size(), df.GetNSlots());
+      EXPECT_EQ(profile.GetSelfCpuTimePerSlot().size(), df.GetNSlots());
+   }
+   EXPECT_EQ(kinds, (std::set<std::string>{"Action", "Define", "Filter"}));
+   // the timings are only part of the report, not of the graph
+   EXPECT_EQ(ROOT::RDF::SaveGraph(dfx).find("self: "), std::string::npos);
+}
+
+TEST(RDataFrameInterface, ProfilingTree)
+{
+   TTree t("t", "t");
+   int x = 0;
+   float y = 0.f;
+   t.Branch("x", &x);
+   t.Branch("y", &y);
+   for (int i = 0; i < 100; ++i) {
+      x = i;
+      y = 0.5f * i;
+      t.Fill();
+   }
+
+   ROOT::RDataFrame df(t);
+   df.EnableProfiling(1);
+   auto m = df.Filter([](int xx) { return xx % 2 == 0; }, {"x"}).Max<float>("y");
+   EXPECT_FLOAT_EQ(*m, 49.f);
+
+   // the reads of each column of the tree are timed separately, and not counted in the self time of the nodes
+   std::map<std::string, ULong64_t> readSamples;
+   for (const auto &profile : df.GetProfileReport()) {
+      if (profile.GetKind() == "Read") {
+         readSamples[profile.GetName()] = profile.GetNSamples();
+         EXPECT_DOUBLE_EQ(profile.GetTotalTime(), profile.GetSelfTime());
+      }
+   }
+   ASSERT_EQ(readSamples.size(), 2u);
+   EXPECT_EQ(readSamples["x"], 100u);
+   EXPECT_EQ(readSamples["y"], 50u);
+}
+
 // ROOT-10043
 TEST(RDataFrameInterface, DefineAliasedColumn)
 {
@@ -3,6 +3,7 @@
 #include <TStatistic.h> // To check reading of columns with types which are mothers of the column type
 #include <TSystem.h>
 
+#include <atomic>
 #include <mutex>
 #include <thread>
 #include <stdexcept> // std::runtime_error
@@ -42,6 +43,42 @@ TEST(RDataFrameNodes, RSlotStackPutBackTooMany)
 
 #endif
 
+TEST(RDataFrameNodes, RSlotStackAffinity)
+{
+   ROOT::Internal::RDF::RSlotStack s(3);
+   const auto slot1 = s.GetSlot();
+   const auto slot2 = s.GetSlot();
+   EXPECT_NE(slot1, slot2);
+   s.ReturnSlot(slot1);
+   s.ReturnSlot(slot2);
+   // the thread gets back the slot it returned last
+   EXPECT_EQ(s.GetSlot(), slot2);
+}
+
+TEST(RDataFrameNodes, RSlotStackConcurrentUse)
+{
+   const unsigned int nSlots = 70; // more than one word of the bitmask
+   ROOT::Internal::RDF::RSlotStack s(nSlots);
+   std::vector<std::atomic<int>> nUsers(nSlots);
+   std::atomic<bool> sharedSlot(false);
+
+   std::vector<std::thread> ts;
+   for (auto i = 0u; i < nSlots; ++i) {
+      ts.emplace_back([&]() {
+         for (auto n = 0; n < 1000; ++n) {
+            const auto slot = s.GetSlot();
+            if (++nUsers[slot] != 1)
+               sharedSlot = true;
+            --nUsers[slot];
+            s.ReturnSlot(slot);
+         }
+      });
+   }
+   for (auto &&t : ts)
+      t.join();
+   EXPECT_FALSE(sharedSlot);
+}
+
 TEST(RDataFrameNodes, RLoopManagerGetLoopManagerUnchecked)
 {
    ROOT::Detail::RDF::RLoopManager lm(nullptr, {});
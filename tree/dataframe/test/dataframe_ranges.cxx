@@ -1,5 +1,14 @@
 #include "ROOT/RDataFrame.hxx"
+#include <TChain.h>
+#include <TFile.h>
 #include <TROOT.h>
+#include <TSystem.h>
+#include <TTree.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -97,12 +106,112 @@ TEST(RDFRangesMT, ThrowIfIMT)
    ROOT::EnableImplicitMT();
    RDataFrame d(0);
    try {
-      d.Range(0);
+      d.Filter([] { return true; }).Range(0);
    } catch (const std::exception &e) {
       hasThrown = true;
-      EXPECT_STREQ(e.what(), "Range was called with ImplicitMT enabled, but multi-thread is not supported.");
+      EXPECT_STREQ(e.what(), "Range was called with ImplicitMT enabled after a Filter or a Range, but multi-thread "
+                             "ranges can only be applied directly to the dataset.");
    }
    EXPECT_TRUE(hasThrown);
+   ROOT::DisableImplicitMT();
+}
+
+TEST(RDFRangesMT, SameAsSequential)
+{
+   auto getEntries = [] {
+      RDataFrame d(1000);
+      auto entries = d.Range(15, 700, 3).Take<ULong64_t>("tdfentry_");
+      std::sort(entries->begin(), entries->end());
+      return *entries;
+   };
+   const auto seqEntries = getEntries();
+   ROOT::EnableImplicitMT(4);
+   const auto mtEntries = getEntries();
+   ROOT::DisableImplicitMT();
+   EXPECT_EQ(228u, seqEntries.size());
+   EXPECT_EQ(seqEntries, mtEntries);
+}
+
+TEST(RDFRangesMT, EarlyStop)
+{
+   ROOT::EnableImplicitMT(4);
+   RDataFrame d(1000000);
+   std::atomic<ULong64_t> nEntries(0ull);
+   auto c = d.Range(100).Count();
+   c.OnPartialResultSlot(1, [&nEntries](unsigned int, ULong64_t &) { ++nEntries; });
+   EXPECT_EQ(100u, *c);
+   // only the entries of the range are processed
+   EXPECT_EQ(100u, nEntries);
+   ROOT::DisableImplicitMT();
+}
+
+// the entries of the files of a chain are numbered by the tasks as in the sequential event loop
+TEST(RDFRangesMT, TChain)
+{
+   const std::vector<std::string> fileNames{"dataframe_ranges_mt_0.root", "dataframe_ranges_mt_1.root"};
+   int x = 0;
+   for (const auto &fileName : fileNames) {
+      TFile f(fileName.c_str(), "RECREATE");
+      TTree t("t", "t");
+      // several clusters, i.e. several tasks, per file
+      t.SetAutoFlush(100);
+      t.Branch("x", &x);
+      for (auto i = 0; i < 1000; ++i, ++x)
+         t.Fill();
+      t.Write();
+   }
+
+   auto getValues = [&fileNames](unsigned int begin, unsigned int end, unsigned int stride) {
+      TChain c("t");
+      for (const auto &fileName : fileNames)
+         c.Add(fileName.c_str());
+      RDataFrame d(c);
+      auto values = d.Range(begin, end, stride).Take<int>("x");
+      std::sort(values->begin(), values->end());
+      return *values;
+   };
+   const auto seqValues = getValues(15, 1700, 3);
+   const auto seqBeginValues = getValues(0, 150, 1);
+   ROOT::EnableImplicitMT(4);
+   const auto mtValues = getValues(15, 1700, 3);
+   const auto mtBeginValues = getValues(0, 150, 1);
+   ROOT::DisableImplicitMT();
+   EXPECT_EQ(561u, seqValues.size());
+   EXPECT_EQ(seqValues, mtValues);
+   EXPECT_EQ(150u, seqBeginValues.size());
+   EXPECT_EQ(seqBeginValues, mtBeginValues);
+
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+}
+
+TEST(RDFRangesMT, TTreeEarlyStop)
+{
+   const auto fileName = "dataframe_ranges_mt_earlystop.root";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(100);
+      int x = 0;
+      t.Branch("x", &x);
+      for (; x < 10000; ++x)
+         t.Fill();
+      t.Write();
+   }
+
+   ROOT::EnableImplicitMT(4);
+   {
+      RDataFrame d("t", fileName);
+      std::atomic<ULong64_t> nEntries(0ull);
+      auto m = d.Range(150).Max<int>("x");
+      m.OnPartialResultSlot(1, [&nEntries](unsigned int, int &) { ++nEntries; });
+      EXPECT_EQ(149, *m);
+      // only the entries of the range are processed
+      EXPECT_EQ(150u, nEntries);
+   }
+   ROOT::DisableImplicitMT();
+
+   gSystem->Unlink(fileName);
 }
 #endif
 
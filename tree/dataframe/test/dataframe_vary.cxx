@@ -0,0 +1,118 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
+#include "ROOT/RVec.hxx"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace ROOT;
+using namespace ROOT::RDF::Experimental;
+using ROOT::VecOps::RVec;
+
+namespace {
+RDF::RNode MakeVariedDF(RDataFrame &df)
+{
+   return df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+      .Vary("x", [](double x) { return RVec<double>{x - 1, x + 1}; }, {"x"}, {"down", "up"});
+}
+} // namespace
+
+TEST(RDFVary, DefineFilterSum)
+{
+   RDataFrame df(10);
+   auto sum = MakeVariedDF(df)
+                 .Define("y", [](double x) { return 2 * x; }, {"x"})
+                 .Filter([](double y) { return y > 5; }, {"y"})
+                 .Sum<double>("y");
+   auto sums = VariationsFor(sum);
+   EXPECT_EQ(sums.GetKeys(), std::vector<std::string>({"nominal", "x:down", "x:up"}));
+   EXPECT_DOUBLE_EQ(sums["nominal"], 84.);
+   EXPECT_DOUBLE_EQ(sums["x:down"], 66.);
+   EXPECT_DOUBLE_EQ(sums["x:up"], 104.);
+   EXPECT_DOUBLE_EQ(*sum, 84.);
+   EXPECT_EQ(df.GetNRuns(), 1u);
+   EXPECT_THROW(sums["x:sideways"], std::runtime_error);
+}
+
+TEST(RDFVary, SharedNodesRunOnce)
+{
+   std::atomic<int> nFilterCalls(0);
+   std::atomic<int> nVaryCalls(0);
+   RDataFrame df(100);
+   auto c = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+               .Filter(
+                  [&nFilterCalls](double x) {
+                     ++nFilterCalls;
+                     return x < 50;
+                  },
+                  {"x"})
+               .Vary("x",
+                     [&nVaryCalls](double x) {
+                        ++nVaryCalls;
+                        return RVec<double>{x - 10, x, x + 10};
+                     },
+                     {"x"}, 3, "shift")
+               .Filter([](double x) { return x >= 20; }, {"x"})
+               .Count();
+   auto counts = VariationsFor(c);
+   EXPECT_EQ(counts.GetKeys(), std::vector<std::string>({"nominal", "shift:0", "shift:1", "shift:2"}));
+   EXPECT_EQ(counts["nominal"], 30u);
+   EXPECT_EQ(counts["shift:0"], 20u);
+   EXPECT_EQ(counts["shift:1"], 30u);
+   EXPECT_EQ(counts["shift:2"], 40u);
+   // the filter upstream of the variation and the variation itself are evaluated once per entry
+   EXPECT_EQ(nFilterCalls, 100);
+   EXPECT_EQ(nVaryCalls, 50);
+}
+
+TEST(RDFVary, Histo1D)
+{
+   RDataFrame df(10);
+   auto h = MakeVariedDF(df).Histo1D<double>({"h", "h", 12, -1, 11}, "x");
+   auto hs = VariationsFor(h);
+   EXPECT_EQ(hs.size(), 3u);
+   EXPECT_DOUBLE_EQ(hs["nominal"].GetMean(), 4.5);
+   EXPECT_DOUBLE_EQ(hs["x:down"].GetMean(), 3.5);
+   EXPECT_DOUBLE_EQ(hs["x:up"].GetMean(), 5.5);
+   EXPECT_EQ(hs["x:up"].GetEntries(), 10);
+}
+
+TEST(RDFVary, UnaffectedResult)
+{
+   RDataFrame df(10);
+   auto c = MakeVariedDF(df).Filter([](ULong64_t e) { return e % 2 == 0; }, {"rdfentry_"}).Count();
+   auto counts = VariationsFor(c);
+   EXPECT_EQ(counts.GetKeys(), std::vector<std::string>({"nominal"}));
+   EXPECT_EQ(counts["nominal"], 5u);
+}
+
+TEST(RDFVary, Errors)
+{
+   RDataFrame df(10);
+   auto varied = MakeVariedDF(df);
+   // duplicate variation name
+   EXPECT_THROW(varied.Vary("x", [](double x) { return RVec<double>{x}; }, {"x"}, {"other"}), std::runtime_error);
+   // no tags
+   EXPECT_THROW(varied.Vary("x", [](double x) { return RVec<double>{x}; }, {"x"}, 0, "none"), std::runtime_error);
+   // action that does not support variations
+   auto t = varied.Take<double>("x");
+   EXPECT_THROW(VariationsFor(t), std::runtime_error);
+   // varied results must be booked before the event loop
+   auto m = varied.Max<double>("x");
+   EXPECT_DOUBLE_EQ(*m, 9.);
+   EXPECT_THROW(VariationsFor(m), std::runtime_error);
+}
+
+TEST(RDFVary, WrongNumberOfValues)
+{
+   RDataFrame df(1);
+   auto s = df.Define("x", [] { return 1.; })
+               .Vary("x", [](double x) { return RVec<double>{x}; }, {"x"}, {"down", "up"})
+               .Sum<double>("x");
+   auto sums = VariationsFor(s);
+   EXPECT_THROW(sums["x:up"], std::runtime_error);
+}
@@ -0,0 +1,168 @@
+/// \file ROOT/RCluster.hxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RCluster
+#define ROOT7_RCluster
+
+#include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPage.hxx>
+#include <ROOT/RPageAllocator.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+// clang-format off
+/**
+\class ROnDiskPage
+\ingroup NTuple
+\brief A page as being stored on disk, that is packed and compressed
+
+Used by the cluster pool to cache pages from the physical storage. Such pages generally need to be
+uncompressed and unpacked before they can be used by RNTuple upper layers.
+*/
+// clang-format on
+class ROnDiskPage {
+private:
+   /// The memory location of the bytes
+   const void *fAddress = nullptr;
+   /// The compressed and packed size of the page
+   std::size_t fSize = 0;
+
+public:
+   /// On-disk pages within a page source are identified by the column and page number. The key is used for
+   /// associative collections of on-disk pages.
+   struct Key {
+      DescriptorId_t fColumnId;
+      NTupleSize_t fPageNo;
+      Key(DescriptorId_t columnId, NTupleSize_t pageNo) : fColumnId(columnId), fPageNo(pageNo) {}
+      friend bool operator ==(const Key &lhs, const Key &rhs) {
+         return lhs.fColumnId == rhs.fColumnId && lhs.fPageNo == rhs.fPageNo;
+      }
+   };
+
+   ROnDiskPage() = default;
+   ROnDiskPage(const void *address, std::size_t size) : fAddress(address), fSize(size) {}
+
+   const void *GetAddress() const { return fAddress; }
+   std::size_t GetSize() const { return fSize; }
+
+   bool IsNull() const { return fAddress == nullptr; }
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+// For hash maps ROnDiskPage::Key --> ROnDiskPage
+namespace std
+{
+   template <>
+   struct hash<ROOT::Experimental::Detail::ROnDiskPage::Key>
+   {
+      // Combines the hashes of the column id and of the page number (as boost::hash_combine does), such that keys
+      // with swapped or neighboring column ids and page numbers do not collide
+      size_t operator()(const ROOT::Experimental::Detail::ROnDiskPage::Key &key) const
+      {
+         size_t seed = std::hash<ROOT::Experimental::DescriptorId_t>()(key.fColumnId);
+         seed ^= std::hash<ROOT::Experimental::NTupleSize_t>()(key.fPageNo) + 0x9e3779b97f4a7c15ULL + (seed << 6) +
+                 (seed >> 2);
+         return seed;
+      }
+   };
+}
+
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RCluster
+\ingroup NTuple
+\brief An in-memory subset of the packed and compressed pages of a cluster
+
+Binds together several page maps that represent all the pages of certain columns of a cluster. The cluster owns
+the memory blocks that the on-disk pages point into; such blocks are usually filled by a few large vector reads
+from the storage. Clusters are created by the page sources and managed by the cluster pool.
+
+Optionally, the page source can attach decompressed and unpacked pages to the cluster (see RPageSource::UnzipCluster).
+Such pages are owned by the cluster until they are taken by the page source; unused pages are freed together with
+the cluster.
+*/
+// clang-format on
+class RCluster {
+public:
+   using ColumnSet_t = std::unordered_set<DescriptorId_t>;
+
+private:
+   /// References the cluster identifier in the page source that created the cluster
+   DescriptorId_t fClusterId;
+   /// The memory blocks that back the on-disk pages
+   std::vector<std::unique_ptr<unsigned char[]>> fMemoryBlocks;
+   /// The set of columns fully contained in this cluster
+   ColumnSet_t fAvailColumns;
+   /// Lookup table for the on-disk pages
+   std::unordered_map<ROnDiskPage::Key, ROnDiskPage> fOnDiskPages;
+   /// Pages that are ready to be used, together with the deleter that frees them if they are never taken
+   std::unordered_map<ROnDiskPage::Key, std::pair<RPage, RPageDeleter>> fUnzippedPages;
+
+public:
+   explicit RCluster(DescriptorId_t clusterId) : fClusterId(clusterId) {}
+   RCluster(const RCluster &other) = delete;
+   RCluster(RCluster &&other) = delete;
+   RCluster &operator =(const RCluster &other) = delete;
+   RCluster &operator =(RCluster &&other) = delete;
+   ~RCluster();
+
+   /// Takes ownership of a memory block into which on-disk pages registered by Register() point
+   void AdoptMemory(std::unique_ptr<unsigned char[]> memory) { fMemoryBlocks.emplace_back(std::move(memory)); }
+   /// Used by the page source to add a page that points into one of the adopted memory blocks
+   void Register(const ROnDiskPage::Key &key, const ROnDiskPage &onDiskPage) { fOnDiskPages.emplace(key, onDiskPage); }
+   /// Marks the column as complete; must be called after all the pages of the column have been registered
+   void SetColumnAvailable(DescriptorId_t columnId) { fAvailColumns.insert(columnId); }
+   /// Takes ownership of a decompressed and unpacked page; the deleter is used if the page is never taken
+   void AdoptUnzippedPage(const ROnDiskPage::Key &key, const RPage &page, const RPageDeleter &deleter);
+   /// Move the memory blocks, the on-disk pages, and the unzipped pages of other into this cluster. Both clusters
+   /// need to describe the same cluster id.
+   void Adopt(RCluster &&other);
+
+   /// Returns nullptr if the page is not part of the cluster
+   const ROnDiskPage *GetOnDiskPage(const ROnDiskPage::Key &key) const;
+   /// Removes the unzipped page from the cluster and passes its ownership to the caller. Returns a null page if
+   /// there is no unzipped page for the given key, in which case the on-disk page needs to be used.
+   RPage TakeUnzippedPage(const ROnDiskPage::Key &key);
+
+   DescriptorId_t GetId() const { return fClusterId; }
+   const ColumnSet_t &GetAvailColumns() const { return fAvailColumns; }
+   bool ContainsColumn(DescriptorId_t columnId) const { return fAvailColumns.count(columnId) > 0; }
+   std::size_t GetNOnDiskPages() const { return fOnDiskPages.size(); }
+   std::size_t GetNUnzippedPages() const { return fUnzippedPages.size(); }
+};
+
+} // namespace Detail
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,131 @@
+/// \file ROOT/RClusterPool.hxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RClusterPool
+#define ROOT7_RClusterPool
+
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RNTupleUtil.hxx>
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+class RPageSource;
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RClusterPool
+\ingroup NTuple
+\brief Manages a set of clusters containing compressed and packed pages
+
+The cluster pool steers the preloading of (partial) clusters. There is a two-step pipeline: in a first step,
+compressed pages are read from clusters into a memory buffer. In the second step, the page source decompresses and
+unpacks the pages as parallel tasks (RPageSource::UnzipCluster()), provided that it has a task scheduler. On request
+of a cluster, the pool makes sure that the given cluster as well as a window of look-ahead clusters is either in
+memory or scheduled to be loaded. Loading is done by a background I/O thread that calls RPageSource::LoadCluster(),
+which typically issues a few large vector reads per cluster, followed by RPageSource::UnzipCluster().
+
+The cluster pool only keeps clusters in the window [active - fWindowPre, active + fWindowPost). Clusters outside
+this window are evicted on the next request.
+*/
+// clang-format on
+class RClusterPool {
+private:
+   /// Request to load a subset of the columns of a particular cluster. Work items come in groups and are executed
+   /// by the page source.
+   struct RReadItem {
+      std::promise<std::unique_ptr<RCluster>> fPromise;
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      RCluster::ColumnSet_t fColumns;
+   };
+
+   /// Clusters that are currently being processed by the I/O thread.  Every in-flight cluster has a corresponding
+   /// work item, first in the read queue and then as the return value of the read pipeline step.
+   struct RInFlightCluster {
+      std::future<std::unique_ptr<RCluster>> fFuture;
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      RCluster::ColumnSet_t fColumns;
+   };
+
+   /// Every cluster pool is responsible for exactly one page source that triggers loading of the clusters
+   /// (GetCluster()) and is used for implementing the I/O and cluster memory allocation (LoadCluster()).
+   RPageSource &fPageSource;
+   /// The number of clusters before the currently active cluster that should stay in the pool if present
+   unsigned int fWindowPre;
+   /// The number of desired clusters in the pool, including the currently active cluster
+   unsigned int fWindowPost;
+   /// The cache of clusters in memory
+   std::vector<std::unique_ptr<RCluster>> fPool;
+   /// The clusters that were handed off to the I/O thread
+   std::vector<RInFlightCluster> fInFlightClusters;
+   /// Protects the shared state between the main thread and the I/O thread
+   std::mutex fLockWorkQueue;
+   /// Signals a non-empty I/O work queue
+   std::condition_variable fCvHasReadWork;
+   /// The communication channel to the I/O thread; an item with an invalid cluster id terminates the thread
+   std::deque<RReadItem> fReadQueue;
+   /// The I/O thread calls RPageSource::LoadCluster() and RPageSource::UnzipCluster() asynchronously
+   std::thread fThreadIo;
+
+   RNTupleMetrics fMetrics;
+   /// The requested cluster was fully present in the pool
+   RNTupleAtomicCounter *fCtrNClusterHit = nullptr;
+   /// The requested cluster (or some of its columns) had to be waited for
+   RNTupleAtomicCounter *fCtrNClusterMiss = nullptr;
+   /// Clusters that were removed from the pool before or after being used
+   RNTupleAtomicCounter *fCtrNClusterEvicted = nullptr;
+   /// Wall time that the caller of GetCluster() was blocked by outstanding I/O
+   RNTupleAtomicCounter *fCtrTimeWaitIo = nullptr;
+
+   /// Returns the position of the given cluster in fPool or -1 if the cluster is not in the pool
+   int FindInPool(DescriptorId_t clusterId) const;
+   /// Moves the loaded cluster into the pool, merging its columns with an existing entry of the same id
+   void MergeIntoPool(std::unique_ptr<RCluster> cluster);
+   /// The I/O thread routine, there is exactly one I/O thread in-flight for every cluster pool
+   void ExecReadClusters();
+
+public:
+   /// The look-ahead is the number of clusters following the active one that are scheduled to be read
+   /// in the background
+   RClusterPool(RPageSource &pageSource, unsigned int lookAhead);
+   RClusterPool(const RClusterPool &other) = delete;
+   RClusterPool &operator =(const RClusterPool &other) = delete;
+   ~RClusterPool();
+
+   unsigned int GetWindowPre() const { return fWindowPre; }
+   unsigned int GetWindowPost() const { return fWindowPost; }
+
+   /// Returns the requested cluster either from the pool or, in case of a cache miss, lets the I/O thread load
+   /// the cluster and waits for it to be ready.  Triggers loading of the look-ahead window and evicts clusters
+   /// outside the window.  The returned pointer is valid until the next call to GetCluster().
+   RCluster *GetCluster(DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns);
+
+   RNTupleMetrics &GetMetrics() { return fMetrics; }
+};
+
+} // namespace Detail
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
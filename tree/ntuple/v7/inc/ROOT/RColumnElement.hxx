@@ -21,8 +21,11 @@
 
 #include <TError.h>
 
+#include <cmath>
 #include <cstring> // for memcpy
 #include <cstdint>
+#include <limits>
+#include <memory>
 #include <type_traits>
 
 namespace ROOT {
@@ -68,7 +71,9 @@ public:
    RColumnElementBase& operator =(RColumnElementBase&& other) = default;
    virtual ~RColumnElementBase() = default;
 
-   static RColumnElementBase Generate(EColumnType type);
+   /// Creates a column element of the default C++ type for the given column type; the element does not point to any
+   /// content but it can be used to pack and unpack pages of the given column type
+   static std::unique_ptr<RColumnElementBase> Generate(EColumnType type);
 
    /// Write one or multiple column elements into destination
    void WriteTo(void *destination, std::size_t count) const {
@@ -96,10 +101,39 @@ public:
       std::memcpy(destination, source, count);
    }
 
+   /// Numerical column elements compute the smallest and the largest value of an array of in-memory elements, used
+   /// for the column statistics. Returns false for column elements without a meaningful value range.
+   virtual bool GetValueRange(const void * /*source*/, std::size_t /*count*/, double * /*min*/, double * /*max*/) const
+   {
+      return false;
+   }
+
    void *GetRawContent() const { return fRawContent; }
    std::size_t GetSize() const { return fSize; }
 };
 
+/// Implements GetValueRange() for the numerical column elements. NaN values are ignored. The result is rounded
+/// outwards if CppT has more digits than double, so that the range always covers all the values.
+template <typename CppT>
+bool GetValueRangeImpl(const void *source, std::size_t count, double *min, double *max)
+{
+   auto values = static_cast<const CppT *>(source);
+   double lo = std::numeric_limits<double>::infinity();
+   double hi = -std::numeric_limits<double>::infinity();
+   for (std::size_t i = 0; i < count; ++i) {
+      const double v = static_cast<double>(values[i]);
+      lo = (v < lo) ? v : lo;
+      hi = (v > hi) ? v : hi;
+   }
+   if (std::numeric_limits<CppT>::digits > std::numeric_limits<double>::digits) {
+      lo = std::nextafter(lo, -std::numeric_limits<double>::infinity());
+      hi = std::nextafter(hi, std::numeric_limits<double>::infinity());
+   }
+   *min = lo;
+   *max = hi;
+   return true;
+}
+
 /**
  * Pairs of C++ type and column type, like float and EColumnType::kReal32
  */
@@ -124,6 +158,9 @@ public:
    explicit RColumnElement(float *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double *min, double *max) const final {
+      return GetValueRangeImpl<float>(source, count, min, max);
+   }
 };
 
 template <>
@@ -135,6 +172,9 @@ public:
    explicit RColumnElement(double *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double *min, double *max) const final {
+      return GetValueRangeImpl<double>(source, count, min, max);
+   }
 };
 
 template <>
@@ -146,6 +186,9 @@ public:
    explicit RColumnElement(std::uint8_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double *min, double *max) const final {
+      return GetValueRangeImpl<std::uint8_t>(source, count, min, max);
+   }
 };
 
 template <>
@@ -157,6 +200,9 @@ public:
    explicit RColumnElement(std::int32_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double *min, double *max) const final {
+      return GetValueRangeImpl<std::int32_t>(source, count, min, max);
+   }
 };
 
 template <>
@@ -168,6 +214,9 @@ public:
    explicit RColumnElement(std::uint32_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double *min, double *max) const final {
+      return GetValueRangeImpl<std::uint32_t>(source, count, min, max);
+   }
 };
 
 template <>
@@ -179,6 +228,9 @@ public:
    explicit RColumnElement(std::int64_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double *min, double *max) const final {
+      return GetValueRangeImpl<std::int64_t>(source, count, min, max);
+   }
 };
 
 template <>
@@ -190,6 +242,9 @@ public:
    explicit RColumnElement(std::uint64_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double *min, double *max) const final {
+      return GetValueRangeImpl<std::uint64_t>(source, count, min, max);
+   }
 };
 
 template <>
@@ -239,6 +294,122 @@ public:
    void Unpack(void *dst, void *src, std::size_t count) const final;
 };
 
+template <>
+class RColumnElement<ClusterSize_t, EColumnType::kSplitIndex> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(ClusterSize_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(ClusterSize_t *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<float, EColumnType::kSplitReal32> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(float);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(float *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double *min, double *max) const final {
+      return GetValueRangeImpl<float>(source, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<double, EColumnType::kSplitReal64> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(double);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(double *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double *min, double *max) const final {
+      return GetValueRangeImpl<double>(source, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<std::int32_t, EColumnType::kSplitInt32> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(std::int32_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int32_t *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double *min, double *max) const final {
+      return GetValueRangeImpl<std::int32_t>(source, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<std::uint32_t, EColumnType::kSplitInt32> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(std::uint32_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::uint32_t *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double *min, double *max) const final {
+      return GetValueRangeImpl<std::uint32_t>(source, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<std::int64_t, EColumnType::kSplitInt64> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(std::int64_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int64_t *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double *min, double *max) const final {
+      return GetValueRangeImpl<std::int64_t>(source, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<std::uint64_t, EColumnType::kSplitInt64> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(std::uint64_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::uint64_t *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double *min, double *max) const final {
+      return GetValueRangeImpl<std::uint64_t>(source, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
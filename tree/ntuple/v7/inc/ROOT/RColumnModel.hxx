@@ -48,6 +48,14 @@ enum class EColumnType {
    kInt64,
    kInt32,
    kInt16,
+   // The split encodings store the bytes of the elements of a page grouped by significance, i.e. first all the least
+   // significant bytes, then all the second least significant bytes etc. Integers are zigzag encoded, so that small
+   // negative numbers have zero high bytes, too. Offset columns are additionally delta encoded.
+   kSplitIndex,
+   kSplitReal64,
+   kSplitReal32,
+   kSplitInt64,
+   kSplitInt32,
 };
 
 // clang-format off
@@ -16,6 +16,7 @@
 #ifndef ROOT7_RNTuple
 #define ROOT7_RNTuple
 
+#include <RConfigure.h> // for R__USE_IMT
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleOptions.hxx>
@@ -24,21 +25,49 @@
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <functional>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
 
 class REntry;
 class RNTupleModel;
+class TTaskGroup;
 
 namespace Detail {
 class RPageSink;
+class RPageSinkBuf;
 class RPageSource;
-}
+
+#ifdef R__USE_IMT
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RNTupleImtTaskScheduler
+\ingroup NTuple
+\brief Runs the page (de)compression tasks of a page storage in the implicit multi-threading thread pool
+
+Requires implicit multi-threading to be enabled when the scheduler is constructed.
+*/
+// clang-format on
+class RNTupleImtTaskScheduler : public RPageStorage::RTaskScheduler {
+private:
+   std::unique_ptr<TTaskGroup> fTaskGroup;
+public:
+   RNTupleImtTaskScheduler();
+   virtual ~RNTupleImtTaskScheduler();
+   void Reset() final;
+   void AddTask(const std::function<void(void)> &taskFunc) final;
+   void Wait() final;
+};
+#endif
+
+} // namespace Detail
 
 
 /**
@@ -72,12 +101,17 @@ Individual fields can be read as well by instantiating a tree view.
 // clang-format on
 class RNTupleReader {
 private:
+   /// Set if implicit multi-threading is enabled; decompresses the pages of the preloaded clusters in parallel.
+   /// Needs to be destructed after fSource.
+   std::unique_ptr<Detail::RPageStorage::RTaskScheduler> fUnzipTasks;
    std::unique_ptr<Detail::RPageSource> fSource;
    /// Needs to be destructed before fSource
    std::unique_ptr<RNTupleModel> fModel;
    Detail::RNTupleMetrics fMetrics;
 
    void ConnectModel();
+   /// Attaches the page source and, if implicit multi-threading is enabled, sets the unzip task scheduler
+   void InitPageSource();
 
 public:
    // Browse through the entries
@@ -101,8 +135,11 @@ public:
 
    static std::unique_ptr<RNTupleReader> Open(std::unique_ptr<RNTupleModel> model,
                                               std::string_view ntupleName,
-                                              std::string_view storage);
-   static std::unique_ptr<RNTupleReader> Open(std::string_view ntupleName, std::string_view storage);
+                                              std::string_view storage,
+                                              const RNTupleReadOptions &options = RNTupleReadOptions());
+   static std::unique_ptr<RNTupleReader> Open(std::string_view ntupleName,
+                                              std::string_view storage,
+                                              const RNTupleReadOptions &options = RNTupleReadOptions());
 
    /// The user imposes an ntuple model, which must be compatible with the model found in the data on storage
    RNTupleReader(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSource> source);
@@ -134,6 +171,10 @@ public:
    }
 
    RNTupleGlobalRange GetEntryRange() { return RNTupleGlobalRange(0, GetNEntries()); }
+   /// Uses the stored value ranges of pages and clusters to find the entries whose value of the given top-level or
+   /// nested field can lie in [min, max]. All other entries certainly do not match and need not be read. The entries
+   /// in the returned ranges still need to be checked.
+   std::vector<RNTupleGlobalRange> GetEntryRanges(std::string_view fieldName, double min, double max);
 
    /// Provides access to an individual field that can contain either a scalar value or a collection, e.g.
    /// GetView<double>("particles.pt") or GetView<std::vector<double>>("particle").  It can as well be the index
@@ -152,6 +193,7 @@ public:
    RIterator end() { return RIterator(GetNEntries()); }
 
    void EnableMetrics() { fMetrics.Enable(); }
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
 };
 
 // clang-format off
@@ -169,6 +211,9 @@ triggered by Flush() or by destructing the ntuple.  On I/O errors, an exception
 class RNTupleWriter {
 private:
    static constexpr NTupleSize_t kDefaultClusterSizeEntries = 64000;
+   /// Set if implicit multi-threading is enabled; packs and compresses the pages of a cluster in parallel.
+   /// Needs to be destructed after fSink.
+   std::unique_ptr<Detail::RPageStorage::RTaskScheduler> fZipTasks;
    std::unique_ptr<Detail::RPageSink> fSink;
    /// Needs to be destructed before fSink
    std::unique_ptr<RNTupleModel> fModel;
@@ -202,6 +247,100 @@ public:
    void CommitCluster();
 };
 
+class RNTupleParallelWriter;
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleFillContext
+\ingroup NTuple
+\brief A per-thread context to fill entries into an ntuple written by an RNTupleParallelWriter
+
+The fill context has its own clone of the writer's model and collects the pages of its clusters in a buffered
+page sink. Packing and compression happen on the filling thread. Complete clusters are appended to the writer's
+page sink, which is the only step serialized among the fill contexts. Entries of different fill contexts are
+interleaved in the ntuple at the granularity of clusters.
+*/
+// clang-format on
+class RNTupleFillContext {
+   friend class RNTupleParallelWriter;
+
+private:
+   RNTupleParallelWriter &fWriter;
+   std::unique_ptr<Detail::RPageSinkBuf> fSink;
+   /// Needs to be destructed before fSink
+   std::unique_ptr<RNTupleModel> fModel;
+   NTupleSize_t fClusterSizeEntries;
+   NTupleSize_t fLastCommitted = 0;
+   NTupleSize_t fNEntries = 0;
+
+   RNTupleFillContext(RNTupleParallelWriter &writer, std::unique_ptr<RNTupleModel> model,
+                      std::unique_ptr<Detail::RPageSinkBuf> sink);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext&) = delete;
+   RNTupleFillContext& operator=(const RNTupleFillContext&) = delete;
+   /// Commits the open cluster; must be destructed before the writer
+   ~RNTupleFillContext();
+
+   /// The fill context's clone of the writer's model, whose default entry is filled by Fill()
+   RNTupleModel *GetModel() { return fModel.get(); }
+   void Fill() { Fill(fModel->GetDefaultEntry()); }
+   void Fill(REntry *entry) {
+      for (auto& value : *entry) {
+         value.GetField()->Append(value);
+      }
+      fNEntries++;
+      if ((fNEntries % fClusterSizeEntries) == 0)
+         CommitCluster();
+   }
+   /// Appends the entries filled so far as a new cluster to the ntuple
+   void CommitCluster();
+};
+
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief An RNTuple that is filled concurrently by several fill contexts, e.g. one per thread
+
+The parallel writer owns the page sink and the model from which the fill contexts are cloned. The fill contexts
+buffer their clusters and append them to the page sink under a lock; no post-merging of the written data is
+necessary. All fill contexts need to be destructed before the parallel writer.
+*/
+// clang-format on
+class RNTupleParallelWriter {
+   friend class RNTupleFillContext;
+
+private:
+   static constexpr NTupleSize_t kDefaultClusterSizeEntries = 64000;
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// Needs to be destructed before fSink
+   std::unique_ptr<RNTupleModel> fModel;
+   /// Serializes the cluster commits of the fill contexts
+   std::mutex fLockSink;
+   /// The number of entries in the committed clusters
+   NTupleSize_t fNEntries = 0;
+
+   /// Called by the fill context to append its buffered pages as a new cluster
+   void CommitCluster(Detail::RPageSinkBuf &sink, NTupleSize_t nEntries);
+
+public:
+   static std::unique_ptr<RNTupleParallelWriter> Recreate(std::unique_ptr<RNTupleModel> model,
+                                                          std::string_view ntupleName,
+                                                          std::string_view storage,
+                                                          const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+   RNTupleParallelWriter(const RNTupleParallelWriter&) = delete;
+   RNTupleParallelWriter& operator=(const RNTupleParallelWriter&) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Creates a new fill context with its own clone of the model; thread-safe
+   std::unique_ptr<RNTupleFillContext> CreateFillContext();
+   /// The number of entries committed by all fill contexts so far
+   NTupleSize_t GetNEntries();
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::RCollectionNTuple
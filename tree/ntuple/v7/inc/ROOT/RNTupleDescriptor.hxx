@@ -20,12 +20,14 @@
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <ostream>
 #include <vector>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace ROOT {
 namespace Experimental {
@@ -160,6 +162,34 @@ public:
       }
    };
 
+   /// Optional value range of the elements of a page or of a column range.  Only numerical columns carry a value
+   /// range; it is used to skip clusters and pages that cannot match a range predicate (see FindEntryRanges()).
+   /// NaN values are not part of the range because they never match a range predicate.
+   struct RColumnStats {
+      bool fHasRange = false;
+      double fMin = 0.0;
+      double fMax = 0.0;
+
+      RColumnStats() = default;
+      RColumnStats(double min, double max) : fHasRange(true), fMin(min), fMax(max) {}
+
+      bool operator==(const RColumnStats &other) const {
+         return fHasRange == other.fHasRange && fMin == other.fMin && fMax == other.fMax;
+      }
+
+      /// Widens the range to include other; the result has no range if either of the two has none
+      void Merge(const RColumnStats &other) {
+         if (!fHasRange || !other.fHasRange) {
+            *this = RColumnStats();
+            return;
+         }
+         fMin = std::min(fMin, other.fMin);
+         fMax = std::max(fMax, other.fMax);
+      }
+      /// Returns false only if no element can lie in the closed interval [min, max]
+      bool MayContain(double min, double max) const { return !fHasRange || ((fMin <= max) && (fMax >= min)); }
+   };
+
    /// The window of element indexes of a particular column in a particular cluster
    struct RColumnRange {
       DescriptorId_t fColumnId = kInvalidDescriptorId;
@@ -170,13 +200,13 @@ public:
       /// The usual format for ROOT compression settings (see Compression.h).
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// The value range of all the pages of the column in the cluster
+      RColumnStats fStats;
 
       bool operator==(const RColumnRange &other) const {
          return fColumnId == other.fColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fStats == other.fStats;
       }
 
       bool Contains(NTupleSize_t index) const {
@@ -193,11 +223,20 @@ public:
          ClusterSize_t fNElements = kInvalidClusterIndex;
          /// The meaning of fLocator depends on the storage backend.
          RLocator fLocator;
+         /// The value range of the elements in the page
+         RColumnStats fStats;
 
          bool operator==(const RPageInfo &other) const {
-            return fNElements == other.fNElements && fLocator == other.fLocator;
+            return fNElements == other.fNElements && fLocator == other.fLocator && fStats == other.fStats;
          }
       };
+      /// The page info together with the position of the page in the page range
+      struct RPageInfoExtended : RPageInfo {
+         /// Cluster-local index of the first element in the page
+         ClusterSize_t::ValueType fFirstInPage = 0;
+         /// Page number in the page range
+         NTupleSize_t fPageNo = 0;
+      };
 
       RPageRange() = default;
       RPageRange(const RPageRange &other) = delete;
@@ -207,10 +246,18 @@ public:
 
       DescriptorId_t fColumnId = kInvalidDescriptorId;
       std::vector<RPageInfo> fPageInfos;
+      /// The i-th entry is the number of elements in the pages [0, i]; derived from fPageInfos by
+      /// UpdateCumulativeNElements() and used for the binary search in Find()
+      std::vector<ClusterSize_t::ValueType> fCumulativeNElements;
 
       bool operator==(const RPageRange &other) const {
          return fColumnId == other.fColumnId && fPageInfos == other.fPageInfos;
       }
+
+      /// Needs to be called after fPageInfos has been filled; done by the RNTupleDescriptorBuilder
+      void UpdateCumulativeNElements();
+      /// Returns the page that contains the given cluster-local element index in O(log(number of pages))
+      RPageInfoExtended Find(ClusterSize_t::ValueType idxInCluster) const;
    };
 
 private:
@@ -228,8 +275,10 @@ private:
 
 public:
    /// In order to handle changes to the serialization routine in future ntuple versions
-   static constexpr std::uint16_t kFrameVersionCurrent = 0;
+   static constexpr std::uint16_t kFrameVersionCurrent = 1;
    static constexpr std::uint16_t kFrameVersionMin = 0;
+   /// From this version on, the column ranges and page infos following the cluster frame carry RColumnStats
+   static constexpr std::uint16_t kFrameVersionColumnStats = 1;
 
    RClusterDescriptor() = default;
    RClusterDescriptor(const RClusterDescriptor &other) = delete;
@@ -357,6 +406,15 @@ public:
    DescriptorId_t FindFieldId(std::string_view fieldName) const;
    DescriptorId_t FindColumnId(DescriptorId_t fieldId, std::uint32_t columnIndex) const;
    DescriptorId_t FindClusterId(DescriptorId_t columnId, NTupleSize_t index) const;
+   /// Returns the cluster that holds the entries directly following the given cluster or kInvalidDescriptorId
+   DescriptorId_t FindNextClusterId(DescriptorId_t clusterId) const;
+   /// Returns the cluster that holds the entries directly preceeding the given cluster or kInvalidDescriptorId
+   DescriptorId_t FindPrevClusterId(DescriptorId_t clusterId) const;
+   /// Returns the sorted, disjoint entry ranges [first, last + 1) that may contain entries whose value of the given
+   /// field lies in [min, max]. Uses the value range of the field's principal column.  Pages are skipped only for
+   /// top-level fields, whose elements correspond to entries; for other fields, entire clusters are skipped.
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> FindEntryRanges(DescriptorId_t fieldId,
+                                                                      double min, double max) const;
 
    /// Re-create the C++ model from the stored meta-data
    std::unique_ptr<RNTupleModel> GenerateModel() const;
@@ -0,0 +1,68 @@
+/// \file ROOT/RNTupleMerger.hxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleMerger
+#define ROOT7_RNTupleMerger
+
+#include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+class RNTupleWriteOptions;
+
+namespace Detail {
+
+class RPageSink;
+class RPageSource;
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates the clusters of several ntuples with the same schema without unzipping the pages
+
+The merger copies the sealed (packed and compressed) pages byte by byte from the page sources to the page sink.
+Only the meta-data, i.e. the cluster descriptors and the page locators, are rebuilt by the destination. While the
+pages of a cluster are written, the next cluster is already being read in the background, so that merging is
+bound by I/O rather than by (de-)compression.
+
+The sources need to have the same fields and the same column types. The pages keep the compression settings of
+their source.
+*/
+// clang-format on
+class RNTupleMerger {
+private:
+   /// Maps the column ids of the source to the column ids of the destination. Throws if the field hierarchies or
+   /// the column types do not match.
+   static std::vector<DescriptorId_t> MapColumns(const RPageSource &source, const RPageSink &destination);
+
+public:
+   /// Attaches the sources, creates the destination according to the schema of the first source and appends the
+   /// clusters of all the sources in order.  The sources and the destination must not be used otherwise while
+   /// merging.
+   static void Merge(const std::vector<RPageSource *> &sources, RPageSink &destination);
+   /// Merges the ntuple ntupleName from the given input files into a new output file
+   static void Merge(std::string_view ntupleName, const std::vector<std::string> &inputPaths,
+                     std::string_view outputPath, const RNTupleWriteOptions &options);
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
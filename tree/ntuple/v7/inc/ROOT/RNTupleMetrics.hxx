@@ -262,6 +262,9 @@ public:
    }
 
    void ObserveMetrics(RNTupleMetrics &observee);
+   /// Searches for a counter by name; counters of observed metrics are found by prefixing their name with the
+   /// observed metrics' name, e.g. "RClusterPool.nClusterHit".  Returns nullptr if no such counter exists.
+   const RNTuplePerfCounter *GetCounter(const std::string &name) const;
 
    void Print(std::ostream &output, const std::string &prefix = "") const;
    void Enable();
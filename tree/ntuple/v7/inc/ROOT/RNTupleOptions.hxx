@@ -18,6 +18,8 @@
 
 #include <Compression.h>
 
+#include <cstddef>
+
 namespace ROOT {
 namespace Experimental {
 
@@ -46,6 +48,8 @@ All page sink classes need to support the common options.
 class RNTupleWriteOptions {
   int fCompression{RCompressionSetting::EDefaults::kUseAnalysis};
   ENTupleContainerFormat fContainerFormat{ENTupleContainerFormat::kTFile};
+  /// Store the value range of the pages and clusters of numerical columns, used to skip data on reading
+  bool fColumnStats = true;
 
 public:
   RNTupleWriteOptions() = default;
@@ -58,6 +62,9 @@ public:
 
   ENTupleContainerFormat GetContainerFormat() const { return fContainerFormat; }
   void SetContainerFormat(ENTupleContainerFormat val) { fContainerFormat = val; }
+
+  bool GetColumnStats() const { return fColumnStats; }
+  void SetColumnStats(bool val) { fColumnStats = val; }
 };
 
 
@@ -71,6 +78,37 @@ All page source classes need to support the common options.
 */
 // clang-format on
 class RNTupleReadOptions {
+public:
+  enum EClusterCache {
+    kOff,
+    kOn,
+    kDefault = kOn,
+  };
+  enum class EMemoryMap {
+    kOff,
+    kOn,
+    kDefault = kOff,
+  };
+
+private:
+  EClusterCache fClusterCache = EClusterCache::kDefault;
+  /// If turned on and supported by the storage, uncompressed pages of mappable columns are not copied but point
+  /// directly into a read-only memory mapping of the file
+  EMemoryMap fMemoryMap = EMemoryMap::kDefault;
+  /// The number of clusters following the currently read cluster that are loaded in the background
+  unsigned int fClusterLookAhead = 1;
+  /// The memory in bytes that populated pages may occupy in the page pool after their last user released them
+  std::size_t fPageCacheBudget = 0;
+
+public:
+  EClusterCache GetClusterCache() const { return fClusterCache; }
+  void SetClusterCache(EClusterCache val) { fClusterCache = val; }
+  unsigned int GetClusterLookAhead() const { return fClusterLookAhead; }
+  void SetClusterLookAhead(unsigned int val) { fClusterLookAhead = val; }
+  std::size_t GetPageCacheBudget() const { return fPageCacheBudget; }
+  void SetPageCacheBudget(std::size_t val) { fPageCacheBudget = val; }
+  EMemoryMap GetMemoryMap() const { return fMemoryMap; }
+  void SetMemoryMap(EMemoryMap val) { fMemoryMap = val; }
 };
 
 } // namespace Experimental
@@ -18,8 +18,10 @@
 
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -133,7 +135,8 @@ The view owns a field and its underlying columns in order to fill an ntuple valu
 accessed by index. For top level fields, the index refers to the entry number. Fields that are part of
 nested collections have global index numbers that are derived from their parent indexes.
 
-Fields of simple types with a Map() method will use that and thus expose zero-copy access.
+Fields of simple types with a Map() method will use that and thus expose zero-copy access. Such fields can also be
+read in bulk by MapV(), which returns the values of a range of indexes as a span into the currently mapped page.
 */
 // clang-format on
 template <typename T>
@@ -192,6 +195,25 @@ public:
       fField.Read(clusterIndex, &fValue);
       return *fValue.Get<T>();
    }
+
+   /// Returns up to nItems consecutive values starting at globalIndex. The span ends at the latest at the end of the
+   /// page that contains globalIndex, so that ranges that cross page boundaries need several calls.  The span is
+   /// valid until the next access through this view.
+   template <typename C = T>
+   typename std::enable_if_t<Internal::IsMappable<FieldT>::value, std::span<const C>>
+   MapV(NTupleSize_t globalIndex, NTupleSize_t nItems) {
+      NTupleSize_t nAvail;
+      const C *values = fField.MapV(globalIndex, nAvail);
+      return std::span<const C>(values, std::min(nItems, nAvail));
+   }
+
+   template <typename C = T>
+   typename std::enable_if_t<Internal::IsMappable<FieldT>::value, std::span<const C>>
+   MapV(const RClusterIndex &clusterIndex, NTupleSize_t nItems) {
+      NTupleSize_t nAvail;
+      const C *values = fField.MapV(clusterIndex, nAvail);
+      return std::span<const C>(values, std::min(nItems, nAvail));
+   }
 };
 
 
@@ -200,6 +222,11 @@ public:
 \class ROOT::Experimental::RNTupleViewCollection
 \ingroup NTuple
 \brief A view for a collection, that can itself generate new ntuple views for its nested fields.
+
+MapV() returns the raw offsets of a range of collections: the i-th value is the cluster-local index one past the
+last item of the i-th collection. The first collection of the range starts at the preceding offset or at zero if
+it is the first collection of its cluster. Pages do not span clusters, so all offsets of a span refer to the same
+cluster.
 */
 // clang-format on
 class RNTupleViewCollection : public RNTupleView<ClusterSize_t> {
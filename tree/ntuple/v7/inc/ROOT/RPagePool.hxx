@@ -21,7 +21,12 @@
 #include <ROOT/RNTupleUtil.hxx>
 
 #include <cstddef>
-#include <vector>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
 
 namespace ROOT {
 namespace Experimental {
@@ -39,26 +44,58 @@ pages is thread-safe. The page pool does not allocate the memory -- allocation a
 page storage, which might do it in a way optimized to the backing store (e.g., mmap()).
 Multiple page caches can coexist.
 
-TODO(jblomer): it should be possible to register pages and to find them by column and index; this would
-facilitate pre-filling a cache, e.g. by read-ahead.
+Pages are indexed by column and by their global and cluster-local element range, so that lookups do not depend on
+the number of pages in the pool. Pages whose reference counter drops to zero are kept in the pool as long as
+the total size of such unused pages stays within the memory budget; beyond that, the least recently used pages
+are evicted.
 */
 // clang-format on
 class RPagePool {
 private:
-   /// TODO(jblomer): should be an efficient index structure that allows
-   ///   - random insert
-   ///   - random delete
-   ///   - searching by page
-   ///   - searching by tree index
-   std::vector<RPage> fPages;
-   std::vector<std::uint32_t> fReferences;
-   std::vector<RPageDeleter> fDeleters;
+   /// A registered page, identified by its buffer
+   struct REntry {
+      RPage fPage;
+      RPageDeleter fDeleter;
+      std::uint32_t fRefCounter = 0;
+      /// Whether the page can be found by GetPage(); a page registered concurrently for an already indexed range
+      /// of the same column is not indexed and not cached beyond its last use
+      bool fIsIndexed = false;
+      /// Position in fUnusedPages if the reference counter is zero
+      std::list<void *>::iterator fPosUnused;
+   };
+   /// Lookup tables for the pages of a single column, keyed by the first element of the page
+   struct RColumnPages {
+      std::map<NTupleSize_t, void *> fByGlobalIndex;
+      std::map<std::pair<DescriptorId_t, ClusterSize_t::ValueType>, void *> fByClusterIndex;
+   };
+
+   /// Protects all the members below
+   std::mutex fLock;
+   /// All registered pages, keyed by the page buffer
+   std::unordered_map<void *, REntry> fEntries;
+   std::unordered_map<ColumnId_t, RColumnPages> fColumnPages;
+   /// Pages with a reference counter of zero, the most recently returned page first
+   std::list<void *> fUnusedPages;
+   /// Sum of the capacities of the pages in fUnusedPages
+   std::size_t fSzUnusedPages = 0;
+   /// The memory that unused pages may occupy before they are released; zero means that pages are released as soon
+   /// as their reference counter drops to zero
+   std::size_t fMemoryBudget = 0;
+
+   /// Increases the reference counter of the page in the given entry and removes it from the list of unused pages
+   RPage AcquireEntry(REntry &entry);
+   /// Removes the page from the indexes and calls the page's deleter
+   void ReleaseEntry(std::unordered_map<void *, REntry>::iterator itr);
+   /// Releases the least recently used unused pages until their total size fits into the memory budget
+   void EvictUnusedPages();
 
 public:
    RPagePool() = default;
+   explicit RPagePool(std::size_t memoryBudget) : fMemoryBudget(memoryBudget) {}
    RPagePool(const RPagePool&) = delete;
    RPagePool& operator =(const RPagePool&) = delete;
-   ~RPagePool() = default;
+   /// Releases the pages that are cached but not used anymore
+   ~RPagePool();
 
    /// Adds a new page to the pool together with the function to free its space. Upon registration,
    /// the page pool takes ownership of the page's memory. The new page has its reference counter set to 1.
@@ -68,9 +105,13 @@ public:
    RPage GetPage(ColumnId_t columnId, NTupleSize_t globalIndex);
    RPage GetPage(ColumnId_t columnId, const RClusterIndex &clusterIndex);
    /// Give back a page to the pool and decrease the reference counter. There must not be any pointers anymore into
-   /// this page. If the reference counter drops to zero, the page pool might decide to call the deleter given in
-   /// during registration.
+   /// this page. If the reference counter drops to zero, the page is kept as an unused page if the memory budget
+   /// allows for it. Otherwise, the deleter given in during registration is called.
    void ReturnPage(const RPage &page);
+
+   std::size_t GetMemoryBudget() const { return fMemoryBudget; }
+   /// Changing the memory budget might immediately evict unused pages
+   void SetMemoryBudget(std::size_t memoryBudget);
 };
 
 } // namespace Detail
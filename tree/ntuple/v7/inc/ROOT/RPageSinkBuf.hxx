@@ -0,0 +1,84 @@
+/// \file ROOT/RPageSinkBuf.hxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RPageSinkBuf
+#define ROOT7_RPageSinkBuf
+
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <memory>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+class RPageAllocatorHeap;
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageSinkBuf
+\ingroup NTuple
+\brief A page sink that keeps the sealed pages of the currently open cluster in memory
+
+The buffered sink does not write to storage. Committed pages are packed and compressed right away, on the thread
+that commits the page, and kept in memory until they are transferred to another page sink by CommitTo(). This
+allows several writers to fill clusters independently and to only serialize the transfer of complete clusters.
+The buffered sink assigns column ids in the same way as any other sink, so that a model and its clones result in
+the same column ids.
+*/
+// clang-format on
+class RPageSinkBuf : public RPageSink {
+private:
+   /// A sealed page together with the memory that backs it
+   struct RBufferedPage {
+      DescriptorId_t fColumnId = kInvalidDescriptorId;
+      std::unique_ptr<unsigned char[]> fBuffer;
+      RSealedPage fSealedPage;
+   };
+
+   RNTupleMetrics fMetrics;
+   std::unique_ptr<RPageAllocatorHeap> fPageAllocator;
+   /// The pages of the currently open cluster in commit order
+   std::vector<RBufferedPage> fBufferedPages;
+
+protected:
+   void CreateImpl(const RNTupleModel &model) final;
+   RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
+   RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final;
+   RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) final;
+   void CommitDatasetImpl() final;
+
+public:
+   RPageSinkBuf(std::string_view ntupleName, const RNTupleWriteOptions &options);
+   virtual ~RPageSinkBuf();
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements = 0) final;
+   void ReleasePage(RPage &page) final;
+
+   /// Commits the buffered pages to the other sink, in the order in which they were committed to this sink, and
+   /// empties the buffer. The other sink must have the same columns. Does not commit the cluster in the other
+   /// sink, which is left to the caller.
+   void CommitTo(RPageSink &other);
+   std::size_t GetNBufferedPages() const { return fBufferedPages.size(); }
+
+   RNTupleMetrics &GetMetrics() final { return fMetrics; }
+};
+
+} // namespace Detail
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -16,6 +16,7 @@
 #ifndef ROOT7_RPageStorage
 #define ROOT7_RPageStorage
 
+#include <ROOT/RCluster.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
@@ -25,6 +26,7 @@
 
 #include <atomic>
 #include <cstddef>
+#include <functional>
 #include <memory>
 
 namespace ROOT {
@@ -36,6 +38,7 @@ class RNTupleModel;
 namespace Detail {
 
 class RColumn;
+class RColumnElementBase;
 class RPagePool;
 class RFieldBase;
 class RNTupleMetrics;
@@ -56,8 +59,23 @@ an ntuple.  Concrete implementations can use a TFile, a raw file, an object stor
 */
 // clang-format on
 class RPageStorage {
+public:
+   /// The interface of a task scheduler to schedule page (de)compression tasks
+   class RTaskScheduler {
+   public:
+      virtual ~RTaskScheduler() = default;
+      /// Start a new set of tasks
+      virtual void Reset() = 0;
+      /// Take a callable that represents a task
+      virtual void AddTask(const std::function<void(void)> &taskFunc) = 0;
+      /// Blocks until all scheduled tasks finished
+      virtual void Wait() = 0;
+   };
+
 protected:
    std::string fNTupleName;
+   /// If set, page (de)compression is parallelized using the given scheduler; not owned by the page storage
+   RTaskScheduler *fTaskScheduler = nullptr;
 
 public:
    explicit RPageStorage(std::string_view name);
@@ -74,6 +92,21 @@ public:
    /// The column handle identifies a column with the current open page storage
    using ColumnHandle_t = RColumnHandle;
 
+   /// A sealed page contains the bytes of a page as written to storage (packed & compressed). It is used
+   /// as an input to UnsealPage() as well as to transfer pages between different storage media.
+   struct RSealedPage {
+      const void *fBuffer = nullptr;
+      std::uint32_t fSize = 0;
+      std::uint32_t fNElements = 0;
+      /// The value range of the page's elements, if known
+      RClusterDescriptor::RColumnStats fStats;
+      /// The compression settings used for the page (see Compression.h), recorded in the cluster's column range
+      std::int64_t fCompressionSettings = 0;
+
+      RSealedPage() = default;
+      RSealedPage(const void *b, std::uint32_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
+   };
+
    /// Register a new column.  When reading, the column must exist in the ntuple on disk corresponding to the meta-data.
    /// When writing, every column can only be attached once.
    virtual ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) = 0;
@@ -86,6 +119,9 @@ public:
 
    /// Page storage implementations usually have their own metrics
    virtual RNTupleMetrics &GetMetrics() = 0;
+
+   /// The task scheduler must outlive the page storage
+   void SetTaskScheduler(RTaskScheduler *taskScheduler) { fTaskScheduler = taskScheduler; }
 };
 
 // clang-format off
@@ -117,9 +153,17 @@ protected:
 
    virtual void CreateImpl(const RNTupleModel &model) = 0;
    virtual RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) = 0;
+   virtual RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId,
+                                                             const RSealedPage &sealedPage) = 0;
    virtual RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) = 0;
    virtual void CommitDatasetImpl() = 0;
 
+   /// Adds the page to the page range of the column in the currently open cluster and merges the page statistics
+   /// into the column range. The pages of a column in a cluster must share the same compression settings.
+   void RegisterPage(DescriptorId_t columnId, ClusterSize_t::ValueType nElements,
+                     const RClusterDescriptor::RLocator &locator, const RClusterDescriptor::RColumnStats &stats,
+                     std::int64_t compressionSettings);
+
 public:
    RPageSink(std::string_view ntupleName, const RNTupleWriteOptions &options);
    virtual ~RPageSink();
@@ -127,6 +171,10 @@ public:
    static std::unique_ptr<RPageSink> Create(std::string_view ntupleName, std::string_view location,
                                             const RNTupleWriteOptions &options = RNTupleWriteOptions());
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
+   const std::string &GetNTupleName() const { return fNTupleName; }
+   const RNTupleWriteOptions &GetWriteOptions() const { return fOptions; }
+   /// The meta-data of the fields, columns and committed clusters so far
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
 
@@ -136,6 +184,9 @@ public:
    void Create(RNTupleModel &model);
    /// Write a page to the storage. The column must have been added before.
    void CommitPage(ColumnHandle_t columnHandle, const RPage &page);
+   /// Write a preprocessed page to storage. The column must have been added before. The page keeps the compression
+   /// settings it was sealed with, which can differ from the ones of the write options.
+   void CommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage);
    /// Finalize the current cluster and create a new one for the following data.
    void CommitCluster(NTupleSize_t nEntries);
    /// Finalize the current cluster and the entrire data set.
@@ -144,6 +195,15 @@ public:
    /// Get a new, empty page for the given column that can be filled with up to nElements.  If nElements is zero,
    /// the page sink picks an appropriate size.
    virtual RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements = 0) = 0;
+
+   /// Returns the value range of the page's elements if the column element supports it
+   static RClusterDescriptor::RColumnStats GetPageStats(const RPage &page, const RColumnElementBase &element);
+   /// Returns the number of bytes of the page once packed; the sealed page cannot be larger than this
+   static std::size_t GetPackedSize(const RPage &page, const RColumnElementBase &element);
+   /// Packs and compresses the page into the given buffer, which must provide GetPackedSize() bytes.
+   /// Can be called concurrently.
+   static RSealedPage SealPage(const RPage &page, const RColumnElementBase &element, int compressionSetting,
+                               void *buf);
 };
 
 // clang-format off
@@ -157,11 +217,19 @@ mapped into memory. The page source also gives access to the ntuple's meta-data.
 */
 // clang-format on
 class RPageSource : public RPageStorage {
+public:
+   /// Derived from the model (fields) that are actually being requested at a given point in time
+   using ColumnSet_t = RCluster::ColumnSet_t;
+
 protected:
    const RNTupleReadOptions fOptions;
    RNTupleDescriptor fDescriptor;
+   /// The active columns are implicitly defined by the model fields or views
+   ColumnSet_t fActiveColumns;
 
    virtual RNTupleDescriptor AttachImpl() = 0;
+   /// Decompresses and unpacks the pages of the given cluster using fTaskScheduler
+   virtual void UnzipClusterImpl(RCluster * /* cluster */) { }
 
 public:
    RPageSource(std::string_view ntupleName, const RNTupleReadOptions &fOptions);
@@ -186,6 +254,16 @@ public:
    virtual RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) = 0;
    /// Another version of PopulatePage that allows to specify cluster-relative indexes
    virtual RPage PopulatePage(ColumnHandle_t columnHandle, const RClusterIndex &clusterIndex) = 0;
+
+   /// Populates all the pages of the given cluster id and columns; it is possible that some columns do not
+   /// contain any pages.  The pages are returned packed and compressed in a single RCluster object. Used by
+   /// the cluster pool, which calls LoadCluster() from its I/O thread.
+   virtual std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) = 0;
+
+   /// Parallel decompression and unpacking of the pages in the given cluster. The unzipped pages are attached to
+   /// the cluster and handed out by PopulatePage(). Called by the cluster pool's I/O thread after LoadCluster().
+   /// Does nothing if no task scheduler is set.
+   void UnzipCluster(RCluster *cluster);
 };
 
 } // namespace Detail
@@ -16,6 +16,7 @@
 #ifndef ROOT7_RPageStorageFile
 #define ROOT7_RPageStorageFile
 
+#include <ROOT/RCluster.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RMiniFile.hxx>
 #include <ROOT/RNTupleMetrics.hxx>
@@ -23,7 +24,9 @@
 #include <ROOT/RStringView.hxx>
 
 #include <array>
+#include <cstdint>
 #include <cstdio>
+#include <deque>
 #include <memory>
 #include <string>
 
@@ -38,6 +41,8 @@ class RRawFile;
 namespace Experimental {
 namespace Detail {
 
+class RClusterPool;
+class RColumnElementBase;
 class RPageAllocatorHeap;
 class RPagePool;
 
@@ -67,9 +72,29 @@ private:
    /// Helper for zipping keys and header / footer; comprises a 16MB zip buffer
    RNTupleCompressor fCompressor;
 
+   /// With a task scheduler, pages are packed and compressed by parallel tasks and written at CommitCluster()
+   struct RPendingPage {
+      DescriptorId_t fColumnId = kInvalidDescriptorId;
+      /// The position of the page in the open page range of the column
+      std::size_t fPageIdx = 0;
+      /// Initially a copy of the page; after the task has finished, the packed and compressed page
+      std::unique_ptr<unsigned char[]> fBuffer;
+      std::size_t fPackedBytes = 0;
+      std::size_t fZippedBytes = 0;
+   };
+   /// The pages of the currently open cluster that are processed by the task scheduler, in commit order.
+   /// A deque keeps the references held by the running tasks stable.
+   std::deque<RPendingPage> fPendingPages;
+
+   /// Writes a packed and compressed page to the file and updates the cluster's byte range
+   RClusterDescriptor::RLocator WritePage(const void *buffer, std::size_t zippedBytes, std::size_t packedBytes);
+   /// Waits for the compression tasks and writes the pending pages in the order in which they were committed
+   void WritePendingPages();
+
 protected:
    void CreateImpl(const RNTupleModel &model) final;
    RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
+   RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final;
    RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) final;
    void CommitDatasetImpl() final;
 
@@ -101,6 +126,38 @@ public:
 };
 
 
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageAllocatorMmap
+\ingroup NTuple
+\brief Hands out pages that point into a read-only memory mapping of the file
+
+The allocator maps the entire file on construction and unmaps it on destruction. It owns its own raw file so that
+the mapping can outlive the page source. Mapped pages do not own memory; a page deleter that keeps a reference to the
+allocator ties the lifetime of the page to the mapping.
+*/
+// clang-format on
+class RPageAllocatorMmap {
+private:
+   std::unique_ptr<ROOT::Internal::RRawFile> fFile;
+   unsigned char *fRegion = nullptr;
+   std::size_t fSize = 0;
+
+public:
+   explicit RPageAllocatorMmap(std::unique_ptr<ROOT::Internal::RRawFile> file);
+   RPageAllocatorMmap(const RPageAllocatorMmap &other) = delete;
+   RPageAllocatorMmap &operator =(const RPageAllocatorMmap &other) = delete;
+   ~RPageAllocatorMmap();
+
+   bool Contains(std::uint64_t offset, std::size_t nbytes) const { return offset + nbytes <= fSize; }
+   const unsigned char *GetAddress(std::uint64_t offset) const { return fRegion + offset; }
+   /// Returns a page whose buffer is the given, uncompressed range of the file; no memory is allocated
+   RPage NewPage(ColumnId_t columnId, std::uint64_t offset, std::size_t elementSize, std::size_t nElements);
+   /// Mapped pages are released together with the mapping
+   static void DeletePage(const RPage & /*page*/) {}
+};
+
+
 // clang-format off
 /**
 \class ROOT::Experimental::Detail::RPageSourceFile
@@ -112,9 +169,26 @@ class RPageSourceFile : public RPageSource {
 public:
    /// Cannot process pages larger than 1MB
    static constexpr std::size_t kMaxPageSize = 1024 * 1024;
+   /// When loading a cluster, pages that are separated by at most this number of bytes are fetched by a single read
+   static constexpr std::size_t kMaxReadGap = 64 * 1024;
 
 private:
+   /// I/O performance counters that get registered in fMetrics
+   struct RCounters {
+      RNTupleAtomicCounter &fNReadV;
+      RNTupleAtomicCounter &fNRead;
+      RNTupleAtomicCounter &fSzReadPayload;
+      RNTupleAtomicCounter &fSzReadOverhead;
+      RNTupleAtomicCounter &fNClusterLoaded;
+      RNTupleAtomicCounter &fNPagePopulated;
+      RNTupleAtomicCounter &fNPageUnzipped;
+      RNTupleAtomicCounter &fNPageMapped;
+      RNTupleAtomicCounter &fTimeWallUnzip;
+      RNTupleTickCounter<RNTupleAtomicCounter> &fTimeCpuUnzip;
+   };
+
    RNTupleMetrics fMetrics;
+   std::unique_ptr<RCounters> fCounters;
    /// Populated pages might be shared; there memory buffer is managed by the RPageAllocatorFile
    std::unique_ptr<RPageAllocatorFile> fPageAllocator;
    /// The page pool migh, at some point, be used by multiple page sources
@@ -125,13 +199,28 @@ private:
    std::unique_ptr<ROOT::Internal::RRawFile> fFile;
    /// Takes the fFile to read ntuple blobs from it
    Internal::RMiniFileReader fReader;
+   /// Only present if memory mapping is requested in the read options and supported by fFile. Shared with the
+   /// deleters of the mapped pages, which can outlive the page source in the page pool.
+   std::shared_ptr<RPageAllocatorMmap> fMmapAllocator;
+   /// Loads the pages of the active columns for the current and the look-ahead clusters in the background.
+   /// Needs to be destructed before fFile. Not present if the cluster cache is turned off in the read options.
+   std::unique_ptr<RClusterPool> fClusterPool;
 
    RPageSourceFile(std::string_view ntupleName, const RNTupleReadOptions &options);
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterDescriptor &clusterDescriptor,
                                  ClusterSize_t::ValueType clusterIndex);
+   /// Decompresses and unpacks a packed and compressed page into a new page allocated by RPageAllocatorFile.
+   /// Safe to be called concurrently because only the stateless, out-of-place decompression is used.
+   RPage UnzipPage(ColumnId_t columnId, const RColumnElementBase &element, const void *onDiskBuffer,
+                   std::size_t onDiskSize, ClusterSize_t::ValueType nElements);
+   /// Pages of mappable columns that are stored uncompressed and suitably aligned can be used directly from the
+   /// memory mapping, if there is one
+   bool CanMapPage(const RColumnElementBase &element,
+                   const RClusterDescriptor::RPageRange::RPageInfo &pageInfo) const;
 
 protected:
    RNTupleDescriptor AttachImpl() final;
+   void UnzipClusterImpl(RCluster *cluster) final;
 
 public:
    RPageSourceFile(std::string_view ntupleName, std::string_view path, const RNTupleReadOptions &options);
@@ -144,6 +233,8 @@ public:
    RPage PopulatePage(ColumnHandle_t columnHandle, const RClusterIndex &clusterIndex) final;
    void ReleasePage(RPage &page) final;
 
+   std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) final;
+
    RNTupleMetrics &GetMetrics() final { return fMetrics; }
 };
 
@@ -0,0 +1,76 @@
+/// \file RCluster.cxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RCluster.hxx>
+
+#include <TError.h>
+
+#include <utility>
+
+
+ROOT::Experimental::Detail::RCluster::~RCluster()
+{
+   for (auto &kv : fUnzippedPages)
+      kv.second.second(kv.second.first);
+}
+
+
+void ROOT::Experimental::Detail::RCluster::AdoptUnzippedPage(
+   const ROnDiskPage::Key &key, const RPage &page, const RPageDeleter &deleter)
+{
+   auto result = fUnzippedPages.emplace(key, std::make_pair(page, deleter));
+   R__ASSERT(result.second);
+}
+
+
+void ROOT::Experimental::Detail::RCluster::Adopt(RCluster &&other)
+{
+   R__ASSERT(fClusterId == other.fClusterId);
+
+   for (auto &block : other.fMemoryBlocks)
+      fMemoryBlocks.emplace_back(std::move(block));
+   other.fMemoryBlocks.clear();
+
+   for (const auto &kv : other.fOnDiskPages)
+      fOnDiskPages.emplace(kv.first, kv.second);
+   other.fOnDiskPages.clear();
+
+   for (const auto &kv : other.fUnzippedPages)
+      fUnzippedPages.emplace(kv.first, kv.second);
+   other.fUnzippedPages.clear();
+
+   fAvailColumns.insert(other.fAvailColumns.begin(), other.fAvailColumns.end());
+   other.fAvailColumns.clear();
+}
+
+
+const ROOT::Experimental::Detail::ROnDiskPage *
+ROOT::Experimental::Detail::RCluster::GetOnDiskPage(const ROnDiskPage::Key &key) const
+{
+   const auto itr = fOnDiskPages.find(key);
+   if (itr != fOnDiskPages.end())
+      return &(itr->second);
+   return nullptr;
+}
+
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RCluster::TakeUnzippedPage(const ROnDiskPage::Key &key)
+{
+   auto itr = fUnzippedPages.find(key);
+   if (itr == fUnzippedPages.end())
+      return RPage();
+   auto page = itr->second.first;
+   fUnzippedPages.erase(itr);
+   return page;
+}
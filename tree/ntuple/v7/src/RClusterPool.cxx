@@ -0,0 +1,222 @@
+/// \file RClusterPool.cxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RClusterPool.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <TError.h>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <unordered_set>
+#include <utility>
+
+
+ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int lookAhead)
+   : fPageSource(pageSource)
+   , fWindowPre(1)
+   , fWindowPost(1 + lookAhead)
+   , fMetrics("RClusterPool")
+{
+   fCtrNClusterHit = fMetrics.MakeCounter<RNTupleAtomicCounter *>(
+      "nClusterHit", "", "number of requested clusters found in the pool");
+   fCtrNClusterMiss = fMetrics.MakeCounter<RNTupleAtomicCounter *>(
+      "nClusterMiss", "", "number of requested clusters that had to be waited for");
+   fCtrNClusterEvicted = fMetrics.MakeCounter<RNTupleAtomicCounter *>(
+      "nClusterEvicted", "", "number of clusters removed from the pool");
+   fCtrTimeWaitIo = fMetrics.MakeCounter<RNTupleAtomicCounter *>(
+      "timeWaitIo", "ns", "wall clock time spent waiting for cluster I/O");
+
+   fThreadIo = std::thread(&RClusterPool::ExecReadClusters, this);
+}
+
+
+ROOT::Experimental::Detail::RClusterPool::~RClusterPool()
+{
+   {
+      // Outstanding requests are dropped, their futures are never waited for
+      std::unique_lock<std::mutex> lock(fLockWorkQueue);
+      fReadQueue.clear();
+      fReadQueue.emplace_back(RReadItem());
+      fCvHasReadWork.notify_one();
+   }
+   fThreadIo.join();
+}
+
+
+void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
+{
+   while (true) {
+      std::vector<RReadItem> readItems;
+      {
+         std::unique_lock<std::mutex> lock(fLockWorkQueue);
+         fCvHasReadWork.wait(lock, [&]{ return !fReadQueue.empty(); });
+         while (!fReadQueue.empty()) {
+            readItems.emplace_back(std::move(fReadQueue.front()));
+            fReadQueue.pop_front();
+         }
+      }
+
+      for (auto &item : readItems) {
+         if (item.fClusterId == kInvalidDescriptorId)
+            return;
+
+         try {
+            auto cluster = fPageSource.LoadCluster(item.fClusterId, item.fColumns);
+            // Second pipeline step: decompress and unpack the pages, if the page source has a task scheduler
+            fPageSource.UnzipCluster(cluster.get());
+            item.fPromise.set_value(std::move(cluster));
+         } catch (...) {
+            item.fPromise.set_exception(std::current_exception());
+         }
+      }
+   }
+}
+
+
+int ROOT::Experimental::Detail::RClusterPool::FindInPool(DescriptorId_t clusterId) const
+{
+   for (unsigned int i = 0; i < fPool.size(); ++i) {
+      if (fPool[i]->GetId() == clusterId)
+         return i;
+   }
+   return -1;
+}
+
+
+void ROOT::Experimental::Detail::RClusterPool::MergeIntoPool(std::unique_ptr<RCluster> cluster)
+{
+   auto idx = FindInPool(cluster->GetId());
+   if (idx < 0) {
+      fPool.emplace_back(std::move(cluster));
+      return;
+   }
+   fPool[idx]->Adopt(std::move(*cluster));
+}
+
+
+ROOT::Experimental::Detail::RCluster *
+ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns)
+{
+   const auto &desc = fPageSource.GetDescriptor();
+
+   // The clusters that should be loaded, the active one first, followed by the look-ahead window
+   std::vector<DescriptorId_t> provide;
+   // The clusters that are allowed to stay in the pool
+   std::unordered_set<DescriptorId_t> keep;
+   for (auto next = clusterId; (next != kInvalidDescriptorId) && (provide.size() < fWindowPost);
+        next = desc.FindNextClusterId(next))
+   {
+      provide.emplace_back(next);
+      keep.insert(next);
+   }
+   auto prev = clusterId;
+   for (unsigned int i = 0; i < fWindowPre; ++i) {
+      prev = desc.FindPrevClusterId(prev);
+      if (prev == kInvalidDescriptorId)
+         break;
+      keep.insert(prev);
+   }
+
+   // Collect clusters that the I/O thread finished in the meantime; requests outside the window are dropped
+   for (auto itr = fInFlightClusters.begin(); itr != fInFlightClusters.end(); ) {
+      if (itr->fClusterId == clusterId ||
+          itr->fFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+      {
+         ++itr;
+         continue;
+      }
+      auto cluster = itr->fFuture.get();
+      if (keep.count(cluster->GetId()) > 0) {
+         MergeIntoPool(std::move(cluster));
+      } else {
+         fCtrNClusterEvicted->Inc();
+      }
+      itr = fInFlightClusters.erase(itr);
+   }
+
+   // Evict clusters that fell out of the window
+   auto nPool = fPool.size();
+   fPool.erase(std::remove_if(fPool.begin(), fPool.end(),
+      [&keep](const std::unique_ptr<RCluster> &c) { return keep.count(c->GetId()) == 0; }), fPool.end());
+   fCtrNClusterEvicted->Add(nPool - fPool.size());
+
+   // Schedule the columns that are neither in the pool nor already being loaded
+   {
+      std::unique_lock<std::mutex> lock(fLockWorkQueue);
+      bool hasNewWork = false;
+      for (auto id : provide) {
+         RCluster::ColumnSet_t missingColumns;
+         auto idxPool = FindInPool(id);
+         for (auto columnId : columns) {
+            if ((idxPool >= 0) && fPool[idxPool]->ContainsColumn(columnId))
+               continue;
+            bool isInFlight = false;
+            for (const auto &inFlight : fInFlightClusters) {
+               if ((inFlight.fClusterId == id) && (inFlight.fColumns.count(columnId) > 0)) {
+                  isInFlight = true;
+                  break;
+               }
+            }
+            if (!isInFlight)
+               missingColumns.insert(columnId);
+         }
+         if (missingColumns.empty())
+            continue;
+
+         RReadItem readItem;
+         readItem.fClusterId = id;
+         readItem.fColumns = missingColumns;
+         RInFlightCluster inFlightCluster;
+         inFlightCluster.fFuture = readItem.fPromise.get_future();
+         inFlightCluster.fClusterId = id;
+         inFlightCluster.fColumns = missingColumns;
+         fInFlightClusters.emplace_back(std::move(inFlightCluster));
+         fReadQueue.emplace_back(std::move(readItem));
+         hasNewWork = true;
+      }
+      if (hasNewWork)
+         fCvHasReadWork.notify_one();
+   }
+
+   // Wait for the active cluster, if necessary
+   bool isHit = true;
+   for (auto itr = fInFlightClusters.begin(); itr != fInFlightClusters.end(); ) {
+      if (itr->fClusterId != clusterId) {
+         ++itr;
+         continue;
+      }
+      isHit = false;
+      auto timeStart = std::chrono::steady_clock::now();
+      itr->fFuture.wait();
+      fCtrTimeWaitIo->Add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+         std::chrono::steady_clock::now() - timeStart).count());
+      MergeIntoPool(itr->fFuture.get());
+      itr = fInFlightClusters.erase(itr);
+   }
+   if (isHit) {
+      fCtrNClusterHit->Inc();
+   } else {
+      fCtrNClusterMiss->Inc();
+   }
+
+   auto idx = FindInPool(clusterId);
+   if (idx < 0) {
+      // No columns requested
+      fPool.emplace_back(std::make_unique<RCluster>(clusterId));
+      idx = fPool.size() - 1;
+   }
+   return fPool[idx].get();
+}
@@ -20,31 +20,112 @@
 #include <algorithm>
 #include <bitset>
 #include <cstdint>
+#include <memory>
 
-ROOT::Experimental::Detail::RColumnElementBase
+namespace {
+
+/// Groups the bytes of count elements of size N by significance. The loops are kept simple so that the compiler can
+/// vectorize them.
+template <std::size_t N>
+void CastSplitPack(void *destination, const void *source, std::size_t count)
+{
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   for (std::size_t b = 0; b < N; ++b) {
+      for (std::size_t i = 0; i < count; ++i)
+         dst[b * count + i] = src[i * N + b];
+   }
+}
+
+/// Reverts CastSplitPack()
+template <std::size_t N>
+void CastSplitUnpack(void *destination, const void *source, std::size_t count)
+{
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   for (std::size_t b = 0; b < N; ++b) {
+      for (std::size_t i = 0; i < count; ++i)
+         dst[i * N + b] = src[b * count + i];
+   }
+}
+
+/// Maps signed integers of small magnitude to small unsigned integers: 0, -1, 1, -2, ... --> 0, 1, 2, 3, ...
+/// The conversion works on the two's complement bit pattern, so that it applies to signed and unsigned values alike.
+template <typename UIntT>
+UIntT EncodeZigzag(UIntT value)
+{
+   return (value << 1) ^ (UIntT(0) - (value >> (sizeof(UIntT) * 8 - 1)));
+}
+
+template <typename UIntT>
+UIntT DecodeZigzag(UIntT value)
+{
+   return (value >> 1) ^ (UIntT(0) - (value & 1));
+}
+
+/// Zigzag encodes the values (or, for IsDeltaT, the differences of consecutive values) before splitting the bytes
+template <typename UIntT, bool IsDeltaT>
+void ZigzagSplitPack(void *destination, const void *source, std::size_t count)
+{
+   auto src = reinterpret_cast<const UIntT *>(source);
+   std::unique_ptr<UIntT[]> buffer(new UIntT[count]);
+   UIntT prev = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      buffer[i] = EncodeZigzag<UIntT>(IsDeltaT ? (src[i] - prev) : src[i]);
+      prev = src[i];
+   }
+   CastSplitPack<sizeof(UIntT)>(destination, buffer.get(), count);
+}
+
+/// Reverts ZigzagSplitPack()
+template <typename UIntT, bool IsDeltaT>
+void ZigzagSplitUnpack(void *destination, const void *source, std::size_t count)
+{
+   CastSplitUnpack<sizeof(UIntT)>(destination, source, count);
+   auto dst = reinterpret_cast<UIntT *>(destination);
+   UIntT prev = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      dst[i] = DecodeZigzag<UIntT>(dst[i]) + (IsDeltaT ? prev : 0);
+      prev = dst[i];
+   }
+}
+
+} // anonymous namespace
+
+std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
 ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
    switch (type) {
    case EColumnType::kReal32:
-      return RColumnElement<float, EColumnType::kReal32>(nullptr);
+      return std::make_unique<RColumnElement<float, EColumnType::kReal32>>(nullptr);
    case EColumnType::kReal64:
-      return RColumnElement<double, EColumnType::kReal64>(nullptr);
+      return std::make_unique<RColumnElement<double, EColumnType::kReal64>>(nullptr);
    case EColumnType::kByte:
-      return RColumnElement<std::uint8_t, EColumnType::kByte>(nullptr);
+      return std::make_unique<RColumnElement<std::uint8_t, EColumnType::kByte>>(nullptr);
    case EColumnType::kInt32:
-      return RColumnElement<std::int32_t, EColumnType::kInt32>(nullptr);
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kInt32>>(nullptr);
    case EColumnType::kInt64:
-      return RColumnElement<std::int64_t, EColumnType::kInt64>(nullptr);
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kInt64>>(nullptr);
    case EColumnType::kBit:
-      return RColumnElement<bool, EColumnType::kBit>(nullptr);
+      return std::make_unique<RColumnElement<bool, EColumnType::kBit>>(nullptr);
    case EColumnType::kIndex:
-      return RColumnElement<ClusterSize_t, EColumnType::kIndex>(nullptr);
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kIndex>>(nullptr);
    case EColumnType::kSwitch:
-      return RColumnElement<RColumnSwitch, EColumnType::kSwitch>(nullptr);
+      return std::make_unique<RColumnElement<RColumnSwitch, EColumnType::kSwitch>>(nullptr);
+   case EColumnType::kSplitIndex:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kSplitIndex>>(nullptr);
+   case EColumnType::kSplitReal64:
+      return std::make_unique<RColumnElement<double, EColumnType::kSplitReal64>>(nullptr);
+   case EColumnType::kSplitReal32:
+      return std::make_unique<RColumnElement<float, EColumnType::kSplitReal32>>(nullptr);
+   case EColumnType::kSplitInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kSplitInt64>>(nullptr);
+   case EColumnType::kSplitInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitInt32>>(nullptr);
    default:
       R__ASSERT(false);
    }
    // never here
-   return RColumnElementBase();
+   return nullptr;
 }
 
 void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit>::Pack(
@@ -80,3 +161,87 @@ void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColum
       }
    }
 }
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitPack<ClusterSize_t::ValueType, true>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitUnpack<ClusterSize_t::ValueType, true>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitPack<sizeof(float)>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitUnpack<sizeof(float)>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitPack<sizeof(double)>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitUnpack<sizeof(double)>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitPack<std::uint32_t, false>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitUnpack<std::uint32_t, false>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitPack<std::uint32_t, false>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitUnpack<std::uint32_t, false>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitPack<std::uint64_t, false>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitUnpack<std::uint64_t, false>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitPack<std::uint64_t, false>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitUnpack<std::uint64_t, false>(dst, src, count);
+}
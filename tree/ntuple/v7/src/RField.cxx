@@ -326,9 +326,9 @@ void ROOT::Experimental::RFieldRoot::AcceptVisitor(Detail::RFieldVisitor &visito
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
+   RColumnModel model(EColumnType::kSplitIndex, true /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+      Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex>(model, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
@@ -373,9 +373,9 @@ void ROOT::Experimental::RField<bool>::AcceptVisitor(Detail::RFieldVisitor &visi
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kReal32, false /* isSorted*/);
+   RColumnModel model(EColumnType::kSplitReal32, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<float, EColumnType::kReal32>(model, 0)));
+      Detail::RColumn::Create<float, EColumnType::kSplitReal32>(model, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
@@ -389,9 +389,9 @@ void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &vis
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kReal64, false /* isSorted*/);
+   RColumnModel model(EColumnType::kSplitReal64, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<double, EColumnType::kReal64>(model, 0)));
+      Detail::RColumn::Create<double, EColumnType::kSplitReal64>(model, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
@@ -404,9 +404,9 @@ void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &vi
 
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
+   RColumnModel model(EColumnType::kSplitInt32, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::int32_t, EColumnType::kInt32>(model, 0)));
+      std::int32_t, EColumnType::kSplitInt32>(model, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
@@ -419,9 +419,9 @@ void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
+   RColumnModel model(EColumnType::kSplitInt32, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::uint32_t, EColumnType::kInt32>(model, 0)));
+      Detail::RColumn::Create<std::uint32_t, EColumnType::kSplitInt32>(model, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
@@ -434,9 +434,9 @@ void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
+   RColumnModel model(EColumnType::kSplitInt64, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::uint64_t, EColumnType::kInt64>(model, 0)));
+      Detail::RColumn::Create<std::uint64_t, EColumnType::kSplitInt64>(model, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
@@ -450,9 +450,9 @@ void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
+   RColumnModel modelIndex(EColumnType::kSplitIndex, true /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+      Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex>(modelIndex, 0)));
 
    RColumnModel modelChars(EColumnType::kByte, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
@@ -647,9 +647,9 @@ void ROOT::Experimental::RFieldVector::ReadGlobalImpl(NTupleSize_t globalIndex,
 
 void ROOT::Experimental::RFieldVector::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
+   RColumnModel modelIndex(EColumnType::kSplitIndex, true /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+      Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex>(modelIndex, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
@@ -743,9 +743,9 @@ void ROOT::Experimental::RField<std::vector<bool>>::ReadGlobalImpl(NTupleSize_t
 
 void ROOT::Experimental::RField<std::vector<bool>>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
+   RColumnModel modelIndex(EColumnType::kSplitIndex, true /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+      Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex>(modelIndex, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
@@ -1016,9 +1016,9 @@ ROOT::Experimental::RFieldCollection::RFieldCollection(
 
 void ROOT::Experimental::RFieldCollection::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
+   RColumnModel modelIndex(EColumnType::kSplitIndex, true /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+      Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex>(modelIndex, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
@@ -17,6 +17,7 @@
 
 #include "ROOT/RFieldVisitor.hxx"
 #include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RPageSinkBuf.hxx"
 #include "ROOT/RPageStorage.hxx"
 
 #include <algorithm>
@@ -29,6 +30,37 @@
 #include <utility>
 
 #include <TError.h>
+#include <TROOT.h> // for IsImplicitMTEnabled()
+
+#ifdef R__USE_IMT
+#include <ROOT/TTaskGroup.hxx>
+#endif
+
+#ifdef R__USE_IMT
+ROOT::Experimental::Detail::RNTupleImtTaskScheduler::RNTupleImtTaskScheduler()
+{
+   Reset();
+}
+
+ROOT::Experimental::Detail::RNTupleImtTaskScheduler::~RNTupleImtTaskScheduler()
+{
+}
+
+void ROOT::Experimental::Detail::RNTupleImtTaskScheduler::Reset()
+{
+   fTaskGroup = std::make_unique<TTaskGroup>();
+}
+
+void ROOT::Experimental::Detail::RNTupleImtTaskScheduler::AddTask(const std::function<void(void)> &taskFunc)
+{
+   fTaskGroup->Run(taskFunc);
+}
+
+void ROOT::Experimental::Detail::RNTupleImtTaskScheduler::Wait()
+{
+   fTaskGroup->Wait();
+}
+#endif
 
 
 void ROOT::Experimental::RNTupleReader::ConnectModel() {
@@ -43,6 +75,17 @@ void ROOT::Experimental::RNTupleReader::ConnectModel() {
    }
 }
 
+void ROOT::Experimental::RNTupleReader::InitPageSource()
+{
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled()) {
+      fUnzipTasks = std::make_unique<Detail::RNTupleImtTaskScheduler>();
+      fSource->SetTaskScheduler(fUnzipTasks.get());
+   }
+#endif
+   fSource->Attach();
+}
+
 ROOT::Experimental::RNTupleReader::RNTupleReader(
    std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
    std::unique_ptr<ROOT::Experimental::Detail::RPageSource> source)
@@ -50,7 +93,7 @@ ROOT::Experimental::RNTupleReader::RNTupleReader(
    , fModel(std::move(model))
    , fMetrics("RNTupleReader")
 {
-   fSource->Attach();
+   InitPageSource();
    ConnectModel();
    fMetrics.ObserveMetrics(fSource->GetMetrics());
 }
@@ -60,7 +103,7 @@ ROOT::Experimental::RNTupleReader::RNTupleReader(std::unique_ptr<ROOT::Experimen
    , fModel(nullptr)
    , fMetrics("RNTupleReader")
 {
-   fSource->Attach();
+   InitPageSource();
    fModel = fSource->GetDescriptor().GenerateModel();
    ConnectModel();
    fMetrics.ObserveMetrics(fSource->GetMetrics());
@@ -73,16 +116,18 @@ ROOT::Experimental::RNTupleReader::~RNTupleReader()
 std::unique_ptr<ROOT::Experimental::RNTupleReader> ROOT::Experimental::RNTupleReader::Open(
    std::unique_ptr<RNTupleModel> model,
    std::string_view ntupleName,
-   std::string_view storage)
+   std::string_view storage,
+   const RNTupleReadOptions &options)
 {
-   return std::make_unique<RNTupleReader>(std::move(model), Detail::RPageSource::Create(ntupleName, storage));
+   return std::make_unique<RNTupleReader>(std::move(model), Detail::RPageSource::Create(ntupleName, storage, options));
 }
 
 std::unique_ptr<ROOT::Experimental::RNTupleReader> ROOT::Experimental::RNTupleReader::Open(
    std::string_view ntupleName,
-   std::string_view storage)
+   std::string_view storage,
+   const RNTupleReadOptions &options)
 {
-   return std::make_unique<RNTupleReader>(Detail::RPageSource::Create(ntupleName, storage));
+   return std::make_unique<RNTupleReader>(Detail::RPageSource::Create(ntupleName, storage, options));
 }
 
 void ROOT::Experimental::RNTupleReader::PrintInfo(const ENTupleInfo what, std::ostream &output)
@@ -170,6 +215,19 @@ void ROOT::Experimental::RNTupleReader::Show(NTupleSize_t index, const ENTupleFo
 }
 
 
+std::vector<ROOT::Experimental::RNTupleGlobalRange>
+ROOT::Experimental::RNTupleReader::GetEntryRanges(std::string_view fieldName, double min, double max)
+{
+   const auto &desc = fSource->GetDescriptor();
+   auto fieldId = desc.FindFieldId(fieldName);
+   R__ASSERT(fieldId != kInvalidDescriptorId);
+   std::vector<RNTupleGlobalRange> result;
+   for (const auto &r : desc.FindEntryRanges(fieldId, min, max))
+      result.emplace_back(r.first, r.second);
+   return result;
+}
+
+
 //------------------------------------------------------------------------------
 
 
@@ -182,6 +240,12 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(
    , fLastCommitted(0)
    , fNEntries(0)
 {
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled()) {
+      fZipTasks = std::make_unique<Detail::RNTupleImtTaskScheduler>();
+      fSink->SetTaskScheduler(fZipTasks.get());
+   }
+#endif
    fSink->Create(*fModel.get());
 }
 
@@ -216,6 +280,86 @@ void ROOT::Experimental::RNTupleWriter::CommitCluster()
 //------------------------------------------------------------------------------
 
 
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(RNTupleParallelWriter &writer,
+   std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSinkBuf> sink)
+   : fWriter(writer)
+   , fSink(std::move(sink))
+   , fModel(std::move(model))
+   , fClusterSizeEntries(RNTupleParallelWriter::kDefaultClusterSizeEntries)
+{
+   fSink->Create(*fModel.get());
+}
+
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   CommitCluster();
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted) return;
+   for (auto& field : *fModel->GetRootField()) {
+      field.Flush();
+      field.CommitCluster();
+   }
+   fWriter.CommitCluster(*fSink, fNEntries - fLastCommitted);
+   fLastCommitted = fNEntries;
+}
+
+
+//------------------------------------------------------------------------------
+
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(
+   std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
+   std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
+   : fSink(std::move(sink))
+   , fModel(std::move(model))
+{
+   fSink->Create(*fModel.get());
+}
+
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   fSink->CommitDataset();
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> ROOT::Experimental::RNTupleParallelWriter::Recreate(
+   std::unique_ptr<RNTupleModel> model,
+   std::string_view ntupleName,
+   std::string_view storage,
+   const RNTupleWriteOptions &options)
+{
+   return std::make_unique<RNTupleParallelWriter>(
+      std::move(model), Detail::RPageSink::Create(ntupleName, storage, options));
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleFillContext> ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   std::lock_guard<std::mutex> guard(fLockSink);
+   auto model = std::unique_ptr<RNTupleModel>(fModel->Clone());
+   auto sink = std::make_unique<Detail::RPageSinkBuf>(fSink->GetNTupleName(), fSink->GetWriteOptions());
+   return std::unique_ptr<RNTupleFillContext>(new RNTupleFillContext(*this, std::move(model), std::move(sink)));
+}
+
+ROOT::Experimental::NTupleSize_t ROOT::Experimental::RNTupleParallelWriter::GetNEntries()
+{
+   std::lock_guard<std::mutex> guard(fLockSink);
+   return fNEntries;
+}
+
+void ROOT::Experimental::RNTupleParallelWriter::CommitCluster(Detail::RPageSinkBuf &sink, NTupleSize_t nEntries)
+{
+   std::lock_guard<std::mutex> guard(fLockSink);
+   sink.CommitTo(*fSink);
+   fNEntries += nEntries;
+   fSink->CommitCluster(fNEntries);
+}
+
+
+//------------------------------------------------------------------------------
+
+
 ROOT::Experimental::RCollectionNTuple::RCollectionNTuple(std::unique_ptr<REntry> defaultEntry)
    : fOffset(0), fDefaultEntry(std::move(defaultEntry))
 {
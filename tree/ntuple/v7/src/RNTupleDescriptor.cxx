@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <iterator>
 #include <utility>
 
 namespace {
@@ -209,7 +210,8 @@ std::uint32_t SerializeFrame(std::uint16_t protocolVersionCurrent, std::uint16_t
    return 8;
 }
 
-std::uint32_t DeserializeFrame(std::uint16_t protocolVersion, const void *buffer, std::uint32_t *size)
+std::uint32_t DeserializeFrame(std::uint16_t protocolVersion, const void *buffer, std::uint32_t *size,
+   std::uint16_t *versionAtWrite = nullptr)
 {
    auto bytes = reinterpret_cast<const unsigned char *>(buffer);
    std::uint16_t protocolVersionAtWrite;
@@ -219,6 +221,8 @@ std::uint32_t DeserializeFrame(std::uint16_t protocolVersion, const void *buffer
    R__ASSERT(protocolVersionAtWrite >= protocolVersionMinRequired);
    R__ASSERT(protocolVersion >= protocolVersionMinRequired);
    bytes += DeserializeUInt32(bytes, size);
+   if (versionAtWrite != nullptr)
+      *versionAtWrite = protocolVersionAtWrite;
    return 8;
 }
 
@@ -329,6 +333,45 @@ std::uint32_t DeserializeTimeStamp(const void *buffer, std::chrono::system_clock
    return size;
 }
 
+std::uint32_t SerializeDouble(double val, void *buffer)
+{
+   std::uint64_t bits;
+   static_assert(sizeof(bits) == sizeof(val), "unsupported double layout");
+   memcpy(&bits, &val, sizeof(bits));
+   return SerializeUInt64(bits, buffer);
+}
+
+std::uint32_t DeserializeDouble(const void *buffer, double *val)
+{
+   std::uint64_t bits;
+   auto nbytes = DeserializeUInt64(buffer, &bits);
+   memcpy(val, &bits, sizeof(bits));
+   return nbytes;
+}
+
+std::uint32_t SerializeColumnStats(const ROOT::Experimental::RClusterDescriptor::RColumnStats &val, void *buffer)
+{
+   // Fixed size, the range values are meaningless if there is no range
+   if (buffer != nullptr) {
+      auto pos = reinterpret_cast<unsigned char *>(buffer);
+      pos += SerializeUInt32(val.fHasRange ? 1 : 0, pos);
+      pos += SerializeDouble(val.fMin, pos);
+      pos += SerializeDouble(val.fMax, pos);
+   }
+   return 20;
+}
+
+std::uint32_t DeserializeColumnStats(const void *buffer, ROOT::Experimental::RClusterDescriptor::RColumnStats *stats)
+{
+   auto bytes = reinterpret_cast<const unsigned char *>(buffer);
+   std::uint32_t hasRange;
+   bytes += DeserializeUInt32(bytes, &hasRange);
+   bytes += DeserializeDouble(bytes, &stats->fMin);
+   bytes += DeserializeDouble(bytes, &stats->fMax);
+   stats->fHasRange = (hasRange != 0);
+   return 20;
+}
+
 std::uint32_t SerializeColumnRange(const ROOT::Experimental::RClusterDescriptor::RColumnRange &val, void *buffer)
 {
    // To keep the cluster footers small, we don't put a frame around individual column ranges.
@@ -338,19 +381,25 @@ std::uint32_t SerializeColumnRange(const ROOT::Experimental::RClusterDescriptor:
       pos += SerializeUInt64(val.fFirstElementIndex, pos);
       pos += SerializeClusterSize(val.fNElements, pos);
       pos += SerializeInt64(val.fCompressionSettings, pos);
+      pos += SerializeColumnStats(val.fStats, pos);
    }
-   return 20;
+   return 20 + SerializeColumnStats(val.fStats, nullptr);
 }
 
+/// Column statistics are only stored from cluster frame version 1 on; for older footers, `hasStats` is false and
+/// the statistics are left unset, such that no entry range is skipped.
 std::uint32_t DeserializeColumnRange(const void *buffer,
-   ROOT::Experimental::RClusterDescriptor::RColumnRange *columnRange)
+   ROOT::Experimental::RClusterDescriptor::RColumnRange *columnRange, bool hasStats)
 {
-   auto bytes = reinterpret_cast<const unsigned char *>(buffer);
+   auto base = reinterpret_cast<const unsigned char *>(buffer);
+   auto bytes = base;
    // The column id is set elsewhere (see AddClustersFromFooter())
    bytes += DeserializeUInt64(bytes, &columnRange->fFirstElementIndex);
    bytes += DeserializeClusterSize(bytes, &columnRange->fNElements);
    bytes += DeserializeInt64(bytes, &columnRange->fCompressionSettings);
-   return 20;
+   if (hasStats)
+      bytes += DeserializeColumnStats(bytes, &columnRange->fStats);
+   return bytes - base;
 }
 
 std::uint32_t SerializePageInfo(const ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfo &val, void *buffer)
@@ -361,18 +410,21 @@ std::uint32_t SerializePageInfo(const ROOT::Experimental::RClusterDescriptor::RP
       // The column id is stored in SerializeFooter() for the column range and the page range altogether
       pos += SerializeClusterSize(val.fNElements, pos);
       pos += SerializeLocator(val.fLocator, pos);
+      pos += SerializeColumnStats(val.fStats, pos);
    }
-   return 4 + SerializeLocator(val.fLocator, nullptr);
+   return 4 + SerializeLocator(val.fLocator, nullptr) + SerializeColumnStats(val.fStats, nullptr);
 }
 
 std::uint32_t DeserializePageInfo(const void *buffer,
-   ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfo *pageInfo)
+   ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfo *pageInfo, bool hasStats)
 {
    auto base = reinterpret_cast<const unsigned char *>(buffer);
    auto bytes = base;
    // The column id is set elsewhere (see AddClustersFromFooter())
    bytes += DeserializeClusterSize(bytes, &pageInfo->fNElements);
    bytes += DeserializeLocator(bytes, &pageInfo->fLocator);
+   if (hasStats)
+      bytes += DeserializeColumnStats(bytes, &pageInfo->fStats);
    return bytes - base;
 }
 
@@ -500,6 +552,40 @@ bool ROOT::Experimental::RColumnDescriptor::operator==(const RColumnDescriptor &
 ////////////////////////////////////////////////////////////////////////////////
 
 
+void ROOT::Experimental::RClusterDescriptor::RPageRange::UpdateCumulativeNElements()
+{
+   fCumulativeNElements.clear();
+   fCumulativeNElements.reserve(fPageInfos.size());
+   ClusterSize_t::ValueType sum = 0;
+   for (const auto &pi : fPageInfos) {
+      sum += pi.fNElements;
+      fCumulativeNElements.emplace_back(sum);
+   }
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfoExtended
+ROOT::Experimental::RClusterDescriptor::RPageRange::Find(ClusterSize_t::ValueType idxInCluster) const
+{
+   R__ASSERT(fCumulativeNElements.size() == fPageInfos.size());
+   // The first page whose elements extend beyond idxInCluster
+   auto itr = std::upper_bound(fCumulativeNElements.begin(), fCumulativeNElements.end(), idxInCluster);
+   R__ASSERT(itr != fCumulativeNElements.end());
+   const auto pageNo = std::distance(fCumulativeNElements.begin(), itr);
+
+   RPageInfoExtended pageInfo;
+   pageInfo.fNElements = fPageInfos[pageNo].fNElements;
+   pageInfo.fLocator = fPageInfos[pageNo].fLocator;
+   pageInfo.fStats = fPageInfos[pageNo].fStats;
+   pageInfo.fFirstInPage = *itr - pageInfo.fNElements;
+   pageInfo.fPageNo = pageNo;
+   return pageInfo;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
 bool ROOT::Experimental::RClusterDescriptor::operator==(const RClusterDescriptor &other) const {
    return fClusterId == other.fClusterId &&
           fVersion == other.fVersion &&
@@ -694,6 +780,95 @@ ROOT::Experimental::RNTupleDescriptor::FindClusterId(DescriptorId_t columnId, NT
 }
 
 
+ROOT::Experimental::DescriptorId_t
+ROOT::Experimental::RNTupleDescriptor::FindNextClusterId(DescriptorId_t clusterId) const
+{
+   const auto &clusterDesc = GetClusterDescriptor(clusterId);
+   auto firstEntryInNextCluster = clusterDesc.GetFirstEntryIndex() + clusterDesc.GetNEntries();
+   // Clusters written by the page sinks are numbered sequentially, so that the next id is a good first guess
+   auto itr = fClusterDescriptors.find(clusterId + 1);
+   if ((itr != fClusterDescriptors.end()) && (itr->second.GetFirstEntryIndex() == firstEntryInNextCluster))
+      return itr->second.GetId();
+   for (const auto &cd : fClusterDescriptors) {
+      if (cd.second.GetFirstEntryIndex() == firstEntryInNextCluster)
+         return cd.second.GetId();
+   }
+   return kInvalidDescriptorId;
+}
+
+
+ROOT::Experimental::DescriptorId_t
+ROOT::Experimental::RNTupleDescriptor::FindPrevClusterId(DescriptorId_t clusterId) const
+{
+   const auto &clusterDesc = GetClusterDescriptor(clusterId);
+   if (clusterDesc.GetFirstEntryIndex() == 0)
+      return kInvalidDescriptorId;
+   auto itr = fClusterDescriptors.find(clusterId - 1);
+   if ((itr != fClusterDescriptors.end()) &&
+       (itr->second.GetFirstEntryIndex() + itr->second.GetNEntries() == clusterDesc.GetFirstEntryIndex()))
+   {
+      return itr->second.GetId();
+   }
+   for (const auto &cd : fClusterDescriptors) {
+      if (cd.second.GetFirstEntryIndex() + cd.second.GetNEntries() == clusterDesc.GetFirstEntryIndex())
+         return cd.second.GetId();
+   }
+   return kInvalidDescriptorId;
+}
+
+
+std::vector<std::pair<ROOT::Experimental::NTupleSize_t, ROOT::Experimental::NTupleSize_t>>
+ROOT::Experimental::RNTupleDescriptor::FindEntryRanges(DescriptorId_t fieldId, double min, double max) const
+{
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> result;
+   auto addRange = [&result](NTupleSize_t first, NTupleSize_t end) {
+      if (first == end)
+         return;
+      if (!result.empty() && (result.back().second == first)) {
+         result.back().second = end;
+         return;
+      }
+      result.emplace_back(first, end);
+   };
+
+   const auto columnId = FindColumnId(fieldId, 0);
+   const auto &fieldDesc = GetFieldDescriptor(fieldId);
+   // Only for top-level, non-repetitive fields, the column element index equals the entry index
+   const bool isEntryColumn = (fieldDesc.GetParentId() == FindFieldId("", kInvalidDescriptorId)) &&
+                              (fieldDesc.GetNRepetitions() == 0);
+
+   std::vector<const RClusterDescriptor *> clusters;
+   for (const auto &cd : fClusterDescriptors)
+      clusters.emplace_back(&cd.second);
+   std::sort(clusters.begin(), clusters.end(), [](const RClusterDescriptor *a, const RClusterDescriptor *b) {
+      return a->GetFirstEntryIndex() < b->GetFirstEntryIndex();
+   });
+
+   for (auto cluster : clusters) {
+      const auto firstEntry = cluster->GetFirstEntryIndex();
+      const auto endEntry = firstEntry + cluster->GetNEntries();
+      if (columnId == kInvalidDescriptorId) {
+         addRange(firstEntry, endEntry);
+         continue;
+      }
+      const auto &columnRange = cluster->GetColumnRange(columnId);
+      if (!columnRange.fStats.MayContain(min, max))
+         continue;
+      if (!isEntryColumn) {
+         addRange(firstEntry, endEntry);
+         continue;
+      }
+      auto firstInPage = columnRange.fFirstElementIndex;
+      for (const auto &pi : cluster->GetPageRange(columnId).fPageInfos) {
+         if (pi.fStats.MayContain(min, max))
+            addRange(firstInPage, firstInPage + pi.fNElements);
+         firstInPage += pi.fNElements;
+      }
+   }
+   return result;
+}
+
+
 std::unique_ptr<ROOT::Experimental::RNTupleModel> ROOT::Experimental::RNTupleDescriptor::GenerateModel() const
 {
    auto model = std::make_unique<RNTupleModel>();
@@ -804,7 +979,9 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
       pos += DeserializeUuid(pos, &uuid);
       R__ASSERT(uuid == fDescriptor.fOwnUuid);
       auto clusterBase = pos;
-      pos += DeserializeFrame(RClusterDescriptor::kFrameVersionCurrent, clusterBase, &frameSize);
+      std::uint16_t clusterVersion;
+      pos += DeserializeFrame(RClusterDescriptor::kFrameVersionCurrent, clusterBase, &frameSize, &clusterVersion);
+      const bool hasStats = (clusterVersion >= RClusterDescriptor::kFrameVersionColumnStats);
 
       std::uint64_t clusterId;
       RNTupleVersion version;
@@ -829,7 +1006,7 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
 
          RClusterDescriptor::RColumnRange columnRange;
          columnRange.fColumnId = columnId;
-         pos += DeserializeColumnRange(pos, &columnRange);
+         pos += DeserializeColumnRange(pos, &columnRange, hasStats);
          AddClusterColumnRange(clusterId, columnRange);
 
          RClusterDescriptor::RPageRange pageRange;
@@ -838,7 +1015,7 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
          pos += DeserializeUInt32(pos, &nPages);
          for (unsigned int k = 0; k < nPages; ++k) {
             RClusterDescriptor::RPageRange::RPageInfo pageInfo;
-            pos += DeserializePageInfo(pos, &pageInfo);
+            pos += DeserializePageInfo(pos, &pageInfo, hasStats);
             pageRange.fPageInfos.emplace_back(pageInfo);
          }
          AddClusterPageRange(clusterId, std::move(pageRange));
@@ -919,5 +1096,6 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClusterColumnRange(
 void ROOT::Experimental::RNTupleDescriptorBuilder::AddClusterPageRange(
    DescriptorId_t clusterId, RClusterDescriptor::RPageRange &&pageRange)
 {
+   pageRange.UpdateCumulativeNElements();
    fDescriptor.fClusterDescriptors[clusterId].fPageRanges.emplace(pageRange.fColumnId, std::move(pageRange));
 }
@@ -87,6 +87,16 @@ static std::string GetColumnTypeName(ROOT::Experimental::EColumnType type)
       return "Index";
    case ROOT::Experimental::EColumnType::kSwitch:
       return "Switch";
+   case ROOT::Experimental::EColumnType::kSplitIndex:
+      return "SplitIndex";
+   case ROOT::Experimental::EColumnType::kSplitReal64:
+      return "SplitReal64";
+   case ROOT::Experimental::EColumnType::kSplitReal32:
+      return "SplitReal32";
+   case ROOT::Experimental::EColumnType::kSplitInt64:
+      return "SplitInt64";
+   case ROOT::Experimental::EColumnType::kSplitInt32:
+      return "SplitInt32";
    default:
       return "UNKNOWN";
    }
@@ -113,7 +123,7 @@ void ROOT::Experimental::RNTupleDescriptor::PrintInfo(std::ostream &output) cons
    int compression = -1;
    for (const auto &column : fColumnDescriptors) {
       auto element = Detail::RColumnElementBase::Generate(column.second.GetModel().GetType());
-      auto elementSize = element.GetSize();
+      auto elementSize = element->GetSize();
 
       ColumnInfo info;
       info.fFieldId = column.second.GetFieldId();
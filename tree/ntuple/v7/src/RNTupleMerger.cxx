@@ -0,0 +1,168 @@
+/// \file RNTupleMerger.cxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <TError.h>
+
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+/// Recursively matches the sub fields of srcFieldId and dstFieldId by name and records the column id mapping
+void MapFieldColumns(const ROOT::Experimental::RNTupleDescriptor &srcDesc,
+                     ROOT::Experimental::DescriptorId_t srcFieldId,
+                     const ROOT::Experimental::RNTupleDescriptor &dstDesc,
+                     ROOT::Experimental::DescriptorId_t dstFieldId,
+                     std::vector<ROOT::Experimental::DescriptorId_t> &columnMap)
+{
+   using ROOT::Experimental::kInvalidDescriptorId;
+
+   const auto &srcField = srcDesc.GetFieldDescriptor(srcFieldId);
+   const auto &dstField = dstDesc.GetFieldDescriptor(dstFieldId);
+   if ((srcField.GetTypeName() != dstField.GetTypeName()) ||
+       (srcField.GetLinkIds().size() != dstField.GetLinkIds().size()))
+   {
+      throw std::runtime_error("RNTupleMerger: incompatible field " + srcField.GetFieldName());
+   }
+
+   for (std::uint32_t i = 0; ; ++i) {
+      auto srcColumnId = srcDesc.FindColumnId(srcFieldId, i);
+      auto dstColumnId = dstDesc.FindColumnId(dstFieldId, i);
+      if (srcColumnId == kInvalidDescriptorId && dstColumnId == kInvalidDescriptorId)
+         break;
+      if (srcColumnId == kInvalidDescriptorId || dstColumnId == kInvalidDescriptorId)
+         throw std::runtime_error("RNTupleMerger: incompatible columns of field " + srcField.GetFieldName());
+      const auto srcModel = srcDesc.GetColumnDescriptor(srcColumnId).GetModel();
+      const auto dstModel = dstDesc.GetColumnDescriptor(dstColumnId).GetModel();
+      if (!(srcModel == dstModel)) {
+         throw std::runtime_error("RNTupleMerger: incompatible columns of field " + srcField.GetFieldName());
+      }
+      columnMap[srcColumnId] = dstColumnId;
+   }
+
+   for (auto srcChildId : srcField.GetLinkIds()) {
+      const auto &srcChild = srcDesc.GetFieldDescriptor(srcChildId);
+      auto dstChildId = dstDesc.FindFieldId(srcChild.GetFieldName(), dstFieldId);
+      if (dstChildId == kInvalidDescriptorId)
+         throw std::runtime_error("RNTupleMerger: missing field " + srcChild.GetFieldName());
+      MapFieldColumns(srcDesc, srcChildId, dstDesc, dstChildId, columnMap);
+   }
+}
+
+} // anonymous namespace
+
+
+std::vector<ROOT::Experimental::DescriptorId_t>
+ROOT::Experimental::Detail::RNTupleMerger::MapColumns(const RPageSource &source, const RPageSink &destination)
+{
+   const auto &srcDesc = source.GetDescriptor();
+   const auto &dstDesc = destination.GetDescriptor();
+   if (srcDesc.GetNColumns() != dstDesc.GetNColumns())
+      throw std::runtime_error("RNTupleMerger: incompatible number of columns in " + srcDesc.GetName());
+
+   std::vector<DescriptorId_t> columnMap(srcDesc.GetNColumns(), kInvalidDescriptorId);
+   MapFieldColumns(srcDesc, srcDesc.FindFieldId("", kInvalidDescriptorId),
+                   dstDesc, dstDesc.FindFieldId("", kInvalidDescriptorId), columnMap);
+   return columnMap;
+}
+
+
+void ROOT::Experimental::Detail::RNTupleMerger::Merge(const std::vector<RPageSource *> &sources,
+                                                      RPageSink &destination)
+{
+   if (sources.empty())
+      return;
+
+   for (auto s : sources)
+      s->Attach();
+   // The model needs to stay alive until the destination is committed because its columns are connected to the sink
+   auto model = sources[0]->GetDescriptor().GenerateModel();
+   destination.Create(*model);
+
+   // Column and cluster ids are issued sequentially by the page sinks
+   struct RClusterJob {
+      RPageSource *fSource = nullptr;
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      const std::vector<DescriptorId_t> *fColumnMap = nullptr;
+   };
+   std::vector<std::vector<DescriptorId_t>> columnMaps;
+   std::vector<RClusterJob> jobs;
+   for (auto s : sources)
+      columnMaps.emplace_back(MapColumns(*s, destination));
+   for (unsigned int i = 0; i < sources.size(); ++i) {
+      for (DescriptorId_t clusterId = 0; clusterId < sources[i]->GetDescriptor().GetNClusters(); ++clusterId)
+         jobs.push_back({sources[i], clusterId, &columnMaps[i]});
+   }
+
+   auto fnLoadCluster = [](const RClusterJob &job) {
+      RCluster::ColumnSet_t columns;
+      for (DescriptorId_t i = 0; i < job.fColumnMap->size(); ++i)
+         columns.insert(i);
+      return job.fSource->LoadCluster(job.fClusterId, columns);
+   };
+
+   // Double buffering: the next cluster is read while the pages of the current cluster are written
+   std::future<std::unique_ptr<RCluster>> nextCluster;
+   if (!jobs.empty())
+      nextCluster = std::async(std::launch::async, fnLoadCluster, jobs[0]);
+   NTupleSize_t nEntries = 0;
+   for (unsigned int j = 0; j < jobs.size(); ++j) {
+      auto cluster = nextCluster.get();
+      if (j + 1 < jobs.size())
+         nextCluster = std::async(std::launch::async, fnLoadCluster, jobs[j + 1]);
+
+      const auto &clusterDesc = jobs[j].fSource->GetDescriptor().GetClusterDescriptor(jobs[j].fClusterId);
+      for (DescriptorId_t columnId = 0; columnId < jobs[j].fColumnMap->size(); ++columnId) {
+         // The pages are copied as they are, so the destination records the compression settings of the source
+         const auto compressionSettings = clusterDesc.GetColumnRange(columnId).fCompressionSettings;
+         const auto &pageRange = clusterDesc.GetPageRange(columnId);
+         for (NTupleSize_t pageNo = 0; pageNo < pageRange.fPageInfos.size(); ++pageNo) {
+            const auto &pageInfo = pageRange.fPageInfos[pageNo];
+            auto onDiskPage = cluster->GetOnDiskPage(ROnDiskPage::Key(columnId, pageNo));
+            R__ASSERT(onDiskPage != nullptr);
+            RPageStorage::RSealedPage sealedPage(onDiskPage->GetAddress(), onDiskPage->GetSize(),
+                                                 pageInfo.fNElements);
+            sealedPage.fStats = pageInfo.fStats;
+            sealedPage.fCompressionSettings = compressionSettings;
+            destination.CommitSealedPage((*jobs[j].fColumnMap)[columnId], sealedPage);
+         }
+      }
+      nEntries += clusterDesc.GetNEntries();
+      destination.CommitCluster(nEntries);
+   }
+   destination.CommitDataset();
+}
+
+
+void ROOT::Experimental::Detail::RNTupleMerger::Merge(std::string_view ntupleName,
+                                                      const std::vector<std::string> &inputPaths,
+                                                      std::string_view outputPath, const RNTupleWriteOptions &options)
+{
+   std::vector<std::unique_ptr<RPageSource>> sources;
+   std::vector<RPageSource *> sourcePtrs;
+   for (const auto &path : inputPaths) {
+      sources.emplace_back(RPageSource::Create(ntupleName, path));
+      sourcePtrs.emplace_back(sources.back().get());
+   }
+   auto destination = RPageSink::Create(ntupleName, outputPath, options);
+   Merge(sourcePtrs, *destination);
+}
@@ -35,6 +35,24 @@ bool ROOT::Experimental::Detail::RNTupleMetrics::Contains(const std::string &nam
    return false;
 }
 
+const ROOT::Experimental::Detail::RNTuplePerfCounter *
+ROOT::Experimental::Detail::RNTupleMetrics::GetCounter(const std::string &name) const
+{
+   for (const auto &c : fCounters) {
+      if (c->GetName() == name)
+         return c.get();
+   }
+   for (const auto m : fObservedMetrics) {
+      auto prefix = m->fName + kNamespaceSeperator;
+      if (name.compare(0, prefix.length(), prefix) == 0) {
+         auto counter = m->GetCounter(name.substr(prefix.length()));
+         if (counter)
+            return counter;
+      }
+   }
+   return nullptr;
+}
+
 void ROOT::Experimental::Detail::RNTupleMetrics::Print(std::ostream &output, const std::string &prefix) const
 {
    if (!fIsEnabled) {
@@ -19,60 +19,138 @@
 #include <TError.h>
 
 #include <cstdlib>
+#include <iterator>
+
+ROOT::Experimental::Detail::RPagePool::~RPagePool()
+{
+   for (auto buffer : fUnusedPages) {
+      auto &entry = fEntries.at(buffer);
+      entry.fDeleter(entry.fPage);
+   }
+}
 
 void ROOT::Experimental::Detail::RPagePool::RegisterPage(const RPage &page, const RPageDeleter &deleter)
 {
-   fPages.emplace_back(page);
-   fReferences.emplace_back(1);
-   fDeleters.emplace_back(deleter);
+   std::lock_guard<std::mutex> guard(fLock);
+
+   auto buffer = page.GetBuffer();
+   R__ASSERT(fEntries.count(buffer) == 0);
+   REntry entry;
+   entry.fPage = page;
+   entry.fDeleter = deleter;
+   entry.fRefCounter = 1;
+
+   auto columnId = entry.fPage.GetColumnId();
+   auto &columnPages = fColumnPages[columnId];
+   const auto &clusterInfo = page.GetClusterInfo();
+   auto clusterKey = std::make_pair(clusterInfo.GetId(), page.GetClusterRangeFirst());
+   if ((columnPages.fByGlobalIndex.count(page.GetGlobalRangeFirst()) == 0) &&
+       (columnPages.fByClusterIndex.count(clusterKey) == 0))
+   {
+      columnPages.fByGlobalIndex[page.GetGlobalRangeFirst()] = buffer;
+      columnPages.fByClusterIndex[clusterKey] = buffer;
+      entry.fIsIndexed = true;
+   }
+   fEntries.emplace(buffer, entry);
+}
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::AcquireEntry(REntry &entry)
+{
+   if (entry.fRefCounter == 0) {
+      fSzUnusedPages -= entry.fPage.GetCapacity();
+      fUnusedPages.erase(entry.fPosUnused);
+   }
+   entry.fRefCounter++;
+   return entry.fPage;
+}
+
+void ROOT::Experimental::Detail::RPagePool::ReleaseEntry(std::unordered_map<void *, REntry>::iterator itr)
+{
+   auto &entry = itr->second;
+   if (entry.fIsIndexed) {
+      auto &columnPages = fColumnPages.at(entry.fPage.GetColumnId());
+      columnPages.fByGlobalIndex.erase(entry.fPage.GetGlobalRangeFirst());
+      columnPages.fByClusterIndex.erase(
+         std::make_pair(entry.fPage.GetClusterInfo().GetId(), entry.fPage.GetClusterRangeFirst()));
+   }
+   entry.fDeleter(entry.fPage);
+   fEntries.erase(itr);
+}
+
+void ROOT::Experimental::Detail::RPagePool::EvictUnusedPages()
+{
+   while (fSzUnusedPages > fMemoryBudget) {
+      auto itr = fEntries.find(fUnusedPages.back());
+      R__ASSERT(itr != fEntries.end());
+      fSzUnusedPages -= itr->second.fPage.GetCapacity();
+      fUnusedPages.pop_back();
+      ReleaseEntry(itr);
+   }
 }
 
 void ROOT::Experimental::Detail::RPagePool::ReturnPage(const RPage& page)
 {
    if (page.IsNull()) return;
 
-   unsigned int N = fPages.size();
-   for (unsigned i = 0; i < N; ++i) {
-      if (fPages[i] != page) continue;
-
-      if (--fReferences[i] == 0) {
-         fDeleters[i](fPages[i]);
-         fPages[i] = fPages[N-1];
-         fReferences[i] = fReferences[N-1];
-         fDeleters[i] = fDeleters[N-1];
-         fPages.resize(N-1);
-         fReferences.resize(N-1);
-         fDeleters.resize(N-1);
-      }
+   std::lock_guard<std::mutex> guard(fLock);
+   auto itr = fEntries.find(page.GetBuffer());
+   R__ASSERT(itr != fEntries.end());
+   auto &entry = itr->second;
+   R__ASSERT(entry.fRefCounter > 0);
+   if (--entry.fRefCounter > 0)
+      return;
+
+   const auto szPage = entry.fPage.GetCapacity();
+   if (!entry.fIsIndexed || (szPage > fMemoryBudget)) {
+      ReleaseEntry(itr);
       return;
    }
-   R__ASSERT(false);
+   fUnusedPages.push_front(page.GetBuffer());
+   entry.fPosUnused = fUnusedPages.begin();
+   fSzUnusedPages += szPage;
+   EvictUnusedPages();
 }
 
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage(
    ColumnId_t columnId, NTupleSize_t globalIndex)
 {
-   unsigned int N = fPages.size();
-   for (unsigned int i = 0; i < N; ++i) {
-      if (fReferences[i] == 0) continue;
-      if (fPages[i].GetColumnId() != columnId) continue;
-      if (!fPages[i].Contains(globalIndex)) continue;
-      fReferences[i]++;
-      return fPages[i];
-   }
-   return RPage();
+   std::lock_guard<std::mutex> guard(fLock);
+   auto itrColumn = fColumnPages.find(columnId);
+   if (itrColumn == fColumnPages.end())
+      return RPage();
+
+   // The last page that starts at or before globalIndex
+   const auto &byGlobalIndex = itrColumn->second.fByGlobalIndex;
+   auto itrPage = byGlobalIndex.upper_bound(globalIndex);
+   if (itrPage == byGlobalIndex.begin())
+      return RPage();
+   auto &entry = fEntries.at(std::prev(itrPage)->second);
+   if (!entry.fPage.Contains(globalIndex))
+      return RPage();
+   return AcquireEntry(entry);
 }
 
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage(
    ColumnId_t columnId, const RClusterIndex &clusterIndex)
 {
-   unsigned int N = fPages.size();
-   for (unsigned int i = 0; i < N; ++i) {
-      if (fReferences[i] == 0) continue;
-      if (fPages[i].GetColumnId() != columnId) continue;
-      if (!fPages[i].Contains(clusterIndex)) continue;
-      fReferences[i]++;
-      return fPages[i];
-   }
-   return RPage();
+   std::lock_guard<std::mutex> guard(fLock);
+   auto itrColumn = fColumnPages.find(columnId);
+   if (itrColumn == fColumnPages.end())
+      return RPage();
+
+   const auto &byClusterIndex = itrColumn->second.fByClusterIndex;
+   auto itrPage = byClusterIndex.upper_bound(std::make_pair(clusterIndex.GetClusterId(), clusterIndex.GetIndex()));
+   if (itrPage == byClusterIndex.begin())
+      return RPage();
+   auto &entry = fEntries.at(std::prev(itrPage)->second);
+   if (!entry.fPage.Contains(clusterIndex))
+      return RPage();
+   return AcquireEntry(entry);
+}
+
+void ROOT::Experimental::Detail::RPagePool::SetMemoryBudget(std::size_t memoryBudget)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   fMemoryBudget = memoryBudget;
+   EvictUnusedPages();
 }
@@ -0,0 +1,122 @@
+/// \file RPageSinkBuf.cxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RColumn.hxx>
+#include <ROOT/RColumnElement.hxx>
+#include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RPageSinkBuf.hxx>
+#include <ROOT/RPageStorageFile.hxx>
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+
+ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::string_view ntupleName,
+   const RNTupleWriteOptions &options)
+   : RPageSink(ntupleName, options)
+   , fMetrics("RPageSinkBuf")
+   , fPageAllocator(std::make_unique<RPageAllocatorHeap>())
+{
+}
+
+
+ROOT::Experimental::Detail::RPageSinkBuf::~RPageSinkBuf()
+{
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkBuf::CreateImpl(const RNTupleModel & /* model */)
+{
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
+{
+   const auto element = columnHandle.fColumn->GetElement();
+   RBufferedPage bufferedPage;
+   bufferedPage.fColumnId = columnHandle.fId;
+   bufferedPage.fBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[GetPackedSize(page, *element)]);
+   bufferedPage.fSealedPage = SealPage(page, *element, fOptions.GetCompression(), bufferedPage.fBuffer.get());
+   fBufferedPages.emplace_back(std::move(bufferedPage));
+   // The pages get their locators when they are committed to the other sink
+   return RClusterDescriptor::RLocator();
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkBuf::CommitSealedPageImpl(DescriptorId_t columnId,
+                                                               const RSealedPage &sealedPage)
+{
+   RBufferedPage bufferedPage;
+   bufferedPage.fColumnId = columnId;
+   bufferedPage.fBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[sealedPage.fSize]);
+   memcpy(bufferedPage.fBuffer.get(), sealedPage.fBuffer, sealedPage.fSize);
+   bufferedPage.fSealedPage = RSealedPage(bufferedPage.fBuffer.get(), sealedPage.fSize, sealedPage.fNElements);
+   bufferedPage.fSealedPage.fStats = sealedPage.fStats;
+   bufferedPage.fSealedPage.fCompressionSettings = sealedPage.fCompressionSettings;
+   fBufferedPages.emplace_back(std::move(bufferedPage));
+   return RClusterDescriptor::RLocator();
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(NTupleSize_t /* nEntries */)
+{
+   return RClusterDescriptor::RLocator();
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkBuf::CommitDatasetImpl()
+{
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkBuf::CommitTo(RPageSink &other)
+{
+   // The page statistics were registered with the page ranges of this sink in the same order as the pages were
+   // buffered
+   std::vector<std::size_t> nCommittedPages(fOpenPageRanges.size(), 0);
+   for (auto &bufferedPage : fBufferedPages) {
+      const auto columnId = bufferedPage.fColumnId;
+      bufferedPage.fSealedPage.fStats = fOpenPageRanges[columnId].fPageInfos[nCommittedPages[columnId]++].fStats;
+      other.CommitSealedPage(columnId, bufferedPage.fSealedPage);
+   }
+   fBufferedPages.clear();
+
+   // The cluster is described by the other sink, this sink does not need to keep track of the page ranges
+   for (auto &range : fOpenColumnRanges) {
+      range.fFirstElementIndex += range.fNElements;
+      range.fNElements = 0;
+      range.fStats = RClusterDescriptor::RColumnStats();
+   }
+   for (auto &range : fOpenPageRanges)
+      range.fPageInfos.clear();
+}
+
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSinkBuf::ReservePage(ColumnHandle_t columnHandle, std::size_t nElements)
+{
+   if (nElements == 0)
+      nElements = RPageSinkFile::kDefaultElementsPerPage;
+   auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   return fPageAllocator->NewPage(columnHandle.fId, elementSize, nElements);
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkBuf::ReleasePage(RPage &page)
+{
+   fPageAllocator->DeletePage(page);
+}
@@ -16,8 +16,10 @@
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RColumn.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RStringView.hxx>
@@ -25,9 +27,35 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <stdexcept>
+#include <string>
 #include <unordered_map>
 #include <utility>
 
+namespace {
+
+/// The split encodings unpack into the same in-memory representation as the corresponding plain column types, so
+/// that a field can read both, e.g. data written before the split encodings became the default.
+ROOT::Experimental::EColumnType GetUnsplitColumnType(ROOT::Experimental::EColumnType type)
+{
+   using EColumnType = ROOT::Experimental::EColumnType;
+   switch (type) {
+   case EColumnType::kSplitIndex:
+      return EColumnType::kIndex;
+   case EColumnType::kSplitReal64:
+      return EColumnType::kReal64;
+   case EColumnType::kSplitReal32:
+      return EColumnType::kReal32;
+   case EColumnType::kSplitInt64:
+      return EColumnType::kInt64;
+   case EColumnType::kSplitInt32:
+      return EColumnType::kInt32;
+   default:
+      return type;
+   }
+}
+
+} // anonymous namespace
 
 ROOT::Experimental::Detail::RPageStorage::RPageStorage(std::string_view name) : fNTupleName(name)
 {
@@ -62,6 +90,12 @@ ROOT::Experimental::Detail::RPageSource::AddColumn(DescriptorId_t fieldId, const
    R__ASSERT(fieldId != kInvalidDescriptorId);
    auto columnId = fDescriptor.FindColumnId(fieldId, column.GetIndex());
    R__ASSERT(columnId != kInvalidDescriptorId);
+   const auto typeOnDisk = fDescriptor.GetColumnDescriptor(columnId).GetModel().GetType();
+   if (GetUnsplitColumnType(typeOnDisk) != GetUnsplitColumnType(column.GetModel().GetType())) {
+      throw std::runtime_error("RPageSource: incompatible on-disk type of column " + std::to_string(columnId) +
+                               " of " + fNTupleName);
+   }
+   fActiveColumns.emplace(columnId);
    return ColumnHandle_t(columnId, &column);
 }
 
@@ -81,6 +115,12 @@ ROOT::Experimental::ColumnId_t ROOT::Experimental::Detail::RPageSource::GetColum
    return columnHandle.fId;
 }
 
+void ROOT::Experimental::Detail::RPageSource::UnzipCluster(RCluster *cluster)
+{
+   if (fTaskScheduler)
+      UnzipClusterImpl(cluster);
+}
+
 
 //------------------------------------------------------------------------------
 
@@ -145,16 +185,78 @@ void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
 }
 
 
+void ROOT::Experimental::Detail::RPageSink::RegisterPage(
+   DescriptorId_t columnId, ClusterSize_t::ValueType nElements, const RClusterDescriptor::RLocator &locator,
+   const RClusterDescriptor::RColumnStats &stats, std::int64_t compressionSettings)
+{
+   auto &columnRange = fOpenColumnRanges[columnId];
+   auto &pageRange = fOpenPageRanges[columnId];
+   if (pageRange.fPageInfos.empty()) {
+      columnRange.fStats = stats;
+      columnRange.fCompressionSettings = compressionSettings;
+   } else {
+      columnRange.fStats.Merge(stats);
+      R__ASSERT(columnRange.fCompressionSettings == compressionSettings);
+   }
+   columnRange.fNElements += nElements;
+   RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+   pageInfo.fNElements = nElements;
+   pageInfo.fLocator = locator;
+   pageInfo.fStats = stats;
+   pageRange.fPageInfos.emplace_back(pageInfo);
+}
+
+
 void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHandle, const RPage &page)
 {
+   RClusterDescriptor::RColumnStats stats;
+   if (fOptions.GetColumnStats())
+      stats = GetPageStats(page, *columnHandle.fColumn->GetElement());
    auto locator = CommitPageImpl(columnHandle, page);
+   RegisterPage(columnHandle.fId, page.GetNElements(), locator, stats, fOptions.GetCompression());
+}
 
-   auto columnId = columnHandle.fId;
-   fOpenColumnRanges[columnId].fNElements += page.GetNElements();
-   RClusterDescriptor::RPageRange::RPageInfo pageInfo;
-   pageInfo.fNElements = page.GetNElements();
-   pageInfo.fLocator = locator;
-   fOpenPageRanges[columnId].fPageInfos.emplace_back(pageInfo);
+
+void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage)
+{
+   auto locator = CommitSealedPageImpl(columnId, sealedPage);
+   RegisterPage(columnId, sealedPage.fNElements, locator, sealedPage.fStats, sealedPage.fCompressionSettings);
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RColumnStats
+ROOT::Experimental::Detail::RPageSink::GetPageStats(const RPage &page, const RColumnElementBase &element)
+{
+   double min;
+   double max;
+   if (!element.GetValueRange(page.GetBuffer(), page.GetNElements(), &min, &max))
+      return RClusterDescriptor::RColumnStats();
+   return RClusterDescriptor::RColumnStats(min, max);
+}
+
+
+std::size_t ROOT::Experimental::Detail::RPageSink::GetPackedSize(const RPage &page, const RColumnElementBase &element)
+{
+   return (page.GetNElements() * element.GetBitsOnStorage() + 7) / 8;
+}
+
+
+ROOT::Experimental::Detail::RPageStorage::RSealedPage
+ROOT::Experimental::Detail::RPageSink::SealPage(const RPage &page, const RColumnElementBase &element,
+                                                int compressionSetting, void *buf)
+{
+   const auto packedBytes = GetPackedSize(page, element);
+   const void *packedBuffer = page.GetBuffer();
+   std::unique_ptr<unsigned char[]> packedCopy;
+   if (!element.IsMappable()) {
+      packedCopy = std::unique_ptr<unsigned char[]>(new unsigned char[packedBytes]);
+      element.Pack(packedCopy.get(), page.GetBuffer(), page.GetNElements());
+      packedBuffer = packedCopy.get();
+   }
+   const auto zippedBytes = RNTupleCompressor::Zip(packedBuffer, packedBytes, compressionSetting, buf);
+   RSealedPage sealedPage(buf, zippedBytes, page.GetNElements());
+   sealedPage.fCompressionSettings = compressionSetting;
+   return sealedPage;
 }
 
 
@@ -170,6 +272,8 @@ void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NT
       fDescriptorBuilder.AddClusterColumnRange(fLastClusterId, range);
       range.fFirstElementIndex += range.fNElements;
       range.fNElements = 0;
+      range.fStats = RClusterDescriptor::RColumnStats();
+      range.fCompressionSettings = fOptions.GetCompression();
    }
    for (auto &range : fOpenPageRanges) {
       RClusterDescriptor::RPageRange fullRange;
@@ -13,6 +13,9 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RClusterPool.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RLogger.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
@@ -30,8 +33,10 @@
 #include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <utility>
+#include <vector>
 
 
 ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntupleName, std::string_view path,
@@ -93,13 +98,58 @@ void ROOT::Experimental::Detail::RPageSinkFile::CreateImpl(const RNTupleModel &
 }
 
 
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkFile::WritePage(const void *buffer, std::size_t zippedBytes,
+                                                     std::size_t packedBytes)
+{
+   auto offsetData = fWriter->WriteBlob(buffer, zippedBytes, packedBytes);
+   fClusterMinOffset = std::min(offsetData, fClusterMinOffset);
+   fClusterMaxOffset = std::max(offsetData, fClusterMaxOffset);
+
+   RClusterDescriptor::RLocator result;
+   result.fPosition = offsetData;
+   result.fBytesOnStorage = zippedBytes;
+   return result;
+}
+
+
 ROOT::Experimental::RClusterDescriptor::RLocator
 ROOT::Experimental::Detail::RPageSinkFile::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
 {
+   auto element = columnHandle.fColumn->GetElement();
+
+   if (fTaskScheduler) {
+      // The column reuses the page buffer, so the task works on a copy. The locator is set in CommitClusterImpl().
+      RPendingPage pendingPage;
+      pendingPage.fColumnId = columnHandle.fId;
+      pendingPage.fPageIdx = fOpenPageRanges[columnHandle.fId].fPageInfos.size();
+      pendingPage.fBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[page.GetSize()]);
+      memcpy(pendingPage.fBuffer.get(), page.GetBuffer(), page.GetSize());
+      fPendingPages.emplace_back(std::move(pendingPage));
+
+      auto &item = fPendingPages.back();
+      const auto nElements = page.GetNElements();
+      const auto compression = fOptions.GetCompression();
+      fTaskScheduler->AddTask([&item, element, nElements, compression]() {
+         auto packedBytes = nElements * element->GetSize();
+         std::unique_ptr<unsigned char[]> packedBuffer;
+         if (element->IsMappable()) {
+            packedBuffer = std::move(item.fBuffer);
+         } else {
+            packedBytes = (nElements * element->GetBitsOnStorage() + 7) / 8;
+            packedBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[packedBytes]);
+            element->Pack(packedBuffer.get(), item.fBuffer.get(), nElements);
+         }
+         item.fBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[packedBytes]);
+         item.fPackedBytes = packedBytes;
+         item.fZippedBytes = RNTupleCompressor::Zip(packedBuffer.get(), packedBytes, compression, item.fBuffer.get());
+      });
+      return RClusterDescriptor::RLocator();
+   }
+
    unsigned char *buffer = reinterpret_cast<unsigned char *>(page.GetBuffer());
    bool isAdoptedBuffer = true;
    auto packedBytes = page.GetSize();
-   auto element = columnHandle.fColumn->GetElement();
    const auto isMappable = element->IsMappable();
 
    if (!isMappable) {
@@ -118,23 +168,46 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitPageImpl(ColumnHandle_t columnH
       isAdoptedBuffer = true;
    }
 
-   auto offsetData = fWriter->WriteBlob(buffer, zippedBytes, packedBytes);
-   fClusterMinOffset = std::min(offsetData, fClusterMinOffset);
-   fClusterMaxOffset = std::max(offsetData, fClusterMaxOffset);
+   auto result = WritePage(buffer, zippedBytes, packedBytes);
 
    if (!isAdoptedBuffer)
       delete[] buffer;
 
-   RClusterDescriptor::RLocator result;
-   result.fPosition = offsetData;
-   result.fBytesOnStorage = zippedBytes;
    return result;
 }
 
 
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageImpl(DescriptorId_t columnId,
+                                                                const RSealedPage &sealedPage)
+{
+   const auto &columnDesc = fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(columnId);
+   const auto element = RColumnElementBase::Generate(columnDesc.GetModel().GetType());
+   const auto packedBytes = (sealedPage.fNElements * element->GetBitsOnStorage() + 7) / 8;
+   return WritePage(sealedPage.fBuffer, sealedPage.fSize, packedBytes);
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkFile::WritePendingPages()
+{
+   if (!fTaskScheduler)
+      return;
+
+   fTaskScheduler->Wait();
+   for (const auto &item : fPendingPages) {
+      fOpenPageRanges[item.fColumnId].fPageInfos[item.fPageIdx].fLocator =
+         WritePage(item.fBuffer.get(), item.fZippedBytes, item.fPackedBytes);
+   }
+   fPendingPages.clear();
+   fTaskScheduler->Reset();
+}
+
+
 ROOT::Experimental::RClusterDescriptor::RLocator
 ROOT::Experimental::Detail::RPageSinkFile::CommitClusterImpl(ROOT::Experimental::NTupleSize_t /* nEntries */)
 {
+   WritePendingPages();
+
    RClusterDescriptor::RLocator result;
    result.fPosition = fClusterMinOffset;
    result.fBytesOnStorage = fClusterMaxOffset - fClusterMinOffset;
@@ -146,6 +219,8 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitClusterImpl(ROOT::Experimental:
 
 void ROOT::Experimental::Detail::RPageSinkFile::CommitDatasetImpl()
 {
+   R__ASSERT(fPendingPages.empty());
+
    const auto &descriptor = fDescriptorBuilder.GetDescriptor();
    auto szFooter = descriptor.SerializeFooter(nullptr);
    auto buffer = std::unique_ptr<unsigned char []>(new unsigned char[szFooter]);
@@ -196,13 +271,66 @@ void ROOT::Experimental::Detail::RPageAllocatorFile::DeletePage(const RPage& pag
 ////////////////////////////////////////////////////////////////////////////////
 
 
+ROOT::Experimental::Detail::RPageAllocatorMmap::RPageAllocatorMmap(std::unique_ptr<ROOT::Internal::RRawFile> file)
+   : fFile(std::move(file))
+{
+   fSize = fFile->GetSize();
+   if (fSize == 0)
+      return;
+   std::uint64_t mapdOffset;
+   fRegion = reinterpret_cast<unsigned char *>(fFile->Map(fSize, 0, mapdOffset));
+   R__ASSERT(mapdOffset == 0);
+}
+
+ROOT::Experimental::Detail::RPageAllocatorMmap::~RPageAllocatorMmap()
+{
+   if (fRegion)
+      fFile->Unmap(fRegion, fSize);
+}
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageAllocatorMmap::NewPage(
+   ColumnId_t columnId, std::uint64_t offset, std::size_t elementSize, std::size_t nElements)
+{
+   R__ASSERT(Contains(offset, elementSize * nElements));
+   // The mapping is read-only; pages from a page source are never written to
+   auto buffer = const_cast<unsigned char *>(GetAddress(offset));
+   RPage newPage(columnId, buffer, elementSize * nElements, elementSize);
+   newPage.TryGrow(nElements);
+   return newPage;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
 ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view ntupleName,
    const RNTupleReadOptions &options)
    : RPageSource(ntupleName, options)
    , fMetrics("RPageSourceFile")
    , fPageAllocator(std::make_unique<RPageAllocatorFile>())
-   , fPagePool(std::make_shared<RPagePool>())
+   , fPagePool(std::make_shared<RPagePool>(options.GetPageCacheBudget()))
 {
+   fCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nReadV", "", "number of vector read requests"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nRead", "", "number of byte ranges read"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szReadPayload", "B", "volume read from file (required)"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szReadOverhead", "B", "volume read from file (overhead)"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nClusterLoaded", "", "number of partial clusters loaded"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPagePopulated", "", "number of populated pages"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageUnzipped", "",
+                                                   "number of pages unzipped in parallel tasks"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageMapped", "",
+                                                   "number of pages used directly from the memory mapping"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallUnzip", "ns",
+                                                   "wall clock time spent decompressing and unpacking"),
+      *fMetrics.MakeCounter<RNTupleTickCounter<RNTupleAtomicCounter>*>("timeCpuUnzip", "ns",
+                                                                       "CPU time spent decompressing and unpacking")
+   });
+
+   if (options.GetClusterCache() != RNTupleReadOptions::EClusterCache::kOff) {
+      fClusterPool = std::make_unique<RClusterPool>(*this, options.GetClusterLookAhead());
+      fMetrics.ObserveMetrics(fClusterPool->GetMetrics());
+   }
 }
 
 
@@ -238,6 +366,12 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
    fDecompressor(zipBuffer.get(), fNTuple.fNBytesFooter, fNTuple.fLenFooter, buffer.get());
    descBuilder.AddClustersFromFooter(buffer.get());
 
+   if ((fOptions.GetMemoryMap() == RNTupleReadOptions::EMemoryMap::kOn) &&
+       (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap))
+   {
+      fMmapAllocator = std::make_shared<RPageAllocatorMmap>(fFile->Clone());
+   }
+
    return descBuilder.MoveDescriptor();
 }
 
@@ -249,50 +383,165 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
    const auto clusterId = clusterDescriptor.GetId();
    const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
 
-   // TODO(jblomer): binary search
-   RClusterDescriptor::RPageRange::RPageInfo pageInfo;
-   decltype(clusterIndex) firstInPage = 0;
-   for (const auto &pi : pageRange.fPageInfos) {
-      if (firstInPage + pi.fNElements > clusterIndex) {
-         pageInfo = pi;
-         break;
-      }
-      firstInPage += pi.fNElements;
-   }
+   const auto pageInfo = pageRange.Find(clusterIndex);
+   const auto firstInPage = pageInfo.fFirstInPage;
+   const auto pageNo = pageInfo.fPageNo;
    R__ASSERT(firstInPage <= clusterIndex);
    R__ASSERT((firstInPage + pageInfo.fNElements) > clusterIndex);
 
-   const auto element = columnHandle.fColumn->GetElement();
-   const auto elementSize = element->GetSize();
+   // Pages are unpacked according to the column type on disk, which can differ from the column type that the field
+   // would write, e.g. for data written before the split encodings became the default
+   const auto element = RColumnElementBase::Generate(fDescriptor.GetColumnDescriptor(columnId).GetModel().GetType());
+   const auto pageSize = pageInfo.fLocator.fBytesOnStorage;
+
+   RPage newPage;
+   auto deleter = RPageDeleter([](const RPage &page, void * /*userData*/)
+   {
+      RPageAllocatorFile::DeletePage(page);
+   }, nullptr);
+   if (CanMapPage(*element, pageInfo)) {
+      newPage = fMmapAllocator->NewPage(columnId, pageInfo.fLocator.fPosition, element->GetSize(),
+                                        pageInfo.fNElements);
+      // The deleter keeps the mapping alive as long as the page is in the page pool
+      deleter = RPageDeleter([mmapAllocator = fMmapAllocator](const RPage &page, void * /*userData*/)
+      {
+         RPageAllocatorMmap::DeletePage(page);
+      }, nullptr);
+      fCounters->fNPageMapped.Inc();
+   } else if (fClusterPool) {
+      auto cluster = fClusterPool->GetCluster(clusterId, fActiveColumns);
+      R__ASSERT(cluster->ContainsColumn(columnId));
+      const ROnDiskPage::Key key(columnId, pageNo);
+      // Pages unzipped by the I/O thread are used only once; if the page is requested again after it has been
+      // evicted from the page pool, it is unzipped again from the on-disk page
+      newPage = cluster->TakeUnzippedPage(key);
+      if (newPage.IsNull()) {
+         auto onDiskPage = cluster->GetOnDiskPage(key);
+         R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pageSize));
+         RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
+         newPage = UnzipPage(columnId, *element, onDiskPage->GetAddress(), pageSize, pageInfo.fNElements);
+      }
+   } else if (fMmapAllocator) {
+      R__ASSERT(fMmapAllocator->Contains(pageInfo.fLocator.fPosition, pageSize));
+      RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
+      newPage = UnzipPage(columnId, *element, fMmapAllocator->GetAddress(pageInfo.fLocator.fPosition), pageSize,
+                          pageInfo.fNElements);
+   } else {
+      auto onDiskBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[pageSize]);
+      fReader.ReadBuffer(onDiskBuffer.get(), pageSize, pageInfo.fLocator.fPosition);
+      fCounters->fNRead.Inc();
+      fCounters->fSzReadPayload.Add(pageSize);
+      RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
+      newPage = UnzipPage(columnId, *element, onDiskBuffer.get(), pageSize, pageInfo.fNElements);
+   }
+
+   const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
+   newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+   fPagePool->RegisterPage(newPage, deleter);
+   fCounters->fNPagePopulated.Inc();
+   return newPage;
+}
 
-   auto pageSize = pageInfo.fLocator.fBytesOnStorage;
-   auto pageBuffer = new unsigned char[
-      std::max(pageSize, static_cast<std::uint32_t>(elementSize * pageInfo.fNElements))];
-   fReader.ReadBuffer(pageBuffer, pageInfo.fLocator.fBytesOnStorage, pageInfo.fLocator.fPosition);
 
-   const auto bytesOnStorage = (element->GetBitsOnStorage() * pageInfo.fNElements + 7) / 8;
-   if (pageSize != bytesOnStorage) {
-      fDecompressor(pageBuffer, pageSize, bytesOnStorage);
-      pageSize = bytesOnStorage;
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::UnzipPage(
+   ColumnId_t columnId, const RColumnElementBase &element, const void *onDiskBuffer, std::size_t onDiskSize,
+   ClusterSize_t::ValueType nElements)
+{
+   const auto elementSize = element.GetSize();
+   const auto bytesPacked = (element.GetBitsOnStorage() * nElements + 7) / 8;
+   auto pageBuffer = new unsigned char[elementSize * nElements];
+
+   if (element.IsMappable()) {
+      fDecompressor(onDiskBuffer, onDiskSize, bytesPacked, pageBuffer);
+   } else {
+      auto packedBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesPacked]);
+      fDecompressor(onDiskBuffer, onDiskSize, bytesPacked, packedBuffer.get());
+      element.Unpack(pageBuffer, packedBuffer.get(), nElements);
    }
 
-   if (!element->IsMappable()) {
-      pageSize = elementSize * pageInfo.fNElements;
-      auto unpackedBuffer = new unsigned char[pageSize];
-      element->Unpack(unpackedBuffer, pageBuffer, pageInfo.fNElements);
-      delete[] pageBuffer;
-      pageBuffer = unpackedBuffer;
+   return RPageAllocatorFile::NewPage(columnId, pageBuffer, elementSize, nElements);
+}
+
+
+bool ROOT::Experimental::Detail::RPageSourceFile::CanMapPage(
+   const RColumnElementBase &element, const RClusterDescriptor::RPageRange::RPageInfo &pageInfo) const
+{
+   if (!fMmapAllocator || !element.IsMappable())
+      return false;
+   const auto elementSize = element.GetSize();
+   const auto nbytes = elementSize * pageInfo.fNElements;
+   // Compressed pages are always smaller than their uncompressed size. The mapping starts at a system page
+   // boundary, so an element-aligned file offset yields a properly aligned page buffer.
+   return (pageInfo.fLocator.fBytesOnStorage == nbytes) &&
+          (pageInfo.fLocator.fPosition % elementSize == 0) &&
+          fMmapAllocator->Contains(pageInfo.fLocator.fPosition, nbytes);
+}
+
+
+void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *cluster)
+{
+   RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
+
+   const auto clusterId = cluster->GetId();
+   const auto &clusterDescriptor = fDescriptor.GetClusterDescriptor(clusterId);
+
+   struct RUnzipItem {
+      RUnzipItem(DescriptorId_t c, NTupleSize_t p, NTupleSize_t f, const RColumnElementBase *e)
+         : fKey(c, p), fFirstInPage(f), fElement(e) {}
+      ROnDiskPage::Key fKey;
+      NTupleSize_t fFirstInPage;
+      const RColumnElementBase *fElement;
+      RPage fPage;
+   };
+
+   // One element per column for unpacking; the in-memory type is irrelevant for unpacking
+   std::vector<std::unique_ptr<RColumnElementBase>> allElements;
+   std::vector<RUnzipItem> unzipItems;
+   for (auto columnId : cluster->GetAvailColumns()) {
+      const auto &columnDesc = fDescriptor.GetColumnDescriptor(columnId);
+      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
+      NTupleSize_t pageNo = 0;
+      NTupleSize_t firstInPage = 0;
+      for (const auto &pi : pageRange.fPageInfos) {
+         // Mappable pages are not copied into the cluster; PopulatePage() uses them directly from the mapping
+         if (CanMapPage(*allElements.back(), pi)) {
+            firstInPage += pi.fNElements;
+            ++pageNo;
+            continue;
+         }
+         unzipItems.emplace_back(RUnzipItem(columnId, pageNo, firstInPage, allElements.back().get()));
+         firstInPage += pi.fNElements;
+         ++pageNo;
+      }
    }
 
-   const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
-   auto newPage = fPageAllocator->NewPage(columnId, pageBuffer, elementSize, pageInfo.fNElements);
-   newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
-   fPagePool->RegisterPage(newPage,
-      RPageDeleter([](const RPage &page, void * /*userData*/)
-      {
-         RPageAllocatorFile::DeletePage(page);
-      }, nullptr));
-   return newPage;
+   // Every task writes into its own, preallocated slot of unzipItems so that no locking is required
+   fTaskScheduler->Reset();
+   for (auto &item : unzipItems) {
+      const auto columnId = item.fKey.fColumnId;
+      const auto &pageInfo = clusterDescriptor.GetPageRange(columnId).fPageInfos[item.fKey.fPageNo];
+      const auto onDiskPage = cluster->GetOnDiskPage(item.fKey);
+      R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pageInfo.fLocator.fBytesOnStorage));
+      const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
+      const auto nElements = pageInfo.fNElements;
+
+      fTaskScheduler->AddTask([this, &item, onDiskPage, indexOffset, nElements, clusterId]() {
+         item.fPage = UnzipPage(item.fKey.fColumnId, *item.fElement, onDiskPage->GetAddress(),
+                                onDiskPage->GetSize(), nElements);
+         item.fPage.SetWindow(indexOffset + item.fFirstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+      });
+   }
+   fTaskScheduler->Wait();
+
+   for (const auto &item : unzipItems) {
+      cluster->AdoptUnzippedPage(item.fKey, item.fPage,
+         RPageDeleter([](const RPage &page, void * /*userData*/)
+         {
+            RPageAllocatorFile::DeletePage(page);
+         }, nullptr));
+   }
+   fCounters->fNPageUnzipped.Add(unzipItems.size());
 }
 
 
@@ -340,3 +589,107 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Det
    clone->fReader = Internal::RMiniFileReader(clone->fFile.get());
    return std::unique_ptr<RPageSourceFile>(clone);
 }
+
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+{
+   fCounters->fNClusterLoaded.Inc();
+
+   const auto &clusterDesc = GetDescriptor().GetClusterDescriptor(clusterId);
+   auto cluster = std::make_unique<RCluster>(clusterId);
+
+   struct ROnDiskPageLocator {
+      ROnDiskPageLocator() = default;
+      ROnDiskPageLocator(DescriptorId_t c, NTupleSize_t p, std::uint64_t o, std::uint64_t s)
+         : fColumnId(c), fPageNo(p), fOffset(o), fSize(s) {}
+      DescriptorId_t fColumnId = 0;
+      NTupleSize_t fPageNo = 0;
+      std::uint64_t fOffset = 0;
+      std::uint64_t fSize = 0;
+      /// The read request that covers this page
+      std::size_t fReqIdx = 0;
+      /// The position of the page within the buffer of the read request
+      std::size_t fReqOffset = 0;
+   };
+
+   // Collect the necessary page meta-data and sort the pages by file offset
+   std::vector<ROnDiskPageLocator> onDiskPages;
+   for (auto columnId : columns) {
+      const auto &pageRange = clusterDesc.GetPageRange(columnId);
+      NTupleSize_t pageNo = 0;
+      for (const auto &pageInfo : pageRange.fPageInfos) {
+         const auto &pageLocator = pageInfo.fLocator;
+         onDiskPages.emplace_back(ROnDiskPageLocator(
+            columnId, pageNo, pageLocator.fPosition, pageLocator.fBytesOnStorage));
+         ++pageNo;
+      }
+   }
+   std::sort(onDiskPages.begin(), onDiskPages.end(),
+      [](const ROnDiskPageLocator &a, const ROnDiskPageLocator &b) {return a.fOffset < b.fOffset;});
+
+   if (fMmapAllocator) {
+      // No I/O necessary, the on-disk pages point into the mapping, which outlives the clusters of the cluster pool
+      for (const auto &s : onDiskPages) {
+         R__ASSERT(fMmapAllocator->Contains(s.fOffset, s.fSize));
+         cluster->Register(ROnDiskPage::Key(s.fColumnId, s.fPageNo),
+                           ROnDiskPage(fMmapAllocator->GetAddress(s.fOffset), s.fSize));
+      }
+      for (auto columnId : columns)
+         cluster->SetColumnAvailable(columnId);
+      return cluster;
+   }
+
+   // Coalesce neighboring pages into larger read requests; small gaps between pages are read over
+   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+   std::size_t szPayload = 0;
+   std::size_t szBuffer = 0;
+   for (auto &s : onDiskPages) {
+      szPayload += s.fSize;
+      if (!readRequests.empty()) {
+         auto &req = readRequests.back();
+         const auto reqEnd = req.fOffset + req.fSize;
+         if ((s.fOffset >= reqEnd) && (s.fOffset - reqEnd <= kMaxReadGap)) {
+            s.fReqIdx = readRequests.size() - 1;
+            s.fReqOffset = s.fOffset - req.fOffset;
+            szBuffer += s.fOffset + s.fSize - reqEnd;
+            req.fSize = s.fOffset + s.fSize - req.fOffset;
+            continue;
+         }
+      }
+      ROOT::Internal::RRawFile::RIOVec req;
+      req.fOffset = s.fOffset;
+      req.fSize = s.fSize;
+      s.fReqIdx = readRequests.size();
+      s.fReqOffset = 0;
+      szBuffer += s.fSize;
+      readRequests.emplace_back(req);
+   }
+
+   if (!readRequests.empty()) {
+      auto buffer = std::unique_ptr<unsigned char[]>(new unsigned char[szBuffer]);
+      std::size_t bufPos = 0;
+      for (auto &req : readRequests) {
+         req.fBuffer = buffer.get() + bufPos;
+         bufPos += req.fSize;
+      }
+      fFile->ReadV(&readRequests[0], readRequests.size());
+      for (const auto &req : readRequests) {
+         R__ASSERT(req.fOutBytes == req.fSize);
+      }
+      fCounters->fNReadV.Inc();
+      fCounters->fNRead.Add(readRequests.size());
+      fCounters->fSzReadPayload.Add(szPayload);
+      fCounters->fSzReadOverhead.Add(szBuffer - szPayload);
+
+      for (const auto &s : onDiskPages) {
+         auto address = reinterpret_cast<unsigned char *>(readRequests[s.fReqIdx].fBuffer) + s.fReqOffset;
+         cluster->Register(ROnDiskPage::Key(s.fColumnId, s.fPageNo), ROnDiskPage(address, s.fSize));
+      }
+      cluster->AdoptMemory(std::move(buffer));
+   }
+
+   for (auto columnId : columns)
+      cluster->SetColumnAvailable(columnId);
+   return cluster;
+}
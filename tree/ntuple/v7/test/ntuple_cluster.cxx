@@ -0,0 +1,290 @@
+#include "ntuple_test.hxx"
+
+#include <algorithm>
+#include <mutex>
+
+namespace {
+
+/**
+ * A page source that describes a sequence of clusters and records the load requests issued by the cluster pool
+ */
+class RPageSourceMock : public RPageSource {
+protected:
+   RNTupleDescriptor AttachImpl() final { return RNTupleDescriptor(); }
+
+public:
+   /// Records the cluster ids requested by LoadCluster() calls
+   std::vector<DescriptorId_t> fReqsClusterIds;
+   std::vector<RCluster::ColumnSet_t> fReqsColumns;
+   std::mutex fLock;
+   RNTupleMetrics fMetrics;
+
+   RPageSourceMock(unsigned int nClusters) : RPageSource("test", RNTupleReadOptions()), fMetrics("test")
+   {
+      RNTupleDescriptorBuilder descBuilder;
+      for (unsigned int i = 0; i < nClusters; ++i) {
+         descBuilder.AddCluster(i, RNTupleVersion(), i * 10, ROOT::Experimental::ClusterSize_t(10));
+      }
+      fDescriptor = descBuilder.MoveDescriptor();
+   }
+   std::unique_ptr<RPageSource> Clone() const final { return nullptr; }
+   RPage PopulatePage(ColumnHandle_t, NTupleSize_t) final { return RPage(); }
+   RPage PopulatePage(ColumnHandle_t, const ROOT::Experimental::RClusterIndex &) final { return RPage(); }
+   void ReleasePage(RPage &) final {}
+   RNTupleMetrics &GetMetrics() final { return fMetrics; }
+
+   std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) final
+   {
+      {
+         std::lock_guard<std::mutex> guard(fLock);
+         fReqsClusterIds.emplace_back(clusterId);
+         fReqsColumns.emplace_back(columns);
+      }
+      auto cluster = std::make_unique<RCluster>(clusterId);
+      for (auto columnId : columns)
+         cluster->SetColumnAvailable(columnId);
+      return cluster;
+   }
+};
+
+} // anonymous namespace
+
+
+TEST(Cluster, Adopt)
+{
+   auto memory = std::unique_ptr<unsigned char[]>(new unsigned char[3]);
+   memory[0] = 'a'; memory[1] = 'b'; memory[2] = 'c';
+   const auto ptr = memory.get();
+
+   RCluster cluster(1);
+   cluster.AdoptMemory(std::move(memory));
+   cluster.Register(ROnDiskPage::Key(5, 0), ROnDiskPage(ptr, 1));
+   cluster.SetColumnAvailable(5);
+
+   RCluster other(1);
+   auto otherMemory = std::unique_ptr<unsigned char[]>(new unsigned char[2]);
+   const auto otherPtr = otherMemory.get();
+   other.AdoptMemory(std::move(otherMemory));
+   other.Register(ROnDiskPage::Key(6, 0), ROnDiskPage(otherPtr, 1));
+   other.Register(ROnDiskPage::Key(6, 1), ROnDiskPage(otherPtr + 1, 1));
+   other.SetColumnAvailable(6);
+
+   cluster.Adopt(std::move(other));
+   EXPECT_EQ(3U, cluster.GetNOnDiskPages());
+   EXPECT_TRUE(cluster.ContainsColumn(5));
+   EXPECT_TRUE(cluster.ContainsColumn(6));
+   EXPECT_FALSE(cluster.ContainsColumn(7));
+   EXPECT_EQ(nullptr, cluster.GetOnDiskPage(ROnDiskPage::Key(5, 1)));
+   auto onDiskPage = cluster.GetOnDiskPage(ROnDiskPage::Key(5, 0));
+   ASSERT_NE(nullptr, onDiskPage);
+   EXPECT_EQ('a', *reinterpret_cast<const unsigned char *>(onDiskPage->GetAddress()));
+   onDiskPage = cluster.GetOnDiskPage(ROnDiskPage::Key(6, 1));
+   ASSERT_NE(nullptr, onDiskPage);
+   EXPECT_EQ(otherPtr + 1, onDiskPage->GetAddress());
+}
+
+
+TEST(Cluster, UnzippedPages)
+{
+   unsigned int nDeleted = 0;
+   RPageDeleter deleter([](const RPage &page, void *userData) {
+      ++(*reinterpret_cast<unsigned int *>(userData));
+      delete[] reinterpret_cast<unsigned char *>(page.GetBuffer());
+   }, &nDeleted);
+
+   {
+      RCluster cluster(1);
+      cluster.AdoptUnzippedPage(ROnDiskPage::Key(5, 0), RPage(5, new unsigned char[4], 4, 1), deleter);
+      RCluster other(1);
+      other.AdoptUnzippedPage(ROnDiskPage::Key(6, 0), RPage(6, new unsigned char[4], 4, 1), deleter);
+      other.AdoptUnzippedPage(ROnDiskPage::Key(6, 1), RPage(6, new unsigned char[4], 4, 1), deleter);
+      cluster.Adopt(std::move(other));
+      EXPECT_EQ(3U, cluster.GetNUnzippedPages());
+      EXPECT_EQ(0U, other.GetNUnzippedPages());
+
+      EXPECT_TRUE(cluster.TakeUnzippedPage(ROnDiskPage::Key(5, 1)).IsNull());
+      auto page = cluster.TakeUnzippedPage(ROnDiskPage::Key(6, 1));
+      ASSERT_FALSE(page.IsNull());
+      EXPECT_EQ(6, page.GetColumnId());
+      EXPECT_EQ(2U, cluster.GetNUnzippedPages());
+      EXPECT_TRUE(cluster.TakeUnzippedPage(ROnDiskPage::Key(6, 1)).IsNull());
+      // The taken page is owned by the caller
+      deleter(page);
+      EXPECT_EQ(1U, nDeleted);
+   }
+   // The remaining pages are freed together with the cluster
+   EXPECT_EQ(3U, nDeleted);
+}
+
+
+TEST(ClusterPool, Windows)
+{
+   RPageSourceMock p1(6);
+   EXPECT_EQ(1U, p1.GetDescriptor().FindNextClusterId(0));
+   EXPECT_EQ(ROOT::Experimental::kInvalidDescriptorId, p1.GetDescriptor().FindNextClusterId(5));
+   EXPECT_EQ(ROOT::Experimental::kInvalidDescriptorId, p1.GetDescriptor().FindPrevClusterId(0));
+   EXPECT_EQ(2U, p1.GetDescriptor().FindPrevClusterId(3));
+
+   RClusterPool c1(p1, 0);
+   EXPECT_EQ(1U, c1.GetWindowPre());
+   EXPECT_EQ(1U, c1.GetWindowPost());
+   RClusterPool c2(p1, 3);
+   EXPECT_EQ(1U, c2.GetWindowPre());
+   EXPECT_EQ(4U, c2.GetWindowPost());
+}
+
+
+TEST(ClusterPool, GetCluster)
+{
+   RPageSourceMock p1(4);
+   RClusterPool c1(p1, 1);
+   p1.GetMetrics().ObserveMetrics(c1.GetMetrics());
+   p1.GetMetrics().Enable();
+
+   auto cluster = c1.GetCluster(0, {0});
+   EXPECT_EQ(0U, cluster->GetId());
+   EXPECT_TRUE(cluster->ContainsColumn(0));
+   cluster = c1.GetCluster(1, {0});
+   EXPECT_EQ(1U, cluster->GetId());
+   cluster = c1.GetCluster(2, {0});
+   EXPECT_EQ(2U, cluster->GetId());
+   cluster = c1.GetCluster(3, {0});
+   EXPECT_EQ(3U, cluster->GetId());
+
+   // Every cluster was loaded exactly once
+   {
+      std::lock_guard<std::mutex> guard(p1.fLock);
+      ASSERT_EQ(4U, p1.fReqsClusterIds.size());
+      std::sort(p1.fReqsClusterIds.begin(), p1.fReqsClusterIds.end());
+      for (unsigned int i = 0; i < 4; ++i)
+         EXPECT_EQ(i, p1.fReqsClusterIds[i]);
+   }
+
+   // Additional column, only the missing column is requested
+   cluster = c1.GetCluster(3, {0, 1});
+   EXPECT_TRUE(cluster->ContainsColumn(0));
+   EXPECT_TRUE(cluster->ContainsColumn(1));
+   {
+      std::lock_guard<std::mutex> guard(p1.fLock);
+      ASSERT_EQ(5U, p1.fReqsColumns.size());
+      EXPECT_EQ(3U, p1.fReqsClusterIds[4]);
+      EXPECT_EQ(1U, p1.fReqsColumns[4].size());
+      EXPECT_EQ(1U, p1.fReqsColumns[4].count(1));
+   }
+
+   auto ctrHit = dynamic_cast<const RNTupleAtomicCounter *>(p1.GetMetrics().GetCounter("RClusterPool.nClusterHit"));
+   auto ctrMiss = dynamic_cast<const RNTupleAtomicCounter *>(p1.GetMetrics().GetCounter("RClusterPool.nClusterMiss"));
+   ASSERT_NE(nullptr, ctrHit);
+   ASSERT_NE(nullptr, ctrMiss);
+   EXPECT_EQ(5, ctrHit->GetValue() + ctrMiss->GetValue());
+   EXPECT_LE(2, ctrMiss->GetValue());
+}
+
+
+TEST(ClusterPool, ReadNTuple)
+{
+   FileRaii fileGuard("test_ntuple_clusterpool.root");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrTracks = model->MakeField<std::vector<float>>("tracks");
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (unsigned int i = 0; i < 1000; ++i) {
+         *wrPt = i;
+         wrTracks->clear();
+         for (unsigned int j = 0; j < i % 5; ++j)
+            wrTracks->emplace_back(i + j);
+         ntuple->Fill();
+         if (i % 100 == 99)
+            ntuple->CommitCluster();
+      }
+   }
+
+   for (unsigned int lookAhead = 0; lookAhead < 3; ++lookAhead) {
+      for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOff, RNTupleReadOptions::EClusterCache::kOn}) {
+         RNTupleReadOptions options;
+         options.SetClusterCache(clusterCache);
+         options.SetClusterLookAhead(lookAhead);
+         auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath(), options);
+         ntuple->EnableMetrics();
+         EXPECT_EQ(10U, ntuple->GetDescriptor().GetNClusters());
+
+         auto viewPt = ntuple->GetView<float>("pt");
+         auto viewTracks = ntuple->GetView<std::vector<float>>("tracks");
+         for (auto i : ntuple->GetEntryRange()) {
+            EXPECT_EQ(static_cast<float>(i), viewPt(i));
+            ASSERT_EQ(i % 5, viewTracks(i).size());
+            for (unsigned int j = 0; j < i % 5; ++j)
+               EXPECT_EQ(static_cast<float>(i + j), viewTracks(i)[j]);
+         }
+
+         const auto &metrics = ntuple->GetMetrics();
+         auto ctrHit = metrics.GetCounter("RPageSourceFile.RClusterPool.nClusterHit");
+         if (clusterCache == RNTupleReadOptions::EClusterCache::kOff) {
+            EXPECT_EQ(nullptr, ctrHit);
+            continue;
+         }
+         ASSERT_NE(nullptr, ctrHit);
+         auto ctrLoaded =
+            dynamic_cast<const RNTupleAtomicCounter *>(metrics.GetCounter("RPageSourceFile.nClusterLoaded"));
+         ASSERT_NE(nullptr, ctrLoaded);
+         EXPECT_LE(10, ctrLoaded->GetValue());
+         auto ctrReadV = dynamic_cast<const RNTupleAtomicCounter *>(metrics.GetCounter("RPageSourceFile.nReadV"));
+         ASSERT_NE(nullptr, ctrReadV);
+         EXPECT_LE(10, ctrReadV->GetValue());
+      }
+   }
+}
+
+
+TEST(ClusterPool, UnzipCluster)
+{
+   FileRaii fileGuard("test_ntuple_clusterpool_unzip.root");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrFlags = model->MakeField<std::vector<bool>>("flags");
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (unsigned int i = 0; i < 1000; ++i) {
+         *wrPt = i;
+         wrFlags->clear();
+         for (unsigned int j = 0; j < i % 5; ++j)
+            wrFlags->emplace_back((i + j) % 2 == 0);
+         ntuple->Fill();
+         if (i % 100 == 99)
+            ntuple->CommitCluster();
+      }
+   }
+
+   RTaskSchedulerSequential taskScheduler;
+   {
+      auto source = RPageSource::Create("ntuple", fileGuard.GetPath());
+      source->SetTaskScheduler(&taskScheduler);
+      RNTupleReader ntuple(std::move(source));
+      ntuple.EnableMetrics();
+
+      auto viewPt = ntuple.GetView<float>("pt");
+      auto viewFlags = ntuple.GetView<std::vector<bool>>("flags");
+      for (auto i : ntuple.GetEntryRange()) {
+         EXPECT_EQ(static_cast<float>(i), viewPt(i));
+         auto flags = viewFlags(i);
+         ASSERT_EQ(i % 5, flags.size());
+         for (unsigned int j = 0; j < i % 5; ++j)
+            EXPECT_EQ((i + j) % 2 == 0, flags[j]);
+      }
+
+      const auto &metrics = ntuple.GetMetrics();
+      auto ctrUnzipped =
+         dynamic_cast<const RNTupleAtomicCounter *>(metrics.GetCounter("RPageSourceFile.nPageUnzipped"));
+      ASSERT_NE(nullptr, ctrUnzipped);
+      EXPECT_LT(0, ctrUnzipped->GetValue());
+      EXPECT_EQ(static_cast<std::int64_t>(taskScheduler.fNTasksRun), ctrUnzipped->GetValue());
+      auto ctrTimeWall =
+         dynamic_cast<const RNTupleAtomicCounter *>(metrics.GetCounter("RPageSourceFile.timeWallUnzip"));
+      ASSERT_NE(nullptr, ctrTimeWall);
+      EXPECT_LT(0, ctrTimeWall->GetValue());
+   }
+   EXPECT_LT(0U, taskScheduler.fNTasksRun);
+}
@@ -120,6 +120,152 @@ TEST(RNTuple, Descriptor)
    EXPECT_EQ(DescriptorId_t(1), reference.FindClusterId(3, 100));
    EXPECT_EQ(ROOT::Experimental::kInvalidDescriptorId, reference.FindClusterId(3, 40000));
 
+   for (const auto desc : {&reference, &reco.GetDescriptor()}) {
+      const auto &pageRange = desc->GetClusterDescriptor(0).GetPageRange(4);
+      auto pageInfoExt = pageRange.Find(0);
+      EXPECT_EQ(0U, pageInfoExt.fPageNo);
+      EXPECT_EQ(0U, pageInfoExt.fFirstInPage);
+      EXPECT_EQ(200U, pageInfoExt.fNElements);
+      pageInfoExt = pageRange.Find(199);
+      EXPECT_EQ(0U, pageInfoExt.fPageNo);
+      pageInfoExt = pageRange.Find(200);
+      EXPECT_EQ(1U, pageInfoExt.fPageNo);
+      EXPECT_EQ(200U, pageInfoExt.fFirstInPage);
+      EXPECT_EQ(100U, pageInfoExt.fNElements);
+      EXPECT_EQ(4096, pageInfoExt.fLocator.fPosition);
+      pageInfoExt = pageRange.Find(299);
+      EXPECT_EQ(1U, pageInfoExt.fPageNo);
+   }
+
    delete[] footerBuffer;
    delete[] headerBuffer;
 }
+
+namespace {
+
+std::uint32_t ReadUInt32(const unsigned char *bytes)
+{
+   return std::uint32_t(bytes[0]) + (std::uint32_t(bytes[1]) << 8) + (std::uint32_t(bytes[2]) << 16) +
+          (std::uint32_t(bytes[3]) << 24);
+}
+
+void WriteUInt32(std::uint32_t val, unsigned char *bytes)
+{
+   for (int i = 0; i < 4; ++i)
+      bytes[i] = (val >> (8 * i)) & 0xFF;
+}
+
+/// Rewrites a footer into the layout of cluster frame version 0, which has no column statistics
+std::vector<unsigned char> StripColumnStats(const unsigned char *footer, std::uint32_t szFooter)
+{
+   const std::uint32_t kNBytesStats = 20;
+   std::vector<unsigned char> result;
+   auto pos = footer;
+   auto copy = [&](std::uint32_t nbytes) {
+      result.insert(result.end(), pos, pos + nbytes);
+      pos += nbytes;
+   };
+
+   copy(8 + 8); // ntuple frame, reserved word
+   const std::uint64_t nClusters = ReadUInt32(pos);
+   copy(8);
+   for (std::uint64_t i = 0; i < nClusters; ++i) {
+      copy(ReadUInt32(pos + 4)); // uuid frame
+      const auto clusterFrame = result.size();
+      copy(ReadUInt32(pos + 4));
+      result[clusterFrame] = 0; // frame version 0
+      result[clusterFrame + 1] = 0;
+      const auto nColumns = ReadUInt32(pos);
+      copy(4);
+      for (std::uint32_t j = 0; j < nColumns; ++j) {
+         copy(8 + 20); // column id, column range
+         pos += kNBytesStats;
+         const auto nPages = ReadUInt32(pos);
+         copy(4);
+         for (std::uint32_t k = 0; k < nPages; ++k) {
+            copy(4 + 12 + 4 + ReadUInt32(pos + 4 + 12)); // number of elements, locator
+            pos += kNBytesStats;
+         }
+      }
+   }
+   copy(footer + szFooter - pos); // postscript and checksum
+
+   WriteUInt32(result.size(), &result[result.size() - 8]);
+   auto checksum = R__crc32(0, nullptr, 0);
+   checksum = R__crc32(checksum, result.data(), result.size() - 4);
+   WriteUInt32(checksum, &result[result.size() - 4]);
+   return result;
+}
+
+} // anonymous namespace
+
+TEST(RNTuple, DescriptorColumnStats)
+{
+   RNTupleDescriptorBuilder descBuilder;
+   descBuilder.SetNTuple("MyTuple", "", "", RNTupleVersion(), ROOT::Experimental::RNTupleUuid());
+   descBuilder.AddField(0, RNTupleVersion(), RNTupleVersion(), "", "", 0, ENTupleStructure::kRecord);
+   descBuilder.AddField(1, RNTupleVersion(), RNTupleVersion(), "pt", "float", 0, ENTupleStructure::kLeaf);
+   descBuilder.AddFieldLink(0, 1);
+   descBuilder.AddColumn(2, 1, RNTupleVersion(), RColumnModel(EColumnType::kReal32, false), 0);
+
+   descBuilder.AddCluster(0, RNTupleVersion(), 0, ROOT::Experimental::ClusterSize_t(100));
+   ROOT::Experimental::RClusterDescriptor::RColumnRange columnRange;
+   columnRange.fColumnId = 2;
+   columnRange.fFirstElementIndex = 0;
+   columnRange.fNElements = 100;
+   columnRange.fStats = ROOT::Experimental::RClusterDescriptor::RColumnStats(1.0, 4.0);
+   descBuilder.AddClusterColumnRange(0, columnRange);
+   ROOT::Experimental::RClusterDescriptor::RPageRange pageRange;
+   pageRange.fColumnId = 2;
+   ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+   pageInfo.fNElements = 40;
+   pageInfo.fLocator.fPosition = 0;
+   pageInfo.fLocator.fUrl = "page";
+   pageInfo.fStats = ROOT::Experimental::RClusterDescriptor::RColumnStats(1.0, 2.0);
+   pageRange.fPageInfos.emplace_back(pageInfo);
+   pageInfo.fNElements = 60;
+   pageInfo.fLocator.fPosition = 1024;
+   pageInfo.fStats = ROOT::Experimental::RClusterDescriptor::RColumnStats(3.0, 4.0);
+   pageRange.fPageInfos.emplace_back(pageInfo);
+   descBuilder.AddClusterPageRange(0, std::move(pageRange));
+
+   const auto &reference = descBuilder.GetDescriptor();
+   std::vector<unsigned char> header(reference.SerializeHeader(nullptr));
+   reference.SerializeHeader(header.data());
+   std::vector<unsigned char> footer(reference.SerializeFooter(nullptr));
+   reference.SerializeFooter(footer.data());
+
+   RNTupleDescriptorBuilder reco;
+   reco.SetFromHeader(header.data());
+   reco.AddClustersFromFooter(footer.data());
+   EXPECT_EQ(reference, reco.GetDescriptor());
+
+   // A footer written before the column statistics were introduced
+   auto oldFooter = StripColumnStats(footer.data(), footer.size());
+   ASSERT_EQ(footer.size() - 3 * 20, oldFooter.size());
+   std::uint32_t szPsHeader;
+   std::uint32_t szPsFooter;
+   RNTupleDescriptor::LocateMetadata(
+      oldFooter.data() + oldFooter.size() - RNTupleDescriptor::kNBytesPostscript, szPsHeader, szPsFooter);
+   EXPECT_EQ(header.size(), szPsHeader);
+   EXPECT_EQ(oldFooter.size(), szPsFooter);
+
+   RNTupleDescriptorBuilder recoOld;
+   recoOld.SetFromHeader(header.data());
+   recoOld.AddClustersFromFooter(oldFooter.data());
+   const auto &clusterDesc = recoOld.GetDescriptor().GetClusterDescriptor(0);
+   EXPECT_EQ(100U, clusterDesc.GetNEntries());
+   const auto &oldColumnRange = clusterDesc.GetColumnRange(2);
+   EXPECT_EQ(0U, oldColumnRange.fFirstElementIndex);
+   EXPECT_EQ(100U, oldColumnRange.fNElements);
+   EXPECT_FALSE(oldColumnRange.fStats.fHasRange);
+   const auto &oldPageRange = clusterDesc.GetPageRange(2);
+   ASSERT_EQ(2U, oldPageRange.fPageInfos.size());
+   EXPECT_EQ(40U, oldPageRange.fPageInfos[0].fNElements);
+   EXPECT_EQ("page", oldPageRange.fPageInfos[0].fLocator.fUrl);
+   EXPECT_EQ(60U, oldPageRange.fPageInfos[1].fNElements);
+   EXPECT_EQ(1024, oldPageRange.fPageInfos[1].fLocator.fPosition);
+   EXPECT_FALSE(oldPageRange.fPageInfos[1].fStats.fHasRange);
+   // Without statistics, no entry range can be excluded
+   EXPECT_TRUE(oldColumnRange.fStats.MayContain(100.0, 200.0));
+}
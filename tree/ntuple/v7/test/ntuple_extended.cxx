@@ -65,6 +65,43 @@ TEST(RNTuple, RealWorld1)
    EXPECT_EQ(chksumRead, chksumWrite);
 }
 
+TEST(RNTuple, RandomAccess)
+{
+   // Sparse random access into a single cluster with many pages, as for instance done by event index lookups
+   FileRaii fileGuard("test_ntuple_random_access.root");
+
+   auto modelWrite = RNTupleModel::Create();
+   auto wrValue = modelWrite->MakeField<std::int32_t>("value", 777);
+   constexpr unsigned int nEvents = 1000000;
+   {
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(modelWrite), "myNTuple", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < nEvents; ++i) {
+         *wrValue = i;
+         ntuple->Fill();
+      }
+   }
+
+   RNTupleReadOptions options;
+   options.SetClusterCache(RNTupleReadOptions::EClusterCache::kOff);
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath(), options);
+   EXPECT_EQ(1U, ntuple->GetDescriptor().GetNClusters());
+   EXPECT_LT(50U, ntuple->GetDescriptor().GetClusterDescriptor(0).GetPageRange(0).fPageInfos.size());
+   auto viewValue = ntuple->GetView<std::int32_t>("value");
+
+   TRandom3 rnd(42);
+   std::int64_t sum = 0;
+   std::int64_t expected = 0;
+   for (unsigned int i = 0; i < 10000; ++i) {
+      auto entryId = static_cast<NTupleSize_t>(floor(rnd.Rndm() * nEvents));
+      sum += viewValue(entryId);
+      expected += entryId;
+   }
+   EXPECT_EQ(expected, sum);
+}
+
+
 #if !defined(_MSC_VER) || defined(R__ENABLE_BROKEN_WIN_TESTS)
 TEST(RNTuple, LargeFile)
 {
@@ -1,5 +1,7 @@
 #include "ntuple_test.hxx"
 
+#include <limits>
+
 TEST(Packing, Bitfield)
 {
    ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit> element(nullptr);
@@ -32,3 +34,81 @@ TEST(Packing, Bitfield)
       EXPECT_EQ(b9[i], e9[i]);
    }
 }
+
+TEST(Packing, SplitIndex)
+{
+   ROOT::Experimental::Detail::RColumnElement<ClusterSize_t, EColumnType::kSplitIndex> element(nullptr);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   std::vector<ClusterSize_t> offsets;
+   for (std::uint32_t i = 0; i < 100; ++i)
+      offsets.emplace_back(ClusterSize_t(i * 3 + (i % 7)));
+   // A non-monotonic value needs a negative delta
+   offsets[50] = ClusterSize_t(0);
+   unsigned char packed[400];
+   element.Pack(packed, offsets.data(), offsets.size());
+   // Small deltas only populate the least significant byte plane
+   for (unsigned i = 100; i < 400; ++i) {
+      if ((i == 150) || (i == 151))
+         continue;
+      EXPECT_EQ(0U, packed[i]);
+   }
+   std::vector<ClusterSize_t> unpacked(offsets.size());
+   element.Unpack(unpacked.data(), packed, offsets.size());
+   for (unsigned i = 0; i < offsets.size(); ++i)
+      EXPECT_EQ(offsets[i], unpacked[i]);
+}
+
+TEST(Packing, SplitInt)
+{
+   ROOT::Experimental::Detail::RColumnElement<std::int64_t, EColumnType::kSplitInt64> element(nullptr);
+   std::int64_t values[] = {0, -1, 1, -2, std::numeric_limits<std::int64_t>::min(),
+                            std::numeric_limits<std::int64_t>::max()};
+   unsigned char packed[sizeof(values)];
+   element.Pack(packed, values, 6);
+   // Zigzag encoding: 0, -1, 1, -2 --> 0, 1, 2, 3 in the least significant byte plane
+   for (unsigned i = 0; i < 4; ++i)
+      EXPECT_EQ(i, packed[i]);
+   std::int64_t unpacked[6];
+   element.Unpack(unpacked, packed, 6);
+   for (unsigned i = 0; i < 6; ++i)
+      EXPECT_EQ(values[i], unpacked[i]);
+
+   // Signed and unsigned integers share the on-disk format
+   ROOT::Experimental::Detail::RColumnElement<std::uint32_t, EColumnType::kSplitInt32> elementU32(nullptr);
+   ROOT::Experimental::Detail::RColumnElement<std::int32_t, EColumnType::kSplitInt32> elementI32(nullptr);
+   std::uint32_t valuesU32[] = {0, 1, 0xFFFFFFFF, 0x80000000};
+   unsigned char packedU32[sizeof(valuesU32)];
+   elementU32.Pack(packedU32, valuesU32, 4);
+   std::int32_t unpackedI32[4];
+   elementI32.Unpack(unpackedI32, packedU32, 4);
+   EXPECT_EQ(0, unpackedI32[0]);
+   EXPECT_EQ(1, unpackedI32[1]);
+   EXPECT_EQ(-1, unpackedI32[2]);
+   EXPECT_EQ(std::numeric_limits<std::int32_t>::min(), unpackedI32[3]);
+}
+
+TEST(Packing, SplitReal)
+{
+   ROOT::Experimental::Detail::RColumnElement<double, EColumnType::kSplitReal64> element(nullptr);
+   double values[] = {1.0, -2.5, 3e300, std::numeric_limits<double>::denorm_min()};
+   unsigned char packed[sizeof(values)];
+   element.Pack(packed, values, 4);
+   double unpacked[4];
+   element.Unpack(unpacked, packed, 4);
+   for (unsigned i = 0; i < 4; ++i)
+      EXPECT_EQ(values[i], unpacked[i]);
+
+   ROOT::Experimental::Detail::RColumnElement<float, EColumnType::kSplitReal32> elementFloat(nullptr);
+   float valuesFloat[] = {1.0, 2.0, 3.0};
+   unsigned char packedFloat[sizeof(valuesFloat)];
+   elementFloat.Pack(packedFloat, valuesFloat, 3);
+   // The least significant bytes of the mantissa come first
+   for (unsigned i = 0; i < 3; ++i)
+      EXPECT_EQ(0U, packedFloat[i]);
+   float unpackedFloat[3];
+   elementFloat.Unpack(unpackedFloat, packedFloat, 3);
+   for (unsigned i = 0; i < 3; ++i)
+      EXPECT_EQ(valuesFloat[i], unpackedFloat[i]);
+}
@@ -1,5 +1,9 @@
 #include "ntuple_test.hxx"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 TEST(Pages, Allocation)
 {
    RPageAllocatorHeap allocator;
@@ -55,3 +59,123 @@ TEST(Pages, Pool)
    page = pool.GetPage(1, 55);
    EXPECT_TRUE(page.IsNull());
 }
+
+TEST(Pages, PoolIndex)
+{
+   RPagePool pool;
+   unsigned int nCallDeleter = 0;
+   RPageDeleter deleter([&nCallDeleter](const RPage & /*page*/, void * /*userData*/) { nCallDeleter++; });
+
+   // Three consecutive pages of 10 elements each for two columns, spread over two clusters
+   unsigned char buffers[6][10];
+   std::vector<RPage> pages;
+   for (unsigned int i = 0; i < 6; ++i) {
+      const auto columnId = i / 3;
+      const auto pageNo = i % 3;
+      const auto clusterId = (pageNo < 2) ? 0 : 1;
+      const NTupleSize_t indexOffset = (pageNo < 2) ? 0 : 20;
+      RPage page(columnId, buffers[i], 10, 1);
+      page.TryGrow(10);
+      page.SetWindow(10 * pageNo, RPage::RClusterInfo(clusterId, indexOffset));
+      pool.RegisterPage(page, deleter);
+      pages.emplace_back(page);
+   }
+
+   for (unsigned int i = 0; i < 6; ++i) {
+      const auto columnId = i / 3;
+      const auto pageNo = i % 3;
+      for (NTupleSize_t idx = 10 * pageNo; idx < 10 * (pageNo + 1); idx += 3) {
+         auto page = pool.GetPage(columnId, idx);
+         EXPECT_EQ(pages[i], page);
+         pool.ReturnPage(page);
+      }
+   }
+   EXPECT_TRUE(pool.GetPage(0, 30).IsNull());
+   EXPECT_TRUE(pool.GetPage(2, 0).IsNull());
+   EXPECT_EQ(pages[1], pool.GetPage(0, ROOT::Experimental::RClusterIndex(0, 15)));
+   EXPECT_EQ(pages[5], pool.GetPage(1, ROOT::Experimental::RClusterIndex(1, 9)));
+   EXPECT_TRUE(pool.GetPage(1, ROOT::Experimental::RClusterIndex(1, 10)).IsNull());
+   EXPECT_TRUE(pool.GetPage(1, ROOT::Experimental::RClusterIndex(2, 0)).IsNull());
+   pool.ReturnPage(pages[1]);
+   pool.ReturnPage(pages[5]);
+   EXPECT_EQ(0U, nCallDeleter);
+
+   for (const auto &page : pages)
+      pool.ReturnPage(page);
+   EXPECT_EQ(6U, nCallDeleter);
+   EXPECT_TRUE(pool.GetPage(0, 0).IsNull());
+}
+
+TEST(Pages, PoolBudget)
+{
+   unsigned int nCallDeleter = 0;
+   RPageDeleter deleter([&nCallDeleter](const RPage & /*page*/, void * /*userData*/) { nCallDeleter++; });
+   unsigned char buffers[3][10];
+   std::vector<RPage> pages;
+   for (unsigned int i = 0; i < 3; ++i) {
+      RPage page(0, buffers[i], 10, 1);
+      page.TryGrow(10);
+      page.SetWindow(10 * i, RPage::RClusterInfo(0, 0));
+      pages.emplace_back(page);
+   }
+
+   {
+      // Room for two unused pages
+      RPagePool pool(20);
+      for (const auto &page : pages)
+         pool.RegisterPage(page, deleter);
+      pool.ReturnPage(pages[0]);
+      pool.ReturnPage(pages[1]);
+      EXPECT_EQ(0U, nCallDeleter);
+
+      // Unused pages can be found again
+      auto page = pool.GetPage(0, 5);
+      EXPECT_EQ(pages[0], page);
+      pool.ReturnPage(page);
+
+      // Page 1 is the least recently used one
+      pool.ReturnPage(pages[2]);
+      EXPECT_EQ(1U, nCallDeleter);
+      EXPECT_TRUE(pool.GetPage(0, 15).IsNull());
+      page = pool.GetPage(0, 25);
+      EXPECT_EQ(pages[2], page);
+      pool.ReturnPage(page);
+
+      pool.SetMemoryBudget(10);
+      EXPECT_EQ(2U, nCallDeleter);
+      EXPECT_TRUE(pool.GetPage(0, 5).IsNull());
+   }
+   // Unused pages are released with the pool
+   EXPECT_EQ(3U, nCallDeleter);
+}
+
+TEST(Pages, PoolConcurrent)
+{
+   RPagePool pool(1000);
+   std::atomic<unsigned int> nCallDeleter(0);
+   RPageDeleter deleter([&nCallDeleter](const RPage & /*page*/, void * /*userData*/) { nCallDeleter++; });
+   unsigned char buffers[10][10];
+   for (unsigned int i = 0; i < 10; ++i) {
+      RPage page(0, buffers[i], 10, 1);
+      page.TryGrow(10);
+      page.SetWindow(10 * i, RPage::RClusterInfo(0, 0));
+      pool.RegisterPage(page, deleter);
+      pool.ReturnPage(page);
+   }
+
+   std::vector<std::thread> threads;
+   for (unsigned int t = 0; t < 4; ++t) {
+      threads.emplace_back([&pool]() {
+         for (unsigned int n = 0; n < 10000; ++n) {
+            auto page = pool.GetPage(0, n % 100);
+            EXPECT_FALSE(page.IsNull());
+            pool.ReturnPage(page);
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+   EXPECT_EQ(0U, nCallDeleter);
+   pool.SetMemoryBudget(0);
+   EXPECT_EQ(10U, nCallDeleter);
+}
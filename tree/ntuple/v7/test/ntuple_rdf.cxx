@@ -27,3 +27,50 @@ TEST(RNTuple, RDF)
    auto rdf = ROOT::Experimental::MakeNTupleDataFrame("myNTuple", fileGuard.GetPath());
    EXPECT_EQ(42.0, *rdf.Min("pt"));
 }
+
+
+TEST(RNTuple, RDFEntryRanges)
+{
+   FileRaii fileGuard("test_ntuple_rdf_ranges.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (unsigned int i = 0; i < 1000; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+         if (i % 10 == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   ROOT::Experimental::RNTupleDS ds(RNTupleReader::Open("ntuple", fileGuard.GetPath()));
+   ds.SetNSlots(2);
+   ds.Initialise();
+   auto ranges = ds.GetEntryRanges();
+   // 100 clusters of 10 entries are grouped into 20 tasks (10 per slot) of 5 clusters each
+   ASSERT_EQ(20U, ranges.size());
+   ULong64_t expectedStart = 0;
+   for (const auto &r : ranges) {
+      EXPECT_EQ(expectedStart, r.first);
+      EXPECT_EQ(0U, r.first % 10);
+      EXPECT_EQ(0U, r.second % 10);
+      expectedStart = r.second;
+   }
+   EXPECT_EQ(1000U, expectedStart);
+   EXPECT_TRUE(ds.GetEntryRanges().empty());
+
+   // The ranges of the range filter are split into clusters, too; there are too few entries for grouping
+   ds.SetRangeFilter("pt", 15, 34);
+   ds.Initialise();
+   ranges = ds.GetEntryRanges();
+   ASSERT_EQ(3U, ranges.size());
+   for (unsigned int i = 0; i < 3; ++i) {
+      EXPECT_EQ(10U * (i + 1), ranges[i].first);
+      EXPECT_EQ(10U * (i + 2), ranges[i].second);
+   }
+
+   auto rdf = ROOT::Experimental::MakeNTupleDataFrame("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(1000U, *rdf.Count());
+   EXPECT_EQ(999.0, *rdf.Max("pt"));
+}
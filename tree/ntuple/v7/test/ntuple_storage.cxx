@@ -70,3 +70,345 @@ TEST(RNTuple, Extended)
    }
    EXPECT_EQ(chksumRead, chksumWrite);
 }
+
+TEST(RPageSinkFile, ParallelZip)
+{
+   // File names of the same length so that the file layouts can be compared
+   FileRaii fileGuardSerial("test_ntuple_zip_serial.root");
+   FileRaii fileGuardParallel("test_ntuple_zip_thread.root");
+
+   RTaskSchedulerSequential taskScheduler;
+   for (const auto &path : {fileGuardSerial.GetPath(), fileGuardParallel.GetPath()}) {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrFlags = model->MakeField<std::vector<bool>>("flags");
+
+      auto sink = std::make_unique<RPageSinkFile>("ntuple", path, RNTupleWriteOptions());
+      if (path == fileGuardParallel.GetPath())
+         sink->SetTaskScheduler(&taskScheduler);
+      RNTupleWriter ntuple(std::move(model), std::move(sink));
+      for (unsigned int i = 0; i < 50000; ++i) {
+         *wrPt = i;
+         wrFlags->clear();
+         for (unsigned int j = 0; j < i % 5; ++j)
+            wrFlags->emplace_back((i + j) % 3 == 0);
+         ntuple.Fill();
+         if (i % 20000 == 19999)
+            ntuple.CommitCluster();
+      }
+   }
+   EXPECT_LT(0U, taskScheduler.fNTasksRun);
+
+   // Pages are written in commit order, the file layout must not depend on the task scheduler
+   auto ntupleSerial = RNTupleReader::Open("ntuple", fileGuardSerial.GetPath());
+   auto ntupleParallel = RNTupleReader::Open("ntuple", fileGuardParallel.GetPath());
+   const auto &descSerial = ntupleSerial->GetDescriptor();
+   const auto &descParallel = ntupleParallel->GetDescriptor();
+   ASSERT_EQ(3U, descParallel.GetNClusters());
+   for (unsigned int i = 0; i < descParallel.GetNClusters(); ++i) {
+      const auto &clusterSerial = descSerial.GetClusterDescriptor(i);
+      const auto &clusterParallel = descParallel.GetClusterDescriptor(i);
+      EXPECT_EQ(clusterSerial.GetLocator(), clusterParallel.GetLocator());
+      for (unsigned int j = 0; j < descParallel.GetNColumns(); ++j)
+         EXPECT_EQ(clusterSerial.GetPageRange(j), clusterParallel.GetPageRange(j));
+   }
+
+   auto viewPt = ntupleParallel->GetView<float>("pt");
+   auto viewFlags = ntupleParallel->GetView<std::vector<bool>>("flags");
+   for (auto i : ntupleParallel->GetEntryRange()) {
+      ASSERT_EQ(static_cast<float>(i), viewPt(i));
+      auto flags = viewFlags(i);
+      ASSERT_EQ(i % 5, flags.size());
+      for (unsigned int j = 0; j < i % 5; ++j)
+         EXPECT_EQ((i + j) % 3 == 0, flags[j]);
+   }
+}
+
+TEST(RNTuple, ParallelWriter)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer.root");
+   constexpr unsigned int kNThreads = 4;
+   constexpr unsigned int kNEntriesPerThread = 10000;
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<std::uint32_t>("id");
+      model->MakeField<std::vector<float>>("values");
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+
+      std::vector<std::thread> threads;
+      for (unsigned int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t]() {
+            auto fillContext = writer->CreateFillContext();
+            auto entry = fillContext->GetModel()->GetDefaultEntry();
+            auto wrId = entry->Get<std::uint32_t>("id");
+            auto wrValues = entry->Get<std::vector<float>>("values");
+            for (unsigned int i = 0; i < kNEntriesPerThread; ++i) {
+               *wrId = t * kNEntriesPerThread + i;
+               wrValues->assign(*wrId % 4, static_cast<float>(*wrId));
+               fillContext->Fill();
+               if (i % 3000 == 2999)
+                  fillContext->CommitCluster();
+            }
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+      EXPECT_EQ(kNThreads * kNEntriesPerThread, writer->GetNEntries());
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(kNThreads * kNEntriesPerThread, ntuple->GetNEntries());
+   // Every fill context commits 4 clusters
+   EXPECT_EQ(kNThreads * 4, ntuple->GetDescriptor().GetNClusters());
+
+   // Clusters of different fill contexts are interleaved; every entry must be present exactly once and intact
+   std::vector<bool> seen(kNThreads * kNEntriesPerThread, false);
+   auto viewId = ntuple->GetView<std::uint32_t>("id");
+   auto viewValues = ntuple->GetView<std::vector<float>>("values");
+   for (auto i : ntuple->GetEntryRange()) {
+      auto id = viewId(i);
+      ASSERT_LT(id, seen.size());
+      EXPECT_FALSE(seen[id]);
+      seen[id] = true;
+      auto values = viewValues(i);
+      ASSERT_EQ(id % 4, values.size());
+      for (auto v : values)
+         EXPECT_EQ(static_cast<float>(id), v);
+   }
+}
+
+TEST(RPageSourceFile, MemoryMap)
+{
+   FileRaii fileGuard("test_ntuple_memory_map.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrByte = model->MakeField<std::uint8_t>("byte");
+      auto wrE = model->MakeField<double>("E");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < 100000; ++i) {
+         *wrByte = i % 256;
+         *wrE = i;
+         ntuple->Fill();
+         if (i % 40000 == 39999)
+            ntuple->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOff, RNTupleReadOptions::EClusterCache::kOn}) {
+      RNTupleReadOptions options;
+      options.SetClusterCache(clusterCache);
+      options.SetMemoryMap(RNTupleReadOptions::EMemoryMap::kOn);
+      RNTupleReader ntuple(std::make_unique<RPageSourceFile>("ntuple", fileGuard.GetPath(), options));
+      ntuple.EnableMetrics();
+      auto viewByte = ntuple.GetView<std::uint8_t>("byte");
+      auto viewE = ntuple.GetView<double>("E");
+      for (auto i : ntuple.GetEntryRange()) {
+         ASSERT_EQ(i % 256, viewByte(i));
+         ASSERT_EQ(static_cast<double>(i), viewE(i));
+      }
+
+      // Single byte elements are always aligned, so at least the pages of the byte column are used in place
+      auto ctrMapped = dynamic_cast<const RNTupleAtomicCounter *>(
+         ntuple.GetMetrics().GetCounter("RPageSourceFile.nPageMapped"));
+      ASSERT_NE(nullptr, ctrMapped);
+      EXPECT_LT(0, ctrMapped->GetValue());
+   }
+}
+
+
+TEST(RNTuple, EntryRangesStats)
+{
+   FileRaii fileGuard("test_ntuple_entry_ranges_stats.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrJets = model->MakeField<std::vector<float>>("jets");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (unsigned int i = 0; i < 100000; ++i) {
+         *wrPt = i;
+         wrJets->clear();
+         wrJets->emplace_back(i);
+         ntuple->Fill();
+         if (i % 50000 == 49999)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   const auto ptId = desc.FindFieldId("pt");
+   const auto ptColumnId = desc.FindColumnId(ptId, 0);
+   const auto &columnRange = desc.GetClusterDescriptor(desc.FindClusterId(ptColumnId, 0)).GetColumnRange(ptColumnId);
+   EXPECT_TRUE(columnRange.fStats.fHasRange);
+   EXPECT_EQ(0.0, columnRange.fStats.fMin);
+   EXPECT_EQ(49999.0, columnRange.fStats.fMax);
+
+   // Top-level fields skip both clusters and pages
+   auto ranges = ntuple->GetEntryRanges("pt", 25000, 25100);
+   ASSERT_EQ(1U, ranges.size());
+   EXPECT_LE(*ranges[0].begin(), 25000U);
+   EXPECT_GT(*ranges[0].end(), 25100U);
+   EXPECT_LT(*ranges[0].end() - *ranges[0].begin(), 50000U);
+   EXPECT_TRUE(ntuple->GetEntryRanges("pt", -10, -1).empty());
+   ranges = ntuple->GetEntryRanges("pt", 0, 100000);
+   ASSERT_EQ(1U, ranges.size());
+   EXPECT_EQ(0U, *ranges[0].begin());
+   EXPECT_EQ(100000U, *ranges[0].end());
+
+   // Nested fields only skip entire clusters
+   const auto jetsItemId = desc.FindFieldId("_0", desc.FindFieldId("jets"));
+   auto entryRanges = desc.FindEntryRanges(jetsItemId, 75000, 75100);
+   ASSERT_EQ(1U, entryRanges.size());
+   EXPECT_EQ(50000U, entryRanges[0].first);
+   EXPECT_EQ(100000U, entryRanges[0].second);
+}
+
+
+namespace {
+
+/// A simple field that stores its values in a column of the given type, e.g. a plain column type that is not
+/// the default of the corresponding RField anymore
+template <typename T, EColumnType ColumnT>
+class RFieldColumnType : public RFieldBase {
+public:
+   RFieldColumnType(std::string_view name, std::string_view typeName)
+      : RFieldBase(name, typeName, ENTupleStructure::kLeaf, true /* isSimple */) {}
+   RFieldBase *Clone(std::string_view newName) final { return new RFieldColumnType(newName, GetType()); }
+
+   void GenerateColumnsImpl() final {
+      RColumnModel model(ColumnT, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<ROOT::Experimental::Detail::RColumn>(
+         ROOT::Experimental::Detail::RColumn::Create<T, ColumnT>(model, 0)));
+      fPrincipalColumn = fColumns[0].get();
+   }
+   RFieldValue GenerateValue(void *where) final {
+      return RFieldValue(ROOT::Experimental::Detail::RColumnElement<T, ColumnT>(static_cast<T *>(where)), this,
+                         static_cast<T *>(where), T());
+   }
+   RFieldValue CaptureValue(void *where) final {
+      return RFieldValue(true /* captureFlag */,
+                         ROOT::Experimental::Detail::RColumnElement<T, ColumnT>(static_cast<T *>(where)), this, where);
+   }
+   size_t GetValueSize() const final { return sizeof(T); }
+};
+
+} // anonymous namespace
+
+TEST(RPageSourceFile, UnsplitColumns)
+{
+   FileRaii fileGuard("test_ntuple_unsplit_columns.root");
+   {
+      // The column types of the data written before the split encodings became the default
+      auto model = RNTupleModel::Create();
+      model->AddField(std::make_unique<RFieldColumnType<float, EColumnType::kReal32>>("pt", "float"));
+      model->AddField(std::make_unique<RFieldColumnType<std::int32_t, EColumnType::kInt32>>("id", "std::int32_t"));
+      model->AddField(std::make_unique<RFieldColumnType<double, EColumnType::kReal64>>("E", "float"));
+      auto wrPt = model->Get<float>("pt");
+      auto wrId = model->Get<std::int32_t>("id");
+      auto wrE = model->Get<double>("E");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (int i = 0; i < 1000; ++i) {
+         *wrPt = 0.5 * i;
+         *wrId = -i;
+         *wrE = i;
+         ntuple->Fill();
+      }
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOff, RNTupleReadOptions::EClusterCache::kOn}) {
+      RNTupleReadOptions options;
+      options.SetClusterCache(clusterCache);
+      // The model leaves out the field "E", whose column type does not match the field type
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      model->MakeField<std::int32_t>("id");
+      auto ntuple = RNTupleReader::Open(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      const auto &desc = ntuple->GetDescriptor();
+      EXPECT_EQ(EColumnType::kReal32,
+                desc.GetColumnDescriptor(desc.FindColumnId(desc.FindFieldId("pt"), 0)).GetModel().GetType());
+
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewId = ntuple->GetView<std::int32_t>("id");
+      for (auto i : ntuple->GetEntryRange()) {
+         ASSERT_EQ(0.5 * i, viewPt(i));
+         ASSERT_EQ(-static_cast<std::int32_t>(i), viewId(i));
+      }
+
+      // A float field cannot read a column of doubles
+      EXPECT_THROW(ntuple->GetView<float>("E"), std::runtime_error);
+   }
+   EXPECT_THROW(RNTupleReader::Open("ntuple", fileGuard.GetPath()), std::runtime_error);
+}
+
+
+TEST(RNTupleMerger, Merge)
+{
+   FileRaii fileGuard1("test_ntuple_merger_in1.root");
+   FileRaii fileGuard2("test_ntuple_merger_in2.root");
+   FileRaii fileGuardOther("test_ntuple_merger_in_other.root");
+   FileRaii fileGuardOut("test_ntuple_merger_out.root");
+
+   // The inputs use different compression settings
+   RNTupleWriteOptions optionsUncompressed;
+   optionsUncompressed.SetCompression(0);
+   unsigned int offset = 0;
+   for (const auto &path : {fileGuard1.GetPath(), fileGuard2.GetPath()}) {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrTracks = model->MakeField<std::vector<float>>("tracks");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", path,
+                                            (offset == 0) ? optionsUncompressed : RNTupleWriteOptions());
+      for (unsigned int i = 0; i < 1000; ++i) {
+         *wrPt = offset + i;
+         wrTracks->clear();
+         for (unsigned int j = 0; j < i % 5; ++j)
+            wrTracks->emplace_back(offset + i + j);
+         ntuple->Fill();
+         if (i % 400 == 399)
+            ntuple->CommitCluster();
+      }
+      offset += 1000;
+   }
+
+   RNTupleWriteOptions optionsMerge;
+   optionsMerge.SetCompression(101);
+   RNTupleMerger::Merge("ntuple", {fileGuard1.GetPath(), fileGuard2.GetPath()}, fileGuardOut.GetPath(),
+                        optionsMerge);
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuardOut.GetPath());
+   EXPECT_EQ(2000U, ntuple->GetNEntries());
+   const auto &desc = ntuple->GetDescriptor();
+   EXPECT_EQ(6U, desc.GetNClusters());
+   // The copied pages keep the compression settings of their source
+   for (DescriptorId_t clusterId = 0; clusterId < desc.GetNClusters(); ++clusterId) {
+      for (DescriptorId_t columnId = 0; columnId < desc.GetNColumns(); ++columnId) {
+         EXPECT_EQ((clusterId < 3) ? 0 : RNTupleWriteOptions().GetCompression(),
+                   desc.GetClusterDescriptor(clusterId).GetColumnRange(columnId).fCompressionSettings);
+      }
+   }
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewTracks = ntuple->GetView<std::vector<float>>("tracks");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(static_cast<float>(i), viewPt(i));
+      ASSERT_EQ((i % 1000) % 5, viewTracks(i).size());
+      for (unsigned int j = 0; j < viewTracks(i).size(); ++j)
+         EXPECT_EQ(static_cast<float>(i + j), viewTracks(i)[j]);
+   }
+   // The page statistics are copied along with the pages
+   auto ranges = ntuple->GetEntryRanges("pt", 1500, 1510);
+   ASSERT_EQ(1U, ranges.size());
+   EXPECT_LE(*ranges[0].begin(), 1500U);
+   EXPECT_GT(*ranges[0].end(), 1510U);
+
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<double>("pt");
+      auto ntupleOther = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuardOther.GetPath());
+      ntupleOther->Fill();
+   }
+   EXPECT_THROW(RNTupleMerger::Merge("ntuple", {fileGuard1.GetPath(), fileGuardOther.GetPath()},
+                                     fileGuardOut.GetPath(), RNTupleWriteOptions()),
+                std::runtime_error);
+}
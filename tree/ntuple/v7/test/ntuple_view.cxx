@@ -121,3 +121,59 @@ TEST(RNTuple, Composable)
    }
    EXPECT_EQ(8, nEv);
 }
+
+TEST(RNTuple, ViewBulk)
+{
+   FileRaii fileGuard("test_ntuple_view_bulk.root");
+   constexpr unsigned int kNEntries = 100000;
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt");
+      auto fieldJets = model->MakeField<std::vector<float>>("jets");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+      for (unsigned int i = 0; i < kNEntries; ++i) {
+         *fieldPt = i;
+         fieldJets->assign(i % 3, 1.0);
+         ntuple->Fill();
+         if (i == kNEntries / 2)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+   unsigned int nCalls = 0;
+   NTupleSize_t i = 0;
+   while (i < kNEntries) {
+      auto values = viewPt.MapV(i, kNEntries - i);
+      ASSERT_LT(0U, values.size());
+      for (auto v : values) {
+         EXPECT_EQ(static_cast<float>(i), v);
+         ++i;
+      }
+      ++nCalls;
+   }
+   EXPECT_EQ(kNEntries, i);
+   // Several pages and clusters
+   EXPECT_LT(2U, nCalls);
+
+   // The span never exceeds the requested number of items
+   EXPECT_EQ(10U, viewPt.MapV(1000, 10).size());
+   EXPECT_EQ(1000.0, viewPt.MapV(1000, 10)[0]);
+
+   // Offsets are cluster-local end indexes of the collections
+   auto viewJets = ntuple->GetViewCollection("jets");
+   i = 0;
+   ClusterSize_t::ValueType prev = 0;
+   while (i < kNEntries) {
+      auto offsets = viewJets.MapV(i, kNEntries - i);
+      ASSERT_LT(0U, offsets.size());
+      for (auto o : offsets) {
+         if (i == kNEntries / 2 + 1)
+            prev = 0;
+         EXPECT_EQ(prev + i % 3, o);
+         prev = o;
+         ++i;
+      }
+   }
+}
@@ -58,6 +58,9 @@ private:
    void   DisownBuffer();
    void   AdoptBuffer(TBuffer *user_buffer);
 
+   // Write the buffer as the basket number `cycle` of the branch.
+   Int_t  WriteBufferImpl(Int_t cycle);
+
 protected:
    Int_t       fBufferSize{0};                    ///< fBuffer length in bytes
    Int_t       fNevBufSize{0};                    ///< Length in Int_t of fEntryOffset OR fixed length of each entry if fEntryOffset is null!
@@ -72,7 +72,9 @@ public:
    Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
+   Int_t GetBulkEntriesJagged(Long64_t evt, TBuffer &user_buf, TBuffer &offsets_buf);
    Bool_t SupportsBulkRead() const;
+   Bool_t SupportsJaggedBulkRead() const;
 
 private:
    TBulkBranchRead(TBranch &parent)
@@ -176,8 +178,11 @@ private:
    Int_t    GetBulkEntries(Long64_t, TBuffer&);
    Int_t    GetEntriesSerialized(Long64_t N, TBuffer& user_buf) {return GetEntriesSerialized(N, user_buf, nullptr);}
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
+   Int_t    GetBulkEntriesJagged(Long64_t, TBuffer&, TBuffer&);
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
    Int_t    WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *);
+   Int_t    WriteBasketPipelined(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *);
+   void     PipelinedBasketWritten(TBasket* basket, Int_t where, Int_t nout);
    TBranch(const TBranch&) = delete;             // not implemented
    TBranch& operator=(const TBranch&) = delete;  // not implemented
 
@@ -278,6 +283,7 @@ public:
    virtual void      SetTree(TTree *tree) { fTree = tree;}
    virtual void      SetupAddresses();
            Bool_t    SupportsBulkRead() const;
+           Bool_t    SupportsJaggedBulkRead() const;
    virtual void      UpdateAddress() {;}
    virtual void      UpdateFile();
 
@@ -311,7 +317,9 @@ namespace Internal {
 inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf) { return fParent.GetBulkEntries(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf) { return fParent.GetEntriesSerialized(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetEntriesSerialized(evt, user_buf, count_buf); }
+inline Int_t  TBulkBranchRead::GetBulkEntriesJagged(Long64_t evt, TBuffer& user_buf, TBuffer& offsets_buf) { return fParent.GetBulkEntriesJagged(evt, user_buf, offsets_buf); }
 inline Bool_t TBulkBranchRead::SupportsBulkRead() const { return fParent.SupportsBulkRead(); }
+inline Bool_t TBulkBranchRead::SupportsJaggedBulkRead() const { return fParent.SupportsJaggedBulkRead(); }
 
 }  // Internal
 }  // Experimental
@@ -42,6 +42,7 @@
 
 
 #include "TNamed.h"
+#include "TDataType.h"
 
 #ifdef R__LESS_INCLUDES
 class TBranch;
@@ -112,6 +113,9 @@ public:
    virtual Int_t   *GenerateOffsetArray(Int_t base, Int_t events) { return GenerateOffsetArrayBase(base, events); }
    TBranch         *GetBranch() const { return fBranch; }
    virtual DeserializeType GetDeserializeType() const { return DeserializeType::kDestructive; }
+   ///  If the entries of this leaf are arrays of variable size of a fundamental type that can be read in bulk with
+   ///  TBranch::GetBulkEntriesJagged, return that type. Return kOther_t otherwise.
+   virtual EDataType GetJaggedDataType() const { return kOther_t; }
    ///  If this leaf stores a variable-sized array or a multi-dimensional array whose last dimension has variable size,
    ///  return a pointer to the TLeaf that stores such size. Return a nullptr otherwise.
    virtual TLeaf   *GetLeafCount() const { return fLeafCount; }
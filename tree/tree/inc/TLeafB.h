@@ -41,6 +41,7 @@ public:
    virtual DeserializeType GetDeserializeType() const { return fLeafCount ? DeserializeType::kDestructive : DeserializeType::kZeroCopy; }
    virtual Int_t   GetMaximum() const { return fMaximum; }
    virtual Int_t   GetMinimum() const { return fMinimum; }
+   virtual EDataType GetJaggedDataType() const { return fLeafCount ? (fIsUnsigned ? kUChar_t : kChar_t) : kOther_t; }
    const char     *GetTypeName() const;
    Double_t        GetValue(Int_t i = 0) const { return IsUnsigned() ? (Double_t)((UChar_t) fValue[i]) : (Double_t)fValue[i]; }
    virtual void   *GetValuePointer() const { return fValue; }
@@ -40,6 +40,7 @@ public:
    virtual void    Export(TClonesArray *list, Int_t n);
    virtual void    FillBasket(TBuffer &b);
    virtual DeserializeType GetDeserializeType() const { return DeserializeType::kInPlace; }
+   virtual EDataType GetJaggedDataType() const { return fLeafCount ? (fIsUnsigned ? kUInt_t : kInt_t) : kOther_t; }
    const char     *GetTypeName() const;
    virtual Int_t   GetMaximum() const { return fMaximum; }
    virtual Int_t   GetMinimum() const { return fMinimum; }
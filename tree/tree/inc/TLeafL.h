@@ -39,6 +39,7 @@ public:
 
    virtual void    Export(TClonesArray *list, Int_t n);
    virtual void    FillBasket(TBuffer &b);
+   virtual EDataType GetJaggedDataType() const { return fLeafCount ? (fIsUnsigned ? kULong64_t : kLong64_t) : kOther_t; }
    const char     *GetTypeName() const;
    virtual Int_t   GetMaximum() const { return (Int_t)fMaximum; }
    virtual Int_t   GetMinimum() const { return (Int_t)fMinimum; }
@@ -40,6 +40,7 @@ public:
    virtual void    FillBasket(TBuffer &b);
    virtual Int_t   GetMaximum() const {return fMaximum;}
    virtual Int_t   GetMinimum() const {return fMinimum;}
+   virtual EDataType GetJaggedDataType() const { return fLeafCount ? kBool_t : kOther_t; }
    const char     *GetTypeName() const;
    Double_t        GetValue(Int_t i=0) const;
    virtual void   *GetValuePointer() const {return fValue;}
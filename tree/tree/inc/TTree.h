@@ -75,6 +75,12 @@ class TTreeCloner;
 class TFileMergeInfo;
 class TVirtualPerfStats;
 
+namespace ROOT {
+namespace Internal {
+class TBranchIMTHelper;
+}
+}
+
 class TTree : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
 
    using TIOFeatures = ROOT::TIOFeatures;
@@ -155,10 +161,15 @@ private:
    mutable Bool_t fIMTFlush{false};               ///<! True if we are doing a multithreaded flush.
    mutable std::atomic<Long64_t> fIMTTotBytes;    ///<! Total bytes for the IMT flush baskets
    mutable std::atomic<Long64_t> fIMTZipBytes;    ///<! Zip bytes for the IMT flush baskets.
+   ROOT::Internal::TBranchIMTHelper *fPipelinedFill{nullptr}; ///<! Tasks writing baskets across Fill calls, if pipelined (see SetPipelinedFill)
+   TFile           *fPipelinedFillFile{nullptr}; ///<! File that waits for the tasks of the pipelined Fill before its own writes
 
    void             InitializeBranchLists(bool checkLeafCount);
    void             SortBranchesByTime();
    Int_t            FlushBasketsImpl() const;
+   Int_t            CollectPipelinedFill(Bool_t wait, Int_t &nerror) const;
+   void             UpdatePipelinedFill(Bool_t wait) const;
+   void             SetPipelinedFillFile(TFile *file);
    void             MarkEventCluster();
 
 protected:
@@ -494,6 +505,7 @@ public:
    TObject                *GetNotify() const { return fNotify; }
    TVirtualTreePlayer     *GetPlayer();
    virtual Int_t           GetPacketSize() const { return fPacketSize; }
+           Long64_t        GetPipelinedFill() const;
    virtual TVirtualPerfStats *GetPerfStats() const { return fPerfStats; }
            TTreeCache     *GetReadCache(TFile *file) const;
            TTreeCache     *GetReadCache(TFile *file, Bool_t create);
@@ -630,6 +642,7 @@ public:
    virtual void            SetObject(const char* name, const char* title);
    virtual void            SetParallelUnzip(Bool_t opt=kTRUE, Float_t RelSize=-1);
    virtual void            SetPerfStats(TVirtualPerfStats* perf);
+           void            SetPipelinedFill(Long64_t maxInFlightBytes = 64000000);
    virtual void            SetScanField(Int_t n = 50) { fScanField = n; } // *MENU*
    void SetTargetMemoryRatio(Float_t ratio) { fTargetMemoryRatio = ratio; }
    virtual void            SetTimerInterval(Int_t msec = 333) { fTimerInterval=msec; }
@@ -29,6 +29,12 @@ class TTree;
 class TBranch;
 class TObjArray;
 
+namespace ROOT {
+namespace Internal {
+class TTreeCacheReadAhead;
+}
+}
+
 class TTreeCache : public TFileCacheRead {
 
 public:
@@ -104,6 +110,12 @@ protected:
 
    std::unique_ptr<MissCache> fMissCache; ///<! Cache contents for misses
 
+   // The baskets of the next cluster(s) can be read in an IMT task while the
+   // current ones are processed (see SetReadAhead).
+   Int_t    fReadAheadSize{0};      ///<! Memory budget of the baskets read ahead, <0 for the cache size, 0 if disabled.
+   Long64_t fReadAheadBytes{0};     ///<! Number of bytes read ahead and used by the cache.
+   ROOT::Internal::TTreeCacheReadAhead *fReadAhead{nullptr}; ///<! Baskets being read ahead.
+
 private:
    TTreeCache(const TTreeCache &) = delete; ///< this class cannot be copied
    TTreeCache &operator=(const TTreeCache &) = delete;
@@ -124,6 +136,9 @@ private:
    TBranch *CalculateMissEntries(Long64_t, int, bool);    ///< Given an file read, try to determine the corresponding branch.
    Bool_t   ProcessMiss(Long64_t pos, int len); ///<! Given a file read not in the miss cache, handle (possibly) loading the data.
 
+   void     StartReadAhead();    ///< Start reading the baskets of the cluster(s) following the cache content in a task.
+   Int_t    TransferReadAhead(); ///< Fill the cache buffer with the baskets read ahead, reading the others from the file.
+
 public:
 
    TTreeCache();
@@ -138,6 +153,7 @@ public:
    Bool_t               GetOptimizeMisses() const { return fOptimizeMisses; }
    const TObjArray     *GetCachedBranches() const { return fBranches; }
    EPrefillType         GetConfiguredPrefillType() const;
+   Int_t                GetConfiguredReadAhead() const;
    Double_t             GetEfficiency() const;
    Double_t             GetEfficiencyRel() const;
    virtual Int_t        GetEntryMin() const {return fEntryMin;}
@@ -146,6 +162,8 @@ public:
    virtual EPrefillType GetLearnPrefill() const {return fPrefillType;}
    Double_t             GetMissEfficiency() const;
    Double_t             GetMissEfficiencyRel() const;
+   Int_t                GetReadAhead() const { return fReadAheadSize; }
+   Long64_t             GetReadAheadBytes() const { return fReadAheadBytes; }
    TTree               *GetTree() const {return fTree;}
    Bool_t               IsAutoCreated() const {return fAutoCreated;}
    virtual Bool_t       IsEnabled() const {return fEnabled;}
@@ -168,6 +186,7 @@ public:
    virtual void         SetLearnPrefill(EPrefillType type = kNoPrefill);
    static void          SetLearnEntries(Int_t n = 10);
    void                 SetOptimizeMisses(Bool_t opt);
+   void                 SetReadAhead(Int_t maxbytes = -1);
    void                 StartLearningPhase();
    virtual void         StopLearningPhase();
    virtual void         UpdateBranches(TTree *tree);
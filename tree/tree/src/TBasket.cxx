@@ -1056,6 +1056,18 @@ void TBasket::Update(Int_t offset, Int_t skipped)
 /// If no data are written, the number of bytes returned is 0.
 
 Int_t TBasket::WriteBuffer()
+{
+   return WriteBufferImpl(fBranch->GetWriteBasket());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write buffer of this basket on the current file, as the basket number `cycle`
+/// of its branch.
+///
+/// A basket written by a pipelined TTree::Fill is written while its branch already
+/// fills the next one, hence the basket number cannot be taken from the branch.
+
+Int_t TBasket::WriteBufferImpl(Int_t cycle)
 {
    const Int_t kWrite = 1;
 
@@ -1136,7 +1148,7 @@ Int_t TBasket::WriteBuffer()
    fObjlen    = lbuf - fKeylen;
 
    fHeaderOnly = kTRUE;
-   fCycle = fBranch->GetWriteBasket();
+   fCycle = cycle;
    Int_t cxlevel = fBranch->GetCompressionLevel();
    ROOT::RCompressionSetting::EAlgorithm::EValues cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(fBranch->GetCompressionAlgorithm());
    if (cxlevel > 0) {
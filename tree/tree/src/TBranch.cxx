@@ -1403,6 +1403,39 @@ Bool_t TBranch::SupportsBulkRead() const {
           (static_cast<TLeaf*>(fLeaves.UncheckedAt(0))->GetDeserializeType() != TLeaf::DeserializeType::kDestructive);
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Size in bytes of the elements of jagged arrays of the given type, 0 if
+/// jagged bulk IO does not support the type.
+Int_t JaggedElementSize(EDataType type)
+{
+   switch (type) {
+      case kChar_t: case kUChar_t: case kBool_t: return 1;
+      case kShort_t: case kUShort_t: return 2;
+      case kInt_t: case kUInt_t: case kFloat_t: return 4;
+      case kLong64_t: case kULong64_t: case kDouble_t: return 8;
+      default: return 0;
+   }
+}
+
+/// The byte count of each object written by TBufferFile is tagged with this bit
+const UInt_t kJaggedByteCountMask = 0x40000000;
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true if this branch supports bulk IO of variable-size arrays via
+/// GetBulkEntriesJagged, false otherwise.
+///
+/// This is the case for branches with a single leaf holding either a counted
+/// C array of a fundamental type (e.g. "pt[nJet]/F") or a std::vector of a
+/// fundamental type (other than bool).
+Bool_t TBranch::SupportsJaggedBulkRead() const {
+   return (fNleaves == 1) &&
+          JaggedElementSize(static_cast<TLeaf*>(fLeaves.UncheckedAt(0))->GetJaggedDataType()) > 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read as many events as possible into the given buffer, using zero-copy
 /// mechanisms.
@@ -1479,6 +1512,132 @@ Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
    return N;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read all the entries of the basket starting at `entry` into the given
+/// buffer as one flat array of values, for branches holding arrays of
+/// variable size (see SupportsJaggedBulkRead).
+///
+/// Returns -1 in case of a failure.  On success, returns the number N of
+/// entries read; the caller can then access the values and the offsets of
+/// the entries as
+///
+/// static_cast<T*>(user_buf.GetCurrent())
+/// reinterpret_cast<Int_t*>(offsets_buf.GetCurrent())
+///
+/// where T is the type of the array elements. The offsets array has N+1
+/// elements: entry i holds the values from offsets[i] to offsets[i+1].
+///
+/// The values are deserialized in the memory of the basket, which is backed
+/// by user_buf:
+/// - for counted C arrays, the values of consecutive entries are already
+///   contiguous on disk and are only byte-swapped (zero-copy);
+/// - for std::vectors, the header of each entry (byte count, version and
+///   size) is squeezed out by moving the values in place.
+///
+/// NOTES:
+/// - This interface is meant to be used by higher-level, type-safe wrappers, not
+///   by end-users.
+/// - As for GetBulkEntries, `entry` must be the first entry of a basket.
+
+Int_t TBranch::GetBulkEntriesJagged(Long64_t entry, TBuffer &user_buf, TBuffer &offsets_buf)
+{
+   if (R__unlikely(fNleaves != 1)) { return -1; }
+   TLeaf *leaf = static_cast<TLeaf*>(fLeaves.UncheckedAt(0));
+   const EDataType type = leaf->GetJaggedDataType();
+   const Int_t elemSize = JaggedElementSize(type);
+   if (R__unlikely(elemSize == 0)) {
+      Error("GetBulkEntriesJagged", "Branch %s does not hold arrays of variable size of a fundamental type.\n", GetName());
+      return -1;
+   }
+
+   // Remember which entry we are reading.
+   fReadEntry = entry;
+
+   Bool_t enabled = !TestBit(kDoNotProcess);
+   if (R__unlikely(!enabled)) { return -1; }
+   TBasket *basket = nullptr;
+   Long64_t first;
+   Int_t result = GetBasketAndFirst(basket, first, &user_buf);
+   if (R__unlikely(result <= 0)) { return -1; }
+   // Only support reading from full clusters.
+   if (R__unlikely(entry != first)) {
+       Error("GetBulkEntriesJagged", "Failed to read from full cluster; first entry is %lld; requested entry is %lld.\n", first, entry);
+       return -1;
+   }
+
+   basket->PrepareBasket(entry);
+   TBuffer* buf = basket->GetBufferRef();
+
+   // Test for very old ROOT files.
+   if (R__unlikely(!buf)) {
+      Error("GetBulkEntriesJagged", "Failed to get a new buffer.\n");
+      return -1;
+   }
+   // Test for displacements, which aren't supported in fast mode.
+   if (R__unlikely(basket->GetDisplacement())) {
+      Error("GetBulkEntriesJagged", "Basket has displacement.\n");
+      return -1;
+   }
+   const Int_t *entryOffset = basket->GetEntryOffset();
+   if (R__unlikely(!entryOffset)) {
+      Error("GetBulkEntriesJagged", "Basket has no entry offsets.\n");
+      return -1;
+   }
+
+   Int_t bufbegin = basket->GetKeylen();
+   Int_t bufend = basket->GetLast();
+   Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
+
+   offsets_buf.SetBufferOffset(0);
+   offsets_buf.AutoExpand((N + 1) * sizeof(Int_t));
+   Int_t *offsets = reinterpret_cast<Int_t*>(offsets_buf.Buffer());
+
+   char *content = buf->Buffer() + bufbegin;
+   Int_t nElements = 0;
+   if (leaf->GetLeafCount()) {
+      // The values of consecutive entries are contiguous: the offsets are the entry offsets of the basket.
+      for (Int_t idx = 0; idx < N; idx++) {
+         offsets[idx] = (entryOffset[idx] - bufbegin) / elemSize;
+      }
+      nElements = (bufend - bufbegin) / elemSize;
+   } else {
+      // Each entry is a std::vector: its byte count and version, its size and then its values.
+      for (Int_t idx = 0; idx < N; idx++) {
+         char *entry_buf = buf->Buffer() + entryOffset[idx];
+         const char *entry_end = buf->Buffer() + ((idx + 1 < N) ? entryOffset[idx + 1] : bufend);
+         UInt_t byteCount;
+         Version_t version;
+         Int_t size;
+         frombuf(entry_buf, &byteCount);
+         frombuf(entry_buf, &version);
+         frombuf(entry_buf, &size);
+         if (R__unlikely(!(byteCount & kJaggedByteCountMask) || size < 0 || entry_buf + size * elemSize != entry_end)) {
+            Error("GetBulkEntriesJagged", "Unexpected layout of entry %lld of branch %s.\n", first + idx, GetName());
+            return -1;
+         }
+         offsets[idx] = nElements;
+         memmove(content + nElements * elemSize, entry_buf, size * elemSize);
+         nElements += size;
+      }
+   }
+   offsets[N] = nElements;
+
+   buf->SetBufferOffset(bufbegin);
+   if (elemSize > 1 && R__unlikely(!buf->ByteSwapBuffer(nElements, type))) {
+      Error("GetBulkEntriesJagged", "Failed to byte-swap the values.\n");
+      return -1;
+   }
+   user_buf.SetBufferOffset(bufbegin);
+
+   fCurrentBasket = nullptr;
+   fBaskets[fReadBasket] = nullptr;
+   R__ASSERT(fExtraBasket == nullptr && "fExtraBasket should have been set to nullptr by GetFreshBasket");
+   fExtraBasket = basket;
+   basket->DisownBuffer();
+
+   return N;
+}
+
 // TODO: Template this and the call above; only difference is the TLeaf function (ReadBasketFast vs
 // ReadBasketSerialized
 Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf, TBuffer *count_buf)
@@ -3021,6 +3180,10 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
       fEntryOffsetLen = 2*nevbuf; // assume some fluctuations.
    }
 
+   if (imtHelper && imtHelper->GetMaxInFlightBytes() > 0 && where == fWriteBasket && basket->IsA() == TBasket::Class()) {
+      return WriteBasketPipelined(basket, where, imtHelper);
+   }
+
    // Note: captures `basket`, `where`, and `this` by value; modifies the TBranch and basket,
    // as we make a copy of the pointer.  We cannot capture `basket` by reference as the pointer
    // itself might be modified after `WriteBasketImpl` exits.
@@ -3083,6 +3246,78 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Start writing the current basket in a task that may outlive TTree::Fill, and
+/// move on to the next basket right away.
+///
+/// The task only compresses and writes the basket: the arrays of the branch are
+/// updated by PipelinedBasketWritten, which the TTree calls from the producer thread
+/// once the task is done.
+
+Int_t TBranch::WriteBasketPipelined(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *imtHelper)
+{
+   // The next basket of this branch may be compressed while this one still is, so it
+   // cannot use the compression buffer shared by the baskets of the branch.
+   if (!basket->fOwnsCompressedBuffer) {
+      basket->fCompressedBufferRef = nullptr;
+   }
+   Long64_t basketBytes = basket->GetBufferRef()->Length();
+   imtHelper->RunPipelined(this, basket, where, basketBytes, [=]() {
+      Int_t nout = basket->WriteBufferImpl(where);
+      if (nout < 0) Error("TBranch::WriteBasketPipelined", "basket's WriteBuffer failed.\n");
+      return nout;
+   });
+
+   // The basket stays in fBaskets until it is written; the next FillImpl creates a new
+   // basket, unless PipelinedBasketWritten hands the written one back first.
+   ++fWriteBasket;
+   if (fWriteBasket >= fMaxBaskets) {
+      ExpandBasketArrays();
+   }
+   fBaskets.AddAtAndExpand(nullptr, fWriteBasket);
+   fBasketEntry[fWriteBasket] = fEntryNumber;
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Update the branch for the basket `where`, written by a task started by
+/// WriteBasketPipelined.  The written basket is reused as the current basket if
+/// the branch did not create one in the meantime.
+
+void TBranch::PipelinedBasketWritten(TBasket* basket, Int_t where, Int_t nout)
+{
+   fBasketBytes[where] = basket->GetNbytes();
+   fBasketSeek[where]  = basket->GetSeekKey();
+   if (nout <= 0) {
+      // Keep the basket in memory, as WriteBasketImpl does.
+      return;
+   }
+   Int_t addbytes = basket->GetObjlen() + basket->GetKeylen();
+   fZipBytes += nout;
+   fTotBytes += addbytes;
+   fTree->AddTotBytes(addbytes);
+   fTree->AddZipBytes(nout);
+
+   fBaskets[where] = nullptr;
+   if (basket == fCurrentBasket) {
+      fCurrentBasket    = 0;
+      fFirstBasketEntry = -1;
+      fNextBasketEntry  = -1;
+   }
+   if (!fBaskets.UncheckedAt(fWriteBasket)) {
+      basket->Reset();
+#ifdef R__TRACK_BASKET_ALLOC_TIME
+      fTree->AddAllocationTime(basket->GetResetAllocationTime());
+#endif
+      fTree->AddAllocationCount(basket->GetResetAllocationCount());
+      fBaskets.AddAtAndExpand(basket, fWriteBasket);
+   } else {
+      --fNBaskets;
+      basket->DropBuffers();
+      delete basket;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///set the first entry number (case of TBranchSTL)
 
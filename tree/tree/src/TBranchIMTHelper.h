@@ -14,12 +14,25 @@
 
 #include "Rtypes.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #ifdef R__USE_IMT
 #include "ROOT/TTaskGroup.hxx"
 #endif
 
+class TBasket;
+class TBranch;
+
 /// A helper class for managing IMT work during TTree:Fill operations.
 ///
+/// By default, TTree::Fill waits for the tasks it started before returning.  A pipelined
+/// helper is owned by the TTree instead (see TTree::SetPipelinedFill): its tasks keep
+/// compressing and writing baskets across Fill calls, and the producer only waits for them
+/// when the baskets in flight exceed a memory budget or at the drain points of the tree.
+///
 namespace ROOT {
 namespace Internal {
 
@@ -30,6 +43,14 @@ using TaskGroup_t = ROOT::Experimental::TTaskGroup;
 #endif
 
 public:
+   /// A basket written by a pipelined task.
+   struct WrittenBasket {
+      TBranch *fBranch; // Branch of the basket.
+      TBasket *fBasket; // The basket, still owned by the branch.
+      Int_t    fWhere;  // Index of the basket in the branch.
+      Int_t    fNout;   // Number of bytes written, or -1 on error.
+   };
+
    template<typename FN> void Run(const FN &lambda) {
 #ifdef R__USE_IMT
       if (!fGroup) { fGroup.reset(new TaskGroup_t()); }
@@ -46,6 +67,26 @@ public:
 #endif
    }
 
+   /// Run a task writing the basket `where` of `branch`, that may still be running when TTree::Fill
+   /// returns.  The task only compresses and writes the basket; the bookkeeping of the branch is
+   /// left to the producer (see TakeWritten).  Wait for the tasks in flight first if the basket,
+   /// of `basketBytes` uncompressed bytes, would make them exceed the memory budget.
+   template<typename FN> void RunPipelined(TBranch *branch, TBasket *basket, Int_t where, Long64_t basketBytes, const FN &lambda) {
+      if (fInFlightBytes > 0 && fInFlightBytes + basketBytes > fMaxInFlightBytes) {
+         Wait();
+      }
+      fInFlightBytes += basketBytes;
+      Run( [=]() {
+         Int_t nout = lambda();
+         {
+            std::lock_guard<std::mutex> lock(fWrittenMutex);
+            fWritten.push_back({branch, basket, where, nout});
+         }
+         fInFlightBytes -= basketBytes;
+         return nout;
+      });
+   }
+
    void Wait() {
 #ifdef R__USE_IMT
       if (fGroup) fGroup->Wait();
@@ -55,9 +96,30 @@ public:
    Long64_t GetNbytes() { return fBytes; }
    Long64_t GetNerrors() {  return fNerrors; }
 
+   // Pipelined mode.
+   void     SetMaxInFlightBytes(Long64_t maxbytes) { fMaxInFlightBytes = maxbytes; }
+   Long64_t GetMaxInFlightBytes() const { return fMaxInFlightBytes; }
+   Long64_t GetInFlightBytes() const { return fInFlightBytes; }
+
+   /// Return and reset the counters accumulated since the previous call.
+   Long64_t TakeNbytes() { return fBytes.exchange(0); }
+   Int_t    TakeNerrors() { return fNerrors.exchange(0); }
+
+   /// Return the baskets whose task is done since the previous call.
+   std::vector<WrittenBasket> TakeWritten() {
+      std::vector<WrittenBasket> written;
+      std::lock_guard<std::mutex> lock(fWrittenMutex);
+      written.swap(fWritten);
+      return written;
+   }
+
 private:
    std::atomic<Long64_t> fBytes{0};   // Total number of bytes written by this helper.
    std::atomic<Int_t>    fNerrors{0}; // Total error count of all tasks done by this helper.
+   Long64_t fMaxInFlightBytes{0};            // Budget of uncompressed bytes of the baskets in flight; 0 if not pipelined.
+   std::atomic<Long64_t> fInFlightBytes{0};  // Uncompressed bytes of the baskets still being written.
+   std::vector<WrittenBasket> fWritten;      // Baskets written by the pipelined tasks, not yet taken by the producer.
+   std::mutex fWrittenMutex;                 // Protects fWritten.
 #ifdef R__USE_IMT
    std::unique_ptr<TaskGroup_t> fGroup;
 #endif
@@ -22,6 +22,8 @@ a TStreamerInfo (i.e. using TBranchElement).
 #include "TVirtualStreamerInfo.h"
 #include "Bytes.h"
 #include "TBuffer.h"
+#include "TClass.h"
+#include "TVirtualCollectionProxy.h"
 
 ClassImp(TLeafElement);
 
@@ -140,6 +142,23 @@ TLeafElement::GetDeserializeType() const
    return DeserializeType::kDestructive;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the value type if this leaf stores a std::vector of a fundamental type, which can be read in bulk with
+/// TBranch::GetBulkEntriesJagged, kOther_t otherwise.
+/// std::vector<bool> is excluded: its in-memory representation is not an array of bool.
+EDataType TLeafElement::GetJaggedDataType() const
+{
+   TClass *clptr = nullptr;
+   EDataType type = EDataType::kOther_t;
+   if (fBranch->GetExpectedType(clptr, type) || !clptr)
+      return EDataType::kOther_t;
+   TVirtualCollectionProxy *proxy = clptr->GetCollectionProxy();
+   if (!proxy || proxy->GetCollectionType() != ROOT::kSTLvector || proxy->GetValueClass())
+      return EDataType::kOther_t;
+   const EDataType valueType = proxy->GetType();
+   return valueType == EDataType::kBool_t ? EDataType::kOther_t : valueType;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Deserialize N events from an input buffer.
 Bool_t TLeafElement::ReadBasketFast(TBuffer &input_buf, Long64_t N)
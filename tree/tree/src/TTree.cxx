@@ -941,6 +941,12 @@ TTree::~TTree()
          CopyAddresses(clone,kTRUE);
       }
    }
+   // The tasks of a pipelined Fill may still be writing baskets of our branches.
+   if (fPipelinedFill) {
+      SetPipelinedFillFile(nullptr);
+      delete fPipelinedFill;
+      fPipelinedFill = nullptr;
+   }
    // Get rid of our branches, note that this will also release
    // any memory allocated by TBranchElement::SetAddress().
    fBranches.Delete();
@@ -4540,7 +4546,7 @@ Int_t TTree::Fill()
 #ifndef R__USE_IMT
       nwrite = branch->FillImpl(nullptr);
 #else
-      nwrite = branch->FillImpl(useIMT ? &imtHelper : nullptr);
+      nwrite = branch->FillImpl(useIMT ? (fPipelinedFill ? fPipelinedFill : &imtHelper) : nullptr);
 #endif
       if (nwrite < 0) {
          if (nerror < 2) {
@@ -4574,6 +4580,9 @@ Int_t TTree::Fill()
    }
 #endif
 
+   // Account for the baskets written in the background since the previous Fill, without waiting for the others.
+   nbytes += CollectPipelinedFill(kFALSE, nerror);
+
    if (fBranchRef)
       fBranchRef->Fill();
 
@@ -5045,6 +5054,8 @@ Int_t TTree::FlushBasketsImpl() const
    if (!fDirectory) return 0;
    Int_t nbytes = 0;
    Int_t nerror = 0;
+   // Drain point of a pipelined Fill: wait for the baskets being written before flushing the others.
+   nbytes += CollectPipelinedFill(kTRUE, nerror);
    TObjArray *lb = const_cast<TTree*>(this)->GetListOfBranches();
    Int_t nb = lb->GetEntriesFast();
 
@@ -5096,7 +5107,7 @@ Int_t TTree::FlushBasketsImpl() const
       const_cast<TTree*>(this)->AddTotBytes(fIMTTotBytes);
       const_cast<TTree*>(this)->AddZipBytes(fIMTZipBytes);
 
-      return nerrpar ? -1 : nbpar.load();
+      return (nerrpar || nerror) ? -1 : nbpar.load() + nbytes;
    }
 #endif
    for (Int_t j = 0; j < nb; j++) {
@@ -7838,6 +7849,9 @@ void TTree::RemoveFriend(TTree* oldFriend)
 
 void TTree::Reset(Option_t* option)
 {
+   Int_t nerror = 0;
+   CollectPipelinedFill(kTRUE, nerror);
+
    fNotify        = 0;
    fEntries       = 0;
    fNClusterRange = 0;
@@ -8754,6 +8768,9 @@ void TTree::SetDirectory(TDirectory* dir)
    if (fDirectory == dir) {
       return;
    }
+   if (fPipelinedFill) {
+      SetPipelinedFillFile(dir ? dir->GetFile() : nullptr);
+   }
    if (fDirectory) {
       fDirectory->Remove(this);
 
@@ -9091,6 +9108,105 @@ void TTree::SetPerfStats(TVirtualPerfStats *perf)
    fPerfStats = perf;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Let Fill compress and write full baskets in the background.
+///
+/// When implicit multi-threading is enabled, Fill hands the compression and
+/// the writing of the full baskets to tasks.  By default, it waits for these
+/// tasks before returning.  With a pipelined Fill, the tasks keep running while
+/// the following entries are filled, and Fill only waits for them when the
+/// uncompressed size of the baskets being written would exceed
+/// `maxInFlightBytes`.  All the baskets are written when the tree is flushed,
+/// i.e. at FlushBaskets, AutoSave, Write or Reset, and when it is deleted.
+/// The file of the tree also waits for the baskets being written before it
+/// writes anything else, e.g. another object, a directory or its header.
+///
+/// A basket being written cannot be read: call FlushBaskets before reading
+/// entries of a tree that is being filled.
+///
+/// A `maxInFlightBytes` of 0 or less disables the pipelined Fill, after having
+/// waited for the baskets being written.
+
+void TTree::SetPipelinedFill(Long64_t maxInFlightBytes)
+{
+   Int_t nerror = 0;
+   CollectPipelinedFill(kTRUE, nerror);
+   if (maxInFlightBytes <= 0) {
+      SetPipelinedFillFile(nullptr);
+      delete fPipelinedFill;
+      fPipelinedFill = nullptr;
+      return;
+   }
+#ifdef R__USE_IMT
+   if (!fPipelinedFill)
+      fPipelinedFill = new ROOT::Internal::TBranchIMTHelper();
+   fPipelinedFill->SetMaxInFlightBytes(maxInFlightBytes);
+   SetPipelinedFillFile(GetCurrentFile());
+#else
+   Warning("SetPipelinedFill", "ROOT was built without implicit multi-threading: Fill writes the baskets itself.");
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the budget of uncompressed bytes of the baskets written in the
+/// background by a pipelined Fill, or 0 if Fill is not pipelined.
+
+Long64_t TTree::GetPipelinedFill() const
+{
+   return fPipelinedFill ? fPipelinedFill->GetMaxInFlightBytes() : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Update the branches for the baskets written by the tasks of a pipelined Fill.
+///
+/// If `wait` is true, wait for all the tasks first.  Return the number of bytes
+/// written and add the number of failed tasks to `nerror`.
+
+Int_t TTree::CollectPipelinedFill(Bool_t wait, Int_t &nerror) const
+{
+   if (!fPipelinedFill)
+      return 0;
+   UpdatePipelinedFill(wait);
+   nerror += fPipelinedFill->TakeNerrors();
+   return fPipelinedFill->TakeNbytes();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Update the branches for the baskets written by the tasks of a pipelined Fill,
+/// after having waited for all the tasks if `wait` is true.  The numbers of bytes
+/// written and of failed tasks are left for the next CollectPipelinedFill.
+
+void TTree::UpdatePipelinedFill(Bool_t wait) const
+{
+   if (!fPipelinedFill)
+      return;
+   if (wait)
+      fPipelinedFill->Wait();
+   for (auto &written : fPipelinedFill->TakeWritten())
+      written.fBranch->PipelinedBasketWritten(written.fBasket, written.fWhere, written.fNout);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make `file` wait for the tasks of the pipelined Fill before any other write.
+///
+/// The tasks of a pipelined Fill write baskets while the producer thread keeps
+/// running, and may write other objects to the same file, e.g. histograms.  The
+/// file waits for the tasks before writing keys, directories or its header (see
+/// TFile::RegisterPipelinedWriter).  The tasks are drained when the tree moves
+/// to another file.
+
+void TTree::SetPipelinedFillFile(TFile *file)
+{
+   if (file == fPipelinedFillFile)
+      return;
+   UpdatePipelinedFill(kTRUE);
+   if (fPipelinedFillFile)
+      fPipelinedFillFile->UnregisterPipelinedWriter(this);
+   fPipelinedFillFile = file;
+   if (fPipelinedFillFile)
+      fPipelinedFillFile->RegisterPipelinedWriter(this, [this]() { UpdatePipelinedFill(kTRUE); });
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// The current TreeIndex is replaced by the new index.
 /// Note that this function does not delete the previous index.
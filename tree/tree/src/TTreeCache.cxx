@@ -20,6 +20,7 @@
 - [General Description](#description)
 - [Changes in behaviour](#changesbehaviour)
 - [Self-optimization](#cachemisses)
+- [Reading ahead](#readahead)
 - [Examples of usage](#examples)
 - [Check performance and stats](#checkPerf)
 
@@ -125,6 +126,26 @@ Additionally, on the first miss of an event, we must iterate through all the
 This can be potentially a CPU-expensive operation compared to, e.g., the
 latency of a SSD.  This is why the miss cache is currently disabled by default.
 
+## <a name="readahead"></a>Reading the next cluster ahead
+
+By default, the baskets of a cluster are read when the first of them is
+needed, hence the processing of the entries waits for each read.
+When implicit multi-threading is enabled, the TTreeCache can read the baskets
+of the next cluster(s) in a task while the entries of the current one are
+processed (see the SetReadAhead method): when the cache moves on to the next
+cluster, the baskets it needs are copied from the ones read ahead, and only
+the others are read from the file.
+The baskets read ahead take at most the memory budget given to SetReadAhead,
+in addition to the memory of the cache.
+The task reads the file through its own ROOT::Internal::RRawFile, hence only
+local files and the files accessed via HTTP are read ahead.
+Reading ahead goes through the local disk cache of remote files, if one is
+configured (see TFileCacheRead): the baskets found in the disk cache are taken
+from there, and the ones read from the file are stored in it.
+The default budget is set by `TTreeCache.ReadAhead` in `.rootrc` or by
+the environment variable `ROOT_TTREECACHE_READAHEAD`; it applies to the caches
+created automatically, e.g. by each task of a ROOT::TTreeProcessorMT.
+
 ## <a name="examples"></a>Example usages of TTreeCache
 
 A few use cases are discussed below. A cache may be created with automatic
@@ -293,6 +314,8 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TMath.h"
 #include "TBranchCacheInfo.h"
 #include "TVirtualPerfStats.h"
+#include "TROOT.h"
+#include "TTreeCacheReadAhead.h"
 #include <limits.h>
 
 Int_t TTreeCache::fgLearnEntries = 100;
@@ -304,6 +327,7 @@ ClassImp(TTreeCache);
 
 TTreeCache::TTreeCache() : TFileCacheRead(), fPrefillType(GetConfiguredPrefillType())
 {
+   fReadAheadSize = GetConfiguredReadAhead();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -316,6 +340,7 @@ TTreeCache::TTreeCache(TTree *tree, Int_t buffersize)
    fEntryNext = fEntryMin + fgLearnEntries;
    Int_t nleaves = tree->GetListOfLeaves()->GetEntries();
    fBranches = new TObjArray(nleaves);
+   fReadAheadSize = GetConfiguredReadAhead();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -327,6 +352,7 @@ TTreeCache::~TTreeCache()
    // we are deleted explicitly by legacy user code).
    if (fFile) fFile->SetCacheRead(0, fTree);
 
+   delete fReadAhead;
    delete fBranches;
    if (fBrNames) {fBrNames->Delete(); delete fBrNames; fBrNames=0;}
 }
@@ -1794,6 +1820,27 @@ TTreeCache::EPrefillType TTreeCache::GetConfiguredPrefillType() const
    return static_cast<TTreeCache::EPrefillType>(s);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the desired budget of the baskets read ahead (see SetReadAhead) from
+/// the environment or resource variable
+/// - 0 - No read ahead (default)
+/// - <0 - Read ahead as many bytes as the cache holds
+/// - >0 - Read ahead at most this number of bytes
+
+Int_t TTreeCache::GetConfiguredReadAhead() const
+{
+   const char *stcp;
+   Int_t s = 0;
+
+   if (!(stcp = gSystem->Getenv("ROOT_TTREECACHE_READAHEAD")) || !*stcp) {
+      s = gEnv->GetValue("TTreeCache.ReadAhead", 0);
+   } else {
+      s = TString(stcp).Atoi();
+   }
+
+   return s;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Give the total efficiency of the primary cache... defined as the ratio
 /// of blocks found in the cache vs. the number of blocks prefetched
@@ -1889,6 +1936,8 @@ void TTreeCache::Print(Option_t *option) const
    printf("Secondary Efficiency ..............: %f\n", GetMissEfficiency());
    printf("Secondary Efficiency Rel ..........: %f\n", GetMissEfficiencyRel());
    printf("Learn entries......................: %d\n",TTreeCache::GetLearnEntries());
+   if (fReadAheadSize)
+      printf("Bytes read ahead and used..........: %lld\n", fReadAheadBytes);
    if ( opt.Contains("cachedbranches") ) {
       opt.ReplaceAll("cachedbranches","");
       printf("Cached branches....................:\n");
@@ -1933,6 +1982,12 @@ Int_t TTreeCache::ReadBufferNormal(char *buf, Long64_t pos, Int_t len){
    //not found in cache. Do we need to fill the cache?
    Bool_t bufferFilled = FillBuffer();
    if (bufferFilled) {
+      // Take the baskets read ahead, if any, and read ahead the next ones.
+      if (fReadAheadSize) {
+         if (TransferReadAhead() < 0)
+            return -1;
+         StartReadAhead();
+      }
       Int_t res = TFileCacheRead::ReadBuffer(buf,pos,len);
 
       if (res == 1)
@@ -2032,6 +2087,8 @@ void TTreeCache::ResetCache()
    fEntryNext = -1;
    fCurrentClusterStart = -1;
    fNextClusterStart = -1;
+   if (fReadAhead)
+      fReadAhead->Clear();
 
    TFileCacheRead::Prefetch(0,0);
 
@@ -2092,6 +2149,8 @@ void TTreeCache::SetEntryRange(Long64_t emin, Long64_t emax)
    fEntryMin  = emin;
    fEntryMax  = emax;
    fEntryNext  = fEntryMin + fgLearnEntries * (fIsLearning && !fIsManual);
+   if (fReadAhead)
+      fReadAhead->Clear();
    if (gDebug > 0)
       Info("SetEntryRange", "fEntryMin=%lld, fEntryMax=%lld, fEntryNext=%lld",
                              fEntryMin, fEntryMax, fEntryNext);
@@ -2115,6 +2174,8 @@ void TTreeCache::SetFile(TFile *file, TFile::ECacheAction action)
       fFile = 0;
       prevFile->SetCacheRead(0, fTree, action);
    }
+   if (fReadAhead)
+      fReadAhead->Close();
    TFileCacheRead::SetFile(file, action);
 }
 
@@ -2142,6 +2203,139 @@ void TTreeCache::SetLearnPrefill(TTreeCache::EPrefillType type /* = kNoPrefill *
    fPrefillType = type;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the baskets of the next cluster(s) in a task while the current ones
+/// are processed.
+///
+/// The baskets read ahead take at most `maxbytes` bytes, or as many bytes as
+/// the cache if `maxbytes` is negative.  A `maxbytes` of 0 disables reading
+/// ahead.  Reading ahead requires implicit multi-threading to be enabled, and
+/// is not done in prefetching mode (see TFileCacheRead::SetEnablePrefetching).
+
+void TTreeCache::SetReadAhead(Int_t maxbytes)
+{
+   fReadAheadSize = maxbytes;
+   if (!fReadAheadSize) {
+      delete fReadAhead;
+      fReadAhead = nullptr;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Start reading, in a task, the baskets of the cluster(s) following the
+/// current content of the cache, up to the read ahead budget.
+
+void TTreeCache::StartReadAhead()
+{
+   if (fIsLearning || fEnablePrefetching || fAsyncReading || !fFile || fNbranches <= 0 ||
+       !ROOT::IsImplicitMTEnabled())
+      return;
+   if (!fReadAhead)
+      fReadAhead = new ROOT::Internal::TTreeCacheReadAhead();
+   if (fEntryNext < 0 || fEntryNext >= fEntryMax) {
+      fReadAhead->Clear();
+      return;
+   }
+
+   const Long64_t maxBytes = fReadAheadSize < 0 ? fBufferSizeMin : fReadAheadSize;
+   TTree *tree = ((TBranch*)fBranches->UncheckedAt(0))->GetTree();
+   TTree::TClusterIterator clusterIter = tree->GetClusterIterator(fEntryNext);
+   Long64_t clusterStart = clusterIter();
+   std::vector<std::pair<Long64_t, Int_t>> blocks;
+   Long64_t ntot = 0;
+   Bool_t full = kFALSE;
+   while (!full && clusterStart < fEntryMax) {
+      Long64_t clusterEnd = std::min(clusterIter.GetNextEntry(), fEntryMax);
+      for (Int_t i = 0; i < fNbranches && !full; ++i) {
+         TBranch *b = (TBranch*)fBranches->UncheckedAt(i);
+         if (b->GetDirectory()==0 || b->TestBit(TBranch::kDoNotProcess))
+            continue;
+         if (b->GetDirectory()->GetFile() != fFile)
+            continue;
+         Int_t nb = b->GetWriteBasket();
+         Int_t *lbaskets   = b->GetBasketBytes();
+         Long64_t *entries = b->GetBasketEntry();
+         if (!lbaskets || !entries)
+            continue;
+         Int_t blistsize = b->GetListOfBaskets()->GetSize();
+         for (Int_t j = 0; j < nb; ++j) {
+            if (entries[j] >= clusterEnd)
+               break;
+            if (entries[j + 1] <= clusterStart)
+               continue;
+            // This basket is already in memory.
+            if (j < blistsize && b->GetListOfBaskets()->UncheckedAt(j))
+               continue;
+            Long64_t pos = b->GetBasketSeek(j);
+            Int_t len = lbaskets[j];
+            if (pos <= 0 || len <= 0 || len > fBufferSizeMin)
+               continue;
+            if (ntot + len > maxBytes) {
+               full = kTRUE;
+               break;
+            }
+            blocks.emplace_back(pos, len);
+            ntot += len;
+         }
+      }
+      clusterStart = clusterIter.Next();
+   }
+
+   if (gDebug > 5)
+      Info("StartReadAhead", "Reading ahead %zu baskets (%lld bytes) from entry %lld", blocks.size(), ntot, fEntryNext);
+   fReadAhead->Start(fFile, std::move(blocks), GetDiskCache());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the cache buffer with the blocks registered by FillBuffer: the blocks
+/// read ahead are copied, the others are read from the file (through the local
+/// disk cache, if any).
+/// Returns -1 in case of read failure, 0 otherwise.
+
+Int_t TTreeCache::TransferReadAhead()
+{
+   if (!fReadAhead || fNseek <= 0 || fIsSorted || fAsyncReading)
+      return 0;
+   fReadAhead->Wait();
+   if (!fReadAhead->IsOk() || fReadAhead->GetFile() != fFile)
+      return 0;
+
+   Sort();
+   ROOT::Internal::RDiskCache *diskCache = GetDiskCache();
+   Long64_t fileBytesRead0 = fFile->GetBytesRead();
+   Long64_t fileBytesReadExtra0 = fFile->GetBytesReadExtra();
+   Int_t fileReadCalls0 = fFile->GetReadCalls();
+   Long64_t readAheadBytes = 0;
+
+   // The blocks are stored in fBuffer in the order of their position, hence a
+   // run of consecutive blocks that were not read ahead is read with one call.
+   Int_t firstMissing = -1;
+   for (Int_t i = 0; i <= fNseek; ++i) {
+      if (i < fNseek && !fReadAhead->Get(&fBuffer[fSeekPos[i]], fSeekSort[i], fSeekSortLen[i])) {
+         if (firstMissing < 0)
+            firstMissing = i;
+         continue;
+      }
+      if (i < fNseek)
+         readAheadBytes += fSeekSortLen[i];
+      if (firstMissing >= 0) {
+         if (diskCache ? ReadBuffersDiskCache(diskCache, firstMissing, i - firstMissing)
+                       : fFile->ReadBuffers(&fBuffer[fSeekPos[firstMissing]], &fSeekSort[firstMissing],
+                                            &fSeekSortLen[firstMissing], i - firstMissing)) {
+            return -1;
+         }
+         firstMissing = -1;
+      }
+   }
+   fIsTransferred = kTRUE;
+
+   fReadAheadBytes += readAheadBytes;
+   fBytesRead += fFile->GetBytesRead() - fileBytesRead0 + readAheadBytes;
+   fBytesReadExtra += fFile->GetBytesReadExtra() - fileBytesReadExtra0;
+   fReadCalls += fFile->GetReadCalls() - fileReadCalls0;
+   return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// The name should be enough to explain the method.
 /// The only additional comments is that the cache is cleaned before
@@ -2197,6 +2391,8 @@ void TTreeCache::UpdateBranches(TTree *tree)
    fEntryMax  = fTree->GetEntries();
 
    fEntryCurrent = -1;
+   if (fReadAhead)
+      fReadAhead->Clear();
 
    if (fBrNames->GetEntries() == 0 && fIsLearning) {
       // We still need to learn.
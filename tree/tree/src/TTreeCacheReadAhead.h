@@ -0,0 +1,196 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TTreeCacheReadAhead
+#define ROOT_TTreeCacheReadAhead
+
+#include "Rtypes.h"
+#include "TFile.h"
+#include "TFileCacheRead.h"
+#include "TUrl.h"
+
+#include "ROOT/RDiskCache.hxx"
+#include "ROOT/RRawFile.hxx"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#endif
+
+/// A helper class reading the baskets of the next cluster(s) of a TTreeCache in an IMT task,
+/// while the baskets of the current cluster are being processed (see TTreeCache::SetReadAhead).
+///
+/// The task reads through its own RRawFile on the file of the cache, so that it never shares
+/// the (not thread-safe) TFile with the thread using the cache.  Only local files and the
+/// transports supported by RRawFile can be read ahead.  If the file is kept in a local disk
+/// cache (see TFileCacheRead::GetDiskCache), the task takes the blocks found in the disk cache
+/// from there and stores the blocks it reads from the file in it.
+///
+namespace ROOT {
+namespace Internal {
+
+class TTreeCacheReadAhead {
+
+#ifdef R__USE_IMT
+using TaskGroup_t = ROOT::Experimental::TTaskGroup;
+#endif
+
+public:
+   ~TTreeCacheReadAhead() { Wait(); }
+
+   /// Wait for the task in flight, if any.
+   void Wait() {
+#ifdef R__USE_IMT
+      if (fGroup) fGroup->Wait();
+#endif
+   }
+
+   /// Wait for the task in flight and forget the blocks read so far.
+   void Clear() {
+      Wait();
+      fBlocks.clear();
+      fBuffer.clear();
+      fOk = kFALSE;
+   }
+
+   /// Wait for the task in flight and close the handle on the file.
+   void Close() {
+      Clear();
+      fFile = nullptr;
+      fRawFile.reset();
+   }
+
+   /// Start reading the blocks `(position, length)` of `file` in a task, through `diskCache`
+   /// if not null.  Return false if the file cannot be read by a task, in which case nothing
+   /// is read.
+   Bool_t Start(TFile *file, std::vector<std::pair<Long64_t, Int_t>> &&blocks, RDiskCache *diskCache) {
+      Clear();
+#ifdef R__USE_IMT
+      if (!OpenFile(file) || blocks.empty()) return kFALSE;
+      std::sort(blocks.begin(), blocks.end());
+      blocks.erase(std::unique(blocks.begin(), blocks.end(),
+                               [](const std::pair<Long64_t, Int_t> &a, const std::pair<Long64_t, Int_t> &b) { return a.first == b.first; }),
+                   blocks.end());
+      Long64_t offset = 0;
+      for (auto &block : blocks) {
+         fBlocks.push_back({block.first, block.second, offset});
+         offset += block.second;
+      }
+      fBuffer.resize(offset);
+
+      // Computed here, the task must not touch the TFile.
+      const std::string fileId = diskCache ? TFileCacheRead::GetDiskCacheFileId(file) : std::string();
+
+      if (!fGroup) { fGroup.reset(new TaskGroup_t()); }
+      fGroup->Run([this, diskCache, fileId]() {
+         // Contiguous blocks on file are contiguous in fBuffer: read them with one request.
+         std::vector<RRawFile::RIOVec> ioVec;
+         std::vector<const RBlock *> missing;
+         for (auto &block : fBlocks) {
+            if (diskCache && diskCache->Get(fileId, block.fPos, &fBuffer[block.fOffset], block.fLen))
+               continue;
+            missing.push_back(&block);
+            if (!ioVec.empty() && ioVec.back().fOffset + ioVec.back().fSize == std::uint64_t(block.fPos)) {
+               ioVec.back().fSize += block.fLen;
+               continue;
+            }
+            RRawFile::RIOVec req;
+            req.fBuffer = &fBuffer[block.fOffset];
+            req.fOffset = block.fPos;
+            req.fSize = block.fLen;
+            ioVec.push_back(req);
+         }
+         if (!ioVec.empty()) {
+            try {
+               fRawFile->ReadV(ioVec.data(), ioVec.size());
+            } catch (const std::exception &) {
+               return;
+            }
+         }
+         fOk = std::all_of(ioVec.begin(), ioVec.end(), [](const RRawFile::RIOVec &req) { return req.fOutBytes == req.fSize; });
+         if (fOk && diskCache) {
+            for (auto block : missing)
+               diskCache->Put(fileId, block->fPos, &fBuffer[block->fOffset], block->fLen);
+         }
+      });
+      return kTRUE;
+#else
+      (void)file;
+      (void)blocks;
+      (void)diskCache;
+      return kFALSE;
+#endif
+   }
+
+   /// Copy the block of `len` bytes at position `pos` to `buf` if it was read ahead.
+   /// Must only be called once the task is done (see Wait).
+   Bool_t Get(char *buf, Long64_t pos, Int_t len) const {
+      if (!fOk) return kFALSE;
+      auto block = std::lower_bound(fBlocks.begin(), fBlocks.end(), pos,
+                                    [](const RBlock &b, Long64_t p) { return b.fPos < p; });
+      if (block == fBlocks.end() || block->fPos != pos || block->fLen < len) return kFALSE;
+      memcpy(buf, &fBuffer[block->fOffset], len);
+      return kTRUE;
+   }
+
+   TFile   *GetFile() const { return fFile; }
+   Bool_t   IsOk() const { return fOk; }
+   Long64_t GetBufferSize() const { return fBuffer.size(); }
+
+private:
+   struct RBlock {
+      Long64_t fPos;    // Position of the block in the file.
+      Int_t    fLen;    // Length of the block.
+      Long64_t fOffset; // Position of the block in fBuffer.
+   };
+
+   /// Open a separate handle on `file`, unless it is already open.
+   Bool_t OpenFile(TFile *file) {
+      if (file == fFile) return fRawFile != nullptr;
+      fFile = file;
+      fRawFile.reset();
+      const TUrl *url = file ? file->GetEndpointUrl() : nullptr;
+      if (!url || file->IsWritable()) return kFALSE;
+      std::string protocol = url->GetProtocol();
+      RRawFile::ROptions options;
+      options.fBlockSize = 0; // The blocks are read once, there is no point in buffering them.
+      try {
+         if (protocol == "file" && file->IsA() == TFile::Class()) {
+            fRawFile = RRawFile::Create(url->GetFile(), options);
+         } else if (protocol == "http" || protocol == "https") {
+            fRawFile = RRawFile::Create(url->GetUrl(), options);
+         }
+      } catch (const std::exception &) {
+         fRawFile.reset();
+      }
+      return fRawFile != nullptr;
+   }
+
+   TFile                    *fFile{nullptr}; // The file that fRawFile reads.
+   std::unique_ptr<RRawFile> fRawFile;       // Separate handle on fFile, used by the task only.
+   std::vector<RBlock>       fBlocks;        // Blocks read by the task, sorted by position.
+   std::vector<char>         fBuffer;        // Content of the blocks.
+   Bool_t                    fOk{kFALSE};    // True if the task read all the blocks.
+#ifdef R__USE_IMT
+   std::unique_ptr<TaskGroup_t> fGroup;
+#endif
+};
+
+} // Internal
+} // ROOT
+
+#endif
@@ -6,6 +6,7 @@
 #include "TFile.h"
 #include "TTree.h"
 #include "TStopwatch.h"
+#include "TSystem.h"
 #include "TTreeReader.h"
 #include "TTreeReaderValue.h"
 #include "TTreeReaderArray.h"
@@ -15,6 +16,8 @@
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 class BulkApiVariableTest : public ::testing::Test {
 public:
    static constexpr Long64_t fClusterSize = 1e5;
@@ -235,3 +238,107 @@ TEST_F(BulkApiVariableTest, serializedRead)
    printf("Bulk Serialized API: Successful read of all events.\n");
    printf("Bulk Serialized API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
 }
+
+TEST_F(BulkApiVariableTest, jaggedRead)
+{
+   auto hfile = TFile::Open(fFileName.c_str());
+   printf("Starting read of file %s.\n", fFileName.c_str());
+   TStopwatch sw;
+
+   printf("Using jagged bulk APIs.\n");
+
+   auto tree = dynamic_cast<TTree*>(hfile->Get("T"));
+   ASSERT_TRUE(tree);
+   auto branchFloat = tree->GetBranch("f");
+   ASSERT_TRUE(branchFloat);
+   auto branchDouble = tree->GetBranch("d");
+   ASSERT_TRUE(branchDouble);
+   ASSERT_TRUE(branchFloat->GetBulkRead().SupportsJaggedBulkRead());
+   ASSERT_TRUE(branchDouble->GetBulkRead().SupportsJaggedBulkRead());
+   ASSERT_FALSE(tree->GetBranch("myLen")->GetBulkRead().SupportsJaggedBulkRead());
+
+   float idx_f = 0;
+   double idx_d = 2;
+   Long64_t evt_idx = 0;
+   Long64_t events = fEventCount;
+   Int_t cluster_size = std::min(fClusterSize, fEventCount);
+   TBufferFile floatBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile doubleBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile floatOffsetsBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile doubleOffsetsBuf(TBuffer::kWrite, 32*1024);
+
+   sw.Start();
+   while (events) {
+      auto count = branchFloat->GetBulkRead().GetBulkEntriesJagged(evt_idx, floatBuf, floatOffsetsBuf);
+      ASSERT_EQ(count, cluster_size);
+      count = branchDouble->GetBulkRead().GetBulkEntriesJagged(evt_idx, doubleBuf, doubleOffsetsBuf);
+      ASSERT_EQ(count, cluster_size);
+      events = (events > count) ? events - count : 0;
+
+      auto float_values = reinterpret_cast<float*>(floatBuf.GetCurrent());
+      auto double_values = reinterpret_cast<double*>(doubleBuf.GetCurrent());
+      auto float_offsets = reinterpret_cast<Int_t*>(floatOffsetsBuf.GetCurrent());
+      auto double_offsets = reinterpret_cast<Int_t*>(doubleOffsetsBuf.GetCurrent());
+      for (Int_t idx = 0; idx < count; idx++) {
+         const auto entry_count = float_offsets[idx + 1] - float_offsets[idx];
+         ASSERT_EQ(entry_count, (evt_idx + idx + 1) % 10);
+         ASSERT_EQ(double_offsets[idx + 1] - double_offsets[idx], entry_count);
+         for (Int_t entry_idx = float_offsets[idx]; entry_idx < float_offsets[idx + 1]; entry_idx++) {
+            ASSERT_EQ(float_values[entry_idx], idx_f++);
+         }
+         for (Int_t entry_idx = double_offsets[idx]; entry_idx < double_offsets[idx + 1]; entry_idx++) {
+            ASSERT_EQ(double_values[entry_idx], idx_d++);
+         }
+      }
+      evt_idx += count;
+   }
+   events = fEventCount;
+   ASSERT_EQ(evt_idx, events);
+
+   sw.Stop();
+   printf("Bulk Jagged API: Successful read of all events.\n");
+   printf("Bulk Jagged API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
+}
+
+TEST(BulkApiJagged, VectorBranch)
+{
+   const std::string fileName = "BulkApiTestJaggedVector.root";
+   const Long64_t eventCount = 10000;
+   {
+      TFile f(fileName.c_str(), "RECREATE");
+      TTree tree("T", "A ROOT tree of std::vector branches.");
+      std::vector<float> v;
+      tree.Branch("v", &v);
+      for (Long64_t ev = 0; ev < eventCount; ev++) {
+         v.clear();
+         for (Int_t idx = 0; idx < ev % 5; idx++)
+            v.push_back(ev + idx);
+         tree.Fill();
+      }
+      tree.Write();
+   }
+
+   TFile f(fileName.c_str());
+   auto tree = dynamic_cast<TTree*>(f.Get("T"));
+   ASSERT_TRUE(tree);
+   auto branch = tree->GetBranch("v");
+   ASSERT_TRUE(branch->GetBulkRead().SupportsJaggedBulkRead());
+   TBufferFile valuesBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile offsetsBuf(TBuffer::kWrite, 32*1024);
+   Long64_t evt_idx = 0;
+   while (evt_idx < eventCount) {
+      auto count = branch->GetBulkRead().GetBulkEntriesJagged(evt_idx, valuesBuf, offsetsBuf);
+      ASSERT_GT(count, 0);
+      auto values = reinterpret_cast<float*>(valuesBuf.GetCurrent());
+      auto offsets = reinterpret_cast<Int_t*>(offsetsBuf.GetCurrent());
+      for (Int_t idx = 0; idx < count; idx++) {
+         const Long64_t ev = evt_idx + idx;
+         ASSERT_EQ(offsets[idx + 1] - offsets[idx], ev % 5);
+         for (Int_t entry_idx = 0; entry_idx < ev % 5; entry_idx++)
+            ASSERT_EQ(values[offsets[idx] + entry_idx], ev + entry_idx);
+      }
+      evt_idx += count;
+   }
+   ASSERT_EQ(evt_idx, eventCount);
+   gSystem->Unlink(fileName.c_str());
+}
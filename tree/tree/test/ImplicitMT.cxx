@@ -1,7 +1,9 @@
 #include "TFile.h"
+#include "TNamed.h"
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TTree.h"
+#include "TTreeCache.h"
 
 #include "gtest/gtest.h"
 
@@ -28,4 +30,195 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+TEST(TTreeImplicitMT, pipelinedFill)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "pipelinedFillMT.root";
+   const Long64_t nEntries = 100000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      // Small baskets and budget, so that Fill both pipelines baskets and waits for them.
+      t.SetPipelinedFill(16000);
+      EXPECT_EQ(16000, t.GetPipelinedFill());
+      int i1 = 0;
+      double d1 = 0.;
+      t.Branch("i1", &i1, 1000);
+      t.Branch("d1", &d1, 1000);
+      for (Long64_t i = 0; i < nEntries; ++i) {
+         i1 = i;
+         d1 = 0.5 * i;
+         EXPECT_GE(t.Fill(), 0);
+      }
+      t.Write(); // Drains the baskets being written.
+      EXPECT_EQ(t.GetTotBytes(), t.GetBranch("i1")->GetTotBytes() + t.GetBranch("d1")->GetTotBytes());
+   }
+
+   TFile f(ofileName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(nullptr, t);
+   ASSERT_EQ(nEntries, t->GetEntries());
+   int i1 = 0;
+   double d1 = 0.;
+   t->SetBranchAddress("i1", &i1);
+   t->SetBranchAddress("d1", &d1);
+   for (Long64_t i = 0; i < nEntries; ++i) {
+      t->GetEntry(i);
+      EXPECT_EQ(i, i1);
+      EXPECT_DOUBLE_EQ(0.5 * i, d1);
+   }
+   f.Close();
+   gSystem->Unlink(ofileName);
+}
+
+TEST(TTreeImplicitMT, pipelinedFillOtherWrites)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "pipelinedFillOtherWritesMT.root";
+   const Long64_t nEntries = 50000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetPipelinedFill(16000);
+      Long64_t l1 = 0;
+      t.Branch("l1", &l1, 1000);
+      for (Long64_t i = 0; i < nEntries; ++i) {
+         l1 = i;
+         EXPECT_GE(t.Fill(), 0);
+         // Baskets are being written while other objects are written to the same file
+         if (i % 5000 == 0) {
+            TNamed n(TString::Format("n%lld", i).Data(), "written while filling");
+            EXPECT_GT(f.WriteTObject(&n), 0);
+         }
+         if (i == nEntries / 2) {
+            auto dir = f.mkdir("dir");
+            ASSERT_NE(nullptr, dir);
+            TNamed n("n", "written in a directory while filling");
+            EXPECT_GT(dir->WriteTObject(&n), 0);
+            f.cd();
+         }
+      }
+      f.Write();
+   }
+
+   TFile f(ofileName);
+   for (Long64_t i = 0; i < nEntries; i += 5000) {
+      auto n = f.Get<TNamed>(TString::Format("n%lld", i));
+      ASSERT_NE(nullptr, n);
+      EXPECT_STREQ("written while filling", n->GetTitle());
+   }
+   auto n = f.Get<TNamed>("dir/n");
+   ASSERT_NE(nullptr, n);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(nullptr, t);
+   ASSERT_EQ(nEntries, t->GetEntries());
+   Long64_t l1 = 0;
+   t->SetBranchAddress("l1", &l1);
+   for (Long64_t i = 0; i < nEntries; ++i) {
+      t->GetEntry(i);
+      EXPECT_EQ(i, l1);
+   }
+   f.Close();
+   gSystem->Unlink(ofileName);
+}
+
+TEST(TTreeImplicitMT, pipelinedFillDrain)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "pipelinedFillDrainMT.root";
+   const Long64_t nEntries = 20000;
+   {
+      TFile f(ofileName, "RECREATE");
+      Long64_t l1 = 0;
+
+      // Reset waits for the baskets being written before dropping them
+      TTree t("t", "t");
+      t.SetPipelinedFill(16000);
+      t.Branch("l1", &l1, 1000);
+      for (Long64_t i = 0; i < nEntries; ++i) {
+         l1 = -1;
+         t.Fill();
+      }
+      t.Reset();
+      EXPECT_EQ(0, t.GetEntries());
+      for (Long64_t i = 0; i < nEntries; ++i) {
+         l1 = i;
+         EXPECT_GE(t.Fill(), 0);
+      }
+      t.Write();
+
+      // The destructor waits for the baskets being written and unregisters the tree from the file, which then
+      // writes other objects without waiting for it
+      auto tmp = new TTree("tmp", "tmp");
+      tmp->SetPipelinedFill(16000);
+      tmp->Branch("l1", &l1, 1000);
+      for (Long64_t i = 0; i < nEntries; ++i)
+         tmp->Fill();
+      delete tmp;
+      TNamed n("n", "written after the destruction of a tree");
+      EXPECT_GT(f.WriteTObject(&n), 0);
+   }
+
+   TFile f(ofileName);
+   EXPECT_NE(nullptr, f.Get<TNamed>("n"));
+   EXPECT_EQ(nullptr, f.Get<TTree>("tmp"));
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(nullptr, t);
+   ASSERT_EQ(nEntries, t->GetEntries());
+   Long64_t l1 = 0;
+   t->SetBranchAddress("l1", &l1);
+   for (Long64_t i = 0; i < nEntries; ++i) {
+      t->GetEntry(i);
+      EXPECT_EQ(i, l1);
+   }
+   f.Close();
+   gSystem->Unlink(ofileName);
+}
+
+TEST(TTreeImplicitMT, cacheReadAhead)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "cacheReadAheadMT.root";
+   const Long64_t nEntries = 10000;
+   {
+      // Uncompressed clusters of 1000 entries take about 12 kB.
+      TFile f(ofileName, "RECREATE", "", 0);
+      TTree t("t", "t");
+      t.SetAutoFlush(1000);
+      int i1 = 0;
+      double d1 = 0.;
+      t.Branch("i1", &i1);
+      t.Branch("d1", &d1);
+      for (Long64_t i = 0; i < nEntries; ++i) {
+         i1 = i;
+         d1 = 0.5 * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(ofileName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(nullptr, t);
+   // The cache holds one cluster at a time, the next one is read ahead.
+   t->SetCacheSize(20000);
+   t->AddBranchToCache("*", kTRUE);
+   t->StopCacheLearningPhase();
+   auto cache = dynamic_cast<TTreeCache *>(f.GetCacheRead(t));
+   ASSERT_NE(nullptr, cache);
+   cache->SetReadAhead(16000);
+   int i1 = 0;
+   double d1 = 0.;
+   t->SetBranchAddress("i1", &i1);
+   t->SetBranchAddress("d1", &d1);
+   for (Long64_t i = 0; i < nEntries; ++i) {
+      t->GetEntry(i);
+      EXPECT_EQ(i, i1);
+      EXPECT_DOUBLE_EQ(0.5 * i, d1);
+   }
+   EXPECT_GT(cache->GetReadAheadBytes(), 0);
+   f.Close();
+   gSystem->Unlink(ofileName);
+}
+
 #endif // R__USE_IMT
@@ -88,6 +88,8 @@ private:
    /// User-defined selection of entry numbers to be processed, empty if none was provided
    TEntryList fEntryList;
    const Internal::FriendInfo fFriendInfo;
+   /// Whether the TTreeReaders passed to Process use the entry numbers of the whole dataset (see SetGlobalEntryNumbers)
+   bool fGlobalEntryNumbers = false;
    ROOT::TThreadExecutor fPool; ///<! Thread pool for processing.
 
    /// Thread-local TreeViews
@@ -106,6 +108,7 @@ public:
    TTreeProcessorMT(TTree &tree, UInt_t nThreads = 0u);
 
    void Process(std::function<void(TTreeReader &)> func);
+   void SetGlobalEntryNumbers(bool global);
    static void SetMaxTasksPerFilePerWorker(unsigned int m);
    static unsigned int GetMaxTasksPerFilePerWorker();
 };
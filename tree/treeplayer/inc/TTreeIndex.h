@@ -53,6 +53,7 @@ public:
    virtual               ~TTreeIndex();
    virtual void           Append(const TVirtualIndex *,Bool_t delaySort = kFALSE);
    bool                   ConvertOldToNew();
+   Long64_t               Extend();
    Long64_t               FindValues(Long64_t major, Long64_t minor) const;
    virtual Long64_t       GetEntryNumberFriend(const TTree *parent);
    virtual Long64_t       GetEntryNumberWithIndex(Long64_t major, Long64_t minor) const;
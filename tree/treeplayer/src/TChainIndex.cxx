@@ -26,6 +26,16 @@ and kept inside this chain index.
 #include "TTreeIndex.h"
 #include "TFile.h"
 #include "TError.h"
+#include "TList.h"
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
 
 ////////////////////////////////////////////////////////////////////////////////
 /// \class TChainIndex::TChainIndexEntry
@@ -79,45 +89,76 @@ TChainIndex::TChainIndex(const TTree *T, const char *majorname, const char *mino
    fMinorName          = minorname;
    Int_t i = 0;
 
-   // Go through all the trees and check if they have indeces. If not then build them.
-   for (i = 0; i < chain->GetNtrees(); i++) {
-      chain->LoadTree((chain->GetTreeOffset())[i]);
-      TVirtualIndex *index = chain->GetTree()->GetTreeIndex();
-
-      TChainIndexEntry entry;
-      entry.fTreeIndex = 0;
+   // Fill the entry of the tree in the chain, building its index if it has none.
+   auto setupEntry = [this, majorname, minorname](TTree *tree, TChainIndexEntry &entry) -> Bool_t {
+      TVirtualIndex *index = tree->GetTreeIndex();
 
       //if an index already exists, we must check if major/minorname correspond
       //to the major/minor names in this function call
       if (index) {
          if (strcmp(majorname,index->GetMajorName()) || strcmp(minorname,index->GetMinorName())) {
-            MakeZombie();
-            Error("TChainIndex","Tree in file %s has an index built with majorname=%s and minorname=%s",chain->GetTree()->GetCurrentFile()->GetName(),index->GetMajorName(),index->GetMinorName());
-            return;
+            Error("TChainIndex","Tree in file %s has an index built with majorname=%s and minorname=%s",tree->GetCurrentFile()->GetName(),index->GetMajorName(),index->GetMinorName());
+            return kFALSE;
          }
       }
       if (!index) {
-         chain->GetTree()->BuildIndex(majorname, minorname);
-         index = chain->GetTree()->GetTreeIndex();
-         chain->GetTree()->SetTreeIndex(0);
+         // Not through TTree::BuildIndex, which creates the tree player: the
+         // trees may be set up by concurrent tasks.
+         index = new TTreeIndex(tree, majorname, minorname);
+         index->SetTree(0);
          entry.fTreeIndex = index;
       }
       if (!index || index->IsZombie() || index->GetN() == 0) {
-         DeleteIndices();
-         MakeZombie();
          Error("TChainIndex", "Error creating a tree index on a tree in the chain");
-         return;
+         return kFALSE;
       }
 
       TTreeIndex *ti_index = dynamic_cast<TTreeIndex*>(index);
       if (ti_index == 0) {
          Error("TChainIndex", "The underlying TTree must have a TTreeIndex but has a %s.",
                index->IsA()->GetName());
-         return;
+         return kFALSE;
       }
 
       entry.SetMinMaxFrom(ti_index);
-      fEntries.push_back(entry);
+      return kTRUE;
+   };
+
+   // Go through all the trees and check if they have indeces. If not then build them.
+   fEntries.resize(chain->GetNtrees());
+   Bool_t ok = kTRUE;
+#ifdef R__USE_IMT
+   // The trees are independent: each task opens its own copy of the file
+   // (see TTreeIndex for the trees that cannot be read from their file).
+   TList *friends = chain->GetListOfFriends();
+   if (ROOT::IsImplicitMTEnabled() && fEntries.size() > 1 && !(friends && friends->GetEntries() > 0)) {
+      std::atomic<bool> allOk(true);
+      auto setupTree = [&](unsigned treeNo) {
+         TObject *element = chain->GetListOfFiles()->At(treeNo);
+         std::unique_ptr<TFile> file(TFile::Open(element->GetTitle()));
+         TTree *tree = file && !file->IsZombie() ? dynamic_cast<TTree*>(file->Get(element->GetName())) : nullptr;
+         if (!tree) {
+            Error("TChainIndex", "Cannot read the tree %s in file %s", element->GetName(), element->GetTitle());
+            allOk = false;
+         } else if (!setupEntry(tree, fEntries[treeNo])) {
+            allOk = false;
+         }
+      };
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(setupTree, ROOT::TSeq<unsigned>(fEntries.size()));
+      ok = allOk;
+   } else
+#endif
+   {
+      for (i = 0; i < chain->GetNtrees() && ok; i++) {
+         chain->LoadTree((chain->GetTreeOffset())[i]);
+         ok = setupEntry(chain->GetTree(), fEntries[i]);
+      }
+   }
+   if (!ok) {
+      DeleteIndices();
+      MakeZombie();
+      return;
    }
 
    // Check if the indices of different trees are in order. If not then return an error.
@@ -208,13 +249,13 @@ std::pair<TVirtualIndex*, Int_t> TChainIndex::GetSubTreeIndex(Long64_t major, Lo
       return make_pair(static_cast<TVirtualIndex*>(0), 0);
    }
 
-   Int_t treeNo = fEntries.size() - 1;
-   for (unsigned int i = 0; i < fEntries.size() - 1; i++) {
-      if( indexValue < fEntries[i+1].GetMinIndexValPair() ) {
-         treeNo = i;
-         break;
-      }
-   }
+   // The sub-indices are sorted (see the constructor): binary search for the
+   // last tree whose smallest index value is not greater than indexValue.
+   auto next = std::upper_bound(fEntries.begin(), fEntries.end(), indexValue,
+                                [](const TChainIndexEntry::IndexValPair_t &value, const TChainIndexEntry &entry) {
+                                   return value < entry.GetMinIndexValPair();
+                                });
+   Int_t treeNo = (next - fEntries.begin()) - 1;
    // Double check we found the right range.
    if( indexValue > fEntries[treeNo].GetMaxIndexValPair() ) {
       return make_pair(static_cast<TVirtualIndex*>(0), 0);
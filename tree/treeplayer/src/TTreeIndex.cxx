@@ -17,31 +17,273 @@ A Tree Index with majorname and minorname.
 
 #include "TTreeFormula.h"
 #include "TTree.h"
+#include "TChain.h"
 #include "TBuffer.h"
+#include "TFile.h"
 #include "TMath.h"
+#include "TROOT.h"
+#include "TVirtualMutex.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <queue>
+#include <string>
+#include <vector>
 
 ClassImp(TTreeIndex);
 
+namespace {
+
+/// An entry of the index being built: the 128-bit key (major, minor) packed
+/// with the entry number. Sorting and merging these records touches contiguous
+/// memory, unlike sorting the entry numbers through the arrays of values.
+/// Entries with the same key are ordered by entry number.
+struct IndexRecord {
+   Long64_t fMajor;
+   Long64_t fMinor;
+   Long64_t fEntry;
+
+   bool operator<(const IndexRecord &other) const
+   {
+      if (fMajor != other.fMajor)
+         return fMajor < other.fMajor;
+      if (fMinor != other.fMinor)
+         return fMinor < other.fMinor;
+      return fEntry < other.fEntry;
+   }
+};
 
-struct IndexSortComparator {
+/// Minimum number of entries of a chunk sorted by one task.
+constexpr Long64_t kMinChunkEntries = 65536;
+/// Maximum number of chunks, to bound the cost of the k-way merge.
+constexpr Long64_t kMaxChunks = 256;
 
-  IndexSortComparator(Long64_t *major, Long64_t *minor)
-        : fValMajor(major), fValMinor(minor)
-  {}
+////////////////////////////////////////////////////////////////////////////////
+/// Split the entries [first, last) of tree into chunks made of whole clusters
+/// and return the end of each chunk, relative to first.
 
-   template<typename Index>
-   bool operator()(Index i1, Index i2) {
-      if( *(fValMajor + i1) == *(fValMajor + i2) )
-         return *(fValMinor + i1) < *(fValMinor + i2);
-      else
-         return *(fValMajor + i1) < *(fValMajor + i2);
+std::vector<Long64_t> GetChunkEnds(TTree *tree, Long64_t first, Long64_t last)
+{
+   const Long64_t minEntries = std::max(kMinChunkEntries, (last - first) / kMaxChunks);
+   std::vector<Long64_t> ends;
+   Long64_t chunkStart = first;
+   if (tree && !dynamic_cast<TChain *>(tree)) {
+      auto clusterIter = tree->GetClusterIterator(first);
+      Long64_t clusterStart;
+      while ((clusterStart = clusterIter()) < last) {
+         Long64_t clusterEnd = std::min(clusterIter.GetNextEntry(), last);
+         if (clusterEnd <= clusterStart)
+            break;
+         if (clusterEnd - chunkStart >= minEntries) {
+            ends.push_back(clusterEnd - first);
+            chunkStart = clusterEnd;
+         }
+      }
+   } else {
+      // The clusters of the trees of a chain are not known in advance.
+      for (chunkStart += minEntries; chunkStart < last; chunkStart += minEntries)
+         ends.push_back(chunkStart - first);
    }
+   if (ends.empty() || ends.back() != last - first)
+      ends.push_back(last - first);
+   return ends;
+}
 
-  // pointers to the start of index values tables keeping uppder 64bit and lower 64bit
-  // of combined indexed 128bit value
-  Long64_t *fValMajor, *fValMinor;
-};
+////////////////////////////////////////////////////////////////////////////////
+/// Sort each chunk of records (see GetChunkEnds), in parallel if the implicit
+/// multi-threading is enabled, then merge the sorted chunks into the arrays
+/// major, minor and entries of size records.size().
 
+void SortIndexRecords(std::vector<IndexRecord> &records, const std::vector<Long64_t> &chunkEnds,
+                      Long64_t *major, Long64_t *minor, Long64_t *entries)
+{
+   const unsigned nchunks = chunkEnds.size();
+   auto sortChunk = [&records, &chunkEnds](unsigned chunk) {
+      Long64_t begin = chunk ? chunkEnds[chunk - 1] : 0;
+      std::sort(records.begin() + begin, records.begin() + chunkEnds[chunk]);
+   };
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nchunks > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(sortChunk, ROOT::TSeq<unsigned>(nchunks));
+   } else
+#endif
+   {
+      for (unsigned chunk = 0; chunk < nchunks; ++chunk)
+         sortChunk(chunk);
+   }
+
+   // k-way merge of the sorted chunks, the heap holds the chunks by their smallest record.
+   std::vector<Long64_t> pos(nchunks);
+   auto greater = [&records, &pos](unsigned c1, unsigned c2) { return records[pos[c2]] < records[pos[c1]]; };
+   std::priority_queue<unsigned, std::vector<unsigned>, decltype(greater)> heads(greater);
+   for (unsigned chunk = 0; chunk < nchunks; ++chunk) {
+      pos[chunk] = chunk ? chunkEnds[chunk - 1] : 0;
+      if (pos[chunk] < chunkEnds[chunk])
+         heads.push(chunk);
+   }
+   Long64_t out = 0;
+   while (!heads.empty()) {
+      unsigned chunk = heads.top();
+      heads.pop();
+      const IndexRecord &record = records[pos[chunk]];
+      major[out] = record.fMajor;
+      minor[out] = record.fMinor;
+      entries[out] = record.fEntry;
+      ++out;
+      if (++pos[chunk] < chunkEnds[chunk])
+         heads.push(chunk);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the major and minor formulas for the entries [first, last) of tree.
+/// Stop at the first entry that cannot be loaded.
+
+std::vector<IndexRecord> ReadIndexRecords(TTree *tree, TTreeFormula *majorFormula, TTreeFormula *minorFormula,
+                                          Long64_t first, Long64_t last)
+{
+   std::vector<IndexRecord> records;
+   records.reserve(last - first);
+   Long64_t oldEntry = tree->GetReadEntry();
+   Int_t current = -1;
+   for (Long64_t i = first; i < last; i++) {
+      Long64_t centry = tree->LoadTree(i);
+      if (centry < 0) break;
+      if (tree->GetTreeNumber() != current) {
+         current = tree->GetTreeNumber();
+         majorFormula->UpdateFormulaLeaves();
+         minorFormula->UpdateFormulaLeaves();
+      }
+      records.push_back({(Long64_t) majorFormula->EvalInstance<LongDouble_t>(),
+                         (Long64_t) minorFormula->EvalInstance<LongDouble_t>(), i});
+   }
+   tree->LoadTree(oldEntry);
+   return records;
+}
+
+#ifdef R__USE_IMT
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the names of the trees, the names of the files and the number of
+/// entries of each file that make up tree, for the tasks to read their own
+/// copy of it. Return false if the tree cannot be read that way: if it is in
+/// memory or in a file being written (its last baskets may not be on disk),
+/// or if it has friends.
+
+bool GetTreeFiles(TTree *tree, std::vector<std::string> &treeNames, std::vector<std::string> &fileNames,
+                  std::vector<Long64_t> &fileEntries)
+{
+   if (tree->GetListOfFriends() && tree->GetListOfFriends()->GetEntries() > 0)
+      return false;
+
+   if (auto chain = dynamic_cast<TChain *>(tree)) {
+      const Int_t ntrees = chain->GetNtrees();
+      const Long64_t *offsets = chain->GetTreeOffset();
+      if (ntrees == 0 || offsets[ntrees] != chain->GetEntries())
+         return false;
+      Int_t i = 0;
+      for (TObject *element : *chain->GetListOfFiles()) {
+         // The name of a chain element is the name of the tree, its title the file name.
+         treeNames.emplace_back(element->GetName());
+         fileNames.emplace_back(element->GetTitle());
+         fileEntries.push_back(offsets[i + 1] - offsets[i]);
+         ++i;
+      }
+      return true;
+   }
+
+   TFile *file = tree->GetCurrentFile();
+   if (!file || file->IsWritable())
+      return false;
+   std::string treeName = tree->GetName();
+   for (TDirectory *dir = tree->GetDirectory(); dir && dir != file; dir = dir->GetMotherDir())
+      treeName = std::string(dir->GetName()) + "/" + treeName;
+   treeNames.push_back(treeName);
+   fileNames.emplace_back(file->GetName());
+   fileEntries.push_back(tree->GetEntries());
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the major and minor expressions for the entries [first, last) of
+/// tree in parallel, if the implicit multi-threading is enabled.
+///
+/// Each chunk of clusters (see GetChunkEnds) is read by a task from its own
+/// chain of the files of tree, with formulas of its own, as TTreeProcessorMT
+/// does. Return false, with records empty, if the tree cannot be read that way
+/// (see GetTreeFiles) or if an entry cannot be read: the caller then evaluates
+/// the entries sequentially.
+
+bool ReadIndexRecordsMT(TTree *tree, const char *majorname, const char *minorname, Long64_t first, Long64_t last,
+                        std::vector<IndexRecord> &records)
+{
+   if (!ROOT::IsImplicitMTEnabled())
+      return false;
+   const std::vector<Long64_t> chunkEnds = GetChunkEnds(tree, first, last);
+   std::vector<std::string> treeNames, fileNames;
+   std::vector<Long64_t> fileEntries;
+   if (chunkEnds.size() < 2 || !GetTreeFiles(tree, treeNames, fileNames, fileEntries))
+      return false;
+
+   records.resize(last - first);
+   std::atomic<bool> ok(true);
+   auto readChunk = [&](unsigned chunk) {
+      const Long64_t begin = first + (chunk ? chunkEnds[chunk - 1] : 0);
+      const Long64_t end = first + chunkEnds[chunk];
+      TChain chain;
+      for (std::size_t i = 0; i < fileNames.size(); ++i)
+         chain.Add((fileNames[i] + "/" + treeNames[i]).c_str(), fileEntries[i]);
+      if (chain.LoadTree(begin) < 0) {
+         ok = false;
+         return;
+      }
+      std::unique_ptr<TTreeFormula> majorFormula, minorFormula;
+      {
+         // The compilation of the formulas looks up global lists
+         R__LOCKGUARD(gROOTMutex);
+         majorFormula.reset(new TTreeFormula("Major", majorname, &chain));
+         minorFormula.reset(new TTreeFormula("Minor", minorname, &chain));
+      }
+      if (majorFormula->GetNdim() != 1 || minorFormula->GetNdim() != 1) {
+         ok = false;
+         return;
+      }
+      Int_t current = -1;
+      for (Long64_t i = begin; i < end && ok; i++) {
+         if (chain.LoadTree(i) < 0) {
+            ok = false;
+            break;
+         }
+         if (chain.GetTreeNumber() != current) {
+            current = chain.GetTreeNumber();
+            // The files must not have changed since the tree was opened
+            if (chain.GetTree()->GetEntries() != fileEntries[current]) {
+               ok = false;
+               break;
+            }
+            majorFormula->UpdateFormulaLeaves();
+            minorFormula->UpdateFormulaLeaves();
+         }
+         records[i - first] = {(Long64_t) majorFormula->EvalInstance<LongDouble_t>(),
+                               (Long64_t) minorFormula->EvalInstance<LongDouble_t>(), i};
+      }
+   };
+   ROOT::TThreadExecutor pool;
+   pool.Foreach(readChunk, ROOT::TSeq<unsigned>(chunkEnds.size()));
+   if (!ok) {
+      records.clear();
+      records.shrink_to_fit();
+   }
+   return ok;
+}
+#endif
+
+} // anonymous namespace
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor for TTreeIndex
@@ -73,6 +315,19 @@ TTreeIndex::TTreeIndex(): TVirtualIndex()
 ///
 /// This array is sorted. The sorted fIndex[i] contains the serial number
 /// in the Tree corresponding to the pair "major,minor" in fIndexvalues[i].
+/// Entries with the same pair are sorted by serial number.
+///
+/// When the implicit multi-threading is enabled (see ROOT::EnableImplicitMT),
+/// the index is built by chunks of clusters in parallel: each task reads its
+/// chunk from its own copy of the Tree, opened from the files of the Tree,
+/// evaluates the expressions with formulas of its own and sorts the values;
+/// the sorted chunks are then merged. Trees that are in memory, in a file
+/// being written or that have friends are read sequentially, their values are
+/// still sorted in parallel.
+///
+/// When entries are appended to the Tree after the index is built, the index
+/// can be brought up to date with Extend(), which only evaluates and sorts the
+/// new entries.
 ///
 ///  Once the index is computed, one can retrieve one entry via
 /// ~~~{.cpp}
@@ -145,8 +400,13 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
       return;
    }
 
-   GetMajorFormula();
-   GetMinorFormula();
+   {
+      // The compilation of the formulas looks up global lists, and indices
+      // may be built by concurrent tasks (see TChainIndex)
+      R__LOCKGUARD(gROOTMutex);
+      GetMajorFormula();
+      GetMinorFormula();
+   }
    if (!fMajorFormula || !fMinorFormula) {
       MakeZombie();
       Error("TreeIndex","Cannot build the index with major=%s, minor=%s",fMajorName.Data(), fMinorName.Data());
@@ -164,36 +424,16 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
    //   return;
    //}
 
-   Long64_t *tmp_major = new Long64_t[fN];
-   Long64_t *tmp_minor = new Long64_t[fN];
-   Long64_t i;
-   Long64_t oldEntry = fTree->GetReadEntry();
-   Int_t current = -1;
-   for (i=0;i<fN;i++) {
-      Long64_t centry = fTree->LoadTree(i);
-      if (centry < 0) break;
-      if (fTree->GetTreeNumber() != current) {
-         current = fTree->GetTreeNumber();
-         fMajorFormula->UpdateFormulaLeaves();
-         fMinorFormula->UpdateFormulaLeaves();
-      }
-      tmp_major[i] = (Long64_t) fMajorFormula->EvalInstance<LongDouble_t>();
-      tmp_minor[i] = (Long64_t) fMinorFormula->EvalInstance<LongDouble_t>();
-   }
+   std::vector<IndexRecord> records;
+#ifdef R__USE_IMT
+   if (!ReadIndexRecordsMT(fTree, fMajorName, fMinorName, 0, fN, records))
+#endif
+      records = ReadIndexRecords(fTree, fMajorFormula, fMinorFormula, 0, fN);
+   fN = records.size();
    fIndex = new Long64_t[fN];
-   for(i = 0; i < fN; i++) { fIndex[i] = i; }
-   std::sort(fIndex, fIndex + fN, IndexSortComparator(tmp_major, tmp_minor) );
-   //TMath::Sort(fN,w,fIndex,0);
    fIndexValues = new Long64_t[fN];
    fIndexValuesMinor = new Long64_t[fN];
-   for (i=0;i<fN;i++) {
-      fIndexValues[i] = tmp_major[fIndex[i]];
-      fIndexValuesMinor[i] = tmp_minor[fIndex[i]];
-   }
-
-   delete [] tmp_major;
-   delete [] tmp_minor;
-   fTree->LoadTree(oldEntry);
+   SortIndexRecords(records, GetChunkEnds(fTree, 0, fN), fIndexValues, fIndexValuesMinor, fIndex);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -265,30 +505,83 @@ void TTreeIndex::Append(const TVirtualIndex *add, Bool_t delaySort )
 
    // Sort.
    if (!delaySort) {
-      Long64_t *addValues = GetIndexValues();
-      Long64_t *addValues2 = GetIndexValuesMinor();
-      Long64_t *ind = fIndex;
-      Long64_t *conv = new Long64_t[fN];
+      std::vector<IndexRecord> records(fN);
+      for (Long64_t i = 0; i < fN; i++) {
+         records[i] = {fIndexValues[i], fIndexValuesMinor[i], fIndex[i]};
+      }
+      SortIndexRecords(records, GetChunkEnds(nullptr, 0, fN), fIndexValues, fIndexValuesMinor, fIndex);
+   }
+}
 
-      for(Long64_t i = 0; i < fN; i++) { conv[i] = i; }
-      std::sort(conv, conv+fN, IndexSortComparator(addValues, addValues2) );
-      //Long64_t *w = fIndexValues;
-      //TMath::Sort(fN,w,conv,0);
+////////////////////////////////////////////////////////////////////////////////
+/// Add to the index the entries appended to the tree since the index was
+/// built (or last extended).
+///
+/// Only the new entries are evaluated and sorted (as in the constructor);
+/// they are then merged with the entries already in the index, instead of
+/// rebuilding the index from scratch.
+///
+/// The return value is the number of entries in the index (< 0 indicates failure).
 
-      fIndex = new Long64_t[fN];
-      fIndexValues = new Long64_t[fN];
-      fIndexValuesMinor = new Long64_t[fN];
+Long64_t TTreeIndex::Extend()
+{
+   if (!fTree || IsZombie()) return -1;
+   Long64_t nentries = fTree->GetEntries();
+   if (nentries <= fN) return fN;
 
-      for (Int_t i=0;i<fN;i++) {
-         fIndex[i] = ind[conv[i]];
-         fIndexValues[i] = addValues[conv[i]];
-         fIndexValuesMinor[i] = addValues2[conv[i]];
+   GetMajorFormula();
+   GetMinorFormula();
+   if (!fMajorFormula || !fMinorFormula ||
+       (fMajorFormula->GetNdim() != 1) || (fMinorFormula->GetNdim() != 1)) {
+      Error("Extend","Cannot extend the index with major=%s, minor=%s",fMajorName.Data(), fMinorName.Data());
+      return -1;
+   }
+
+   std::vector<IndexRecord> records;
+#ifdef R__USE_IMT
+   if (!ReadIndexRecordsMT(fTree, fMajorName, fMinorName, fN, nentries, records))
+#endif
+      records = ReadIndexRecords(fTree, fMajorFormula, fMinorFormula, fN, nentries);
+   Long64_t nadd = records.size();
+   std::vector<Long64_t> addIndex(nadd), addValues(nadd), addValuesMinor(nadd);
+   SortIndexRecords(records, GetChunkEnds(fTree, fN, fN + nadd), addValues.data(), addValuesMinor.data(),
+                    addIndex.data());
+   records.clear();
+   records.shrink_to_fit();
+
+   Long64_t *oldIndex = fIndex;
+   Long64_t *oldValues = fIndexValues;
+   Long64_t *oldValuesMinor = fIndexValuesMinor;
+   Long64_t oldn = fN;
+   fN += nadd;
+   fIndex = new Long64_t[fN];
+   fIndexValues = new Long64_t[fN];
+   fIndexValuesMinor = new Long64_t[fN];
+
+   // Merge; with equal keys, the entries already indexed come first as they
+   // have the lower entry numbers.
+   Long64_t i = 0, j = 0;
+   for (Long64_t k = 0; k < fN; k++) {
+      Bool_t takeAdded = (i == oldn) ||
+                         (j < nadd && (addValues[j] < oldValues[i] ||
+                                       (addValues[j] == oldValues[i] && addValuesMinor[j] < oldValuesMinor[i])));
+      if (takeAdded) {
+         fIndex[k] = addIndex[j];
+         fIndexValues[k] = addValues[j];
+         fIndexValuesMinor[k] = addValuesMinor[j];
+         j++;
+      } else {
+         fIndex[k] = oldIndex[i];
+         fIndexValues[k] = oldValues[i];
+         fIndexValuesMinor[k] = oldValuesMinor[i];
+         i++;
       }
-      delete [] addValues;
-      delete [] addValues2;
-      delete [] ind;
-      delete [] conv;
    }
+
+   delete [] oldIndex;
+   delete [] oldValues;
+   delete [] oldValuesMinor;
+   return fN;
 }
 
 
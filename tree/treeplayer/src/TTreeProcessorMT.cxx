@@ -568,9 +568,10 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    // Otherwise we can do it later, concurrently for each file, and clusters will contain local entry numbers.
    // TODO: in practice we could also find clusters per-file in the case of no friends and a TEntryList with
    // sub-entrylists.
+   // The same holds if the user asked for global entry numbers.
    const bool hasFriends = !friendNames.empty();
    const bool hasEntryList = fEntryList.GetN() > 0;
-   const bool shouldRetrieveAllClusters = hasFriends || hasEntryList;
+   const bool shouldRetrieveAllClusters = hasFriends || hasEntryList || fGlobalEntryNumbers;
    ClustersAndEntries clusterAndEntries{};
    if (shouldRetrieveAllClusters) {
       clusterAndEntries = MakeClusters(fTreeNames, fFileNames);
@@ -638,3 +639,15 @@ void TTreeProcessorMT::SetMaxTasksPerFilePerWorker(unsigned int maxTasksPerFile)
 {
    fgMaxTasksPerFilePerWorker = maxTasksPerFile;
 }
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Sets whether the TTreeReaders passed to Process use the entry numbers of the whole dataset.
+/// \param[in] global If true, the entry ranges of the readers are relative to the whole chain (or to the TEntryList,
+/// if one was provided), otherwise they can be relative to the file of the task.
+///
+/// Global entry numbers require opening all the files upfront to retrieve their clusters, rather than concurrently
+/// in the task of each file. Files with friends or entry lists always use global entry numbers.
+void TTreeProcessorMT::SetGlobalEntryNumbers(bool global)
+{
+   fGlobalEntryNumbers = global;
+}
@@ -0,0 +1,212 @@
+#include "TChain.h"
+#include "TChainIndex.h"
+#include "TFile.h"
+#include "TROOT.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeIndex.h"
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+void FillTree(TTree &tree, Int_t &run, Int_t &event, Long64_t first, Long64_t last)
+{
+   for (Long64_t i = first; i < last; ++i) {
+      run = (i * 31) % 97;
+      event = i;
+      tree.Fill();
+   }
+}
+
+void CheckIndex(const TTreeIndex &index, Long64_t n)
+{
+   ASSERT_EQ(n, index.GetN());
+   const Long64_t *major = index.GetIndexValues();
+   const Long64_t *minor = index.GetIndexValuesMinor();
+   const Long64_t *entries = index.GetIndex();
+   for (Long64_t i = 1; i < n; ++i) {
+      ASSERT_TRUE(major[i - 1] < major[i] || (major[i - 1] == major[i] && minor[i - 1] < minor[i]));
+   }
+   for (Long64_t i = 0; i < n; ++i) {
+      EXPECT_EQ(major[i], (entries[i] * 31) % 97);
+      EXPECT_EQ(minor[i], entries[i]);
+      EXPECT_EQ(entries[i], index.GetEntryNumberWithIndex(major[i], minor[i]));
+   }
+}
+
+void BuildAndCheck()
+{
+   // Enough entries for the values to be sorted in several chunks
+   const Long64_t n = 200000;
+   Int_t run, event;
+   TTree tree("t", "t");
+   tree.SetAutoFlush(10000);
+   tree.Branch("run", &run);
+   tree.Branch("event", &event);
+   FillTree(tree, run, event, 0, n);
+
+   TTreeIndex index(&tree, "run", "event");
+   CheckIndex(index, n);
+}
+
+void WriteTree(const char *fileName, Long64_t first, Long64_t last)
+{
+   Int_t run, event;
+   TFile file(fileName, "RECREATE");
+   TTree tree("t", "t");
+   tree.SetAutoFlush(10000);
+   tree.Branch("run", &run);
+   tree.Branch("event", &event);
+   FillTree(tree, run, event, first, last);
+   file.Write();
+}
+
+} // anonymous namespace
+
+TEST(TTreeIndex, Build)
+{
+   BuildAndCheck();
+}
+
+#ifdef R__USE_IMT
+TEST(TTreeIndex, BuildMT)
+{
+   ROOT::EnableImplicitMT(4);
+   BuildAndCheck();
+   ROOT::DisableImplicitMT();
+}
+
+TEST(TTreeIndex, BuildMTFromFile)
+{
+   // The formulas are evaluated by the tasks on their own copy of the tree
+   const Long64_t n = 200000;
+   WriteTree("treeindex_buildmt.root", 0, n);
+   ROOT::EnableImplicitMT(4);
+   {
+      std::unique_ptr<TFile> file(TFile::Open("treeindex_buildmt.root"));
+      auto tree = file->Get<TTree>("t");
+      ASSERT_NE(nullptr, tree);
+      TTreeIndex index(tree, "run", "event");
+      CheckIndex(index, n);
+   }
+   {
+      TChain chain("t");
+      chain.Add("treeindex_buildmt.root");
+      chain.Add("treeindex_buildmt.root");
+      TTreeIndex index(&chain, "run", "event % 200000");
+      ASSERT_EQ(2 * n, index.GetN());
+      // Equal keys in both files are ordered by entry number
+      const Long64_t *entries = index.GetIndex();
+      for (Long64_t i = 0; i < 2 * n; i += 2) {
+         EXPECT_EQ(entries[i] + n, entries[i + 1]);
+      }
+   }
+   ROOT::DisableImplicitMT();
+   gSystem->Unlink("treeindex_buildmt.root");
+}
+
+TEST(TChainIndex, BuildMT)
+{
+   const Long64_t n = 1000;
+   const char *fileNames[] = {"treeindex_chainmt_0.root", "treeindex_chainmt_1.root", "treeindex_chainmt_2.root"};
+   for (Long64_t i = 0; i < 3; ++i)
+      WriteTree(fileNames[i], i * n, (i + 1) * n);
+
+   ROOT::EnableImplicitMT(4);
+   {
+      TChain chain("t");
+      for (auto fileName : fileNames)
+         chain.Add(fileName);
+      // The per-file indices are built by one task per file
+      ASSERT_EQ(3, chain.BuildIndex("event"));
+      ASSERT_NE(nullptr, dynamic_cast<TChainIndex *>(chain.GetTreeIndex()));
+      for (Long64_t i = 0; i < 3 * n; i += 7) {
+         EXPECT_EQ(i, chain.GetEntryNumberWithIndex(i, 0));
+      }
+      EXPECT_EQ(-1, chain.GetEntryNumberWithIndex(3 * n, 0));
+   }
+   ROOT::DisableImplicitMT();
+   for (auto fileName : fileNames)
+      gSystem->Unlink(fileName);
+}
+
+TEST(TChainIndex, BuildMTManyFiles)
+{
+   // More files than threads, each task builds several sub-indices
+   const Long64_t n = 500;
+   const Int_t nfiles = 12;
+   for (Int_t i = 0; i < nfiles; ++i)
+      WriteTree(TString::Format("treeindex_chainmt_many_%d.root", i), i * n, (i + 1) * n);
+   auto makeChain = [&]() {
+      auto chain = std::make_unique<TChain>("t");
+      for (Int_t i = 0; i < nfiles; ++i)
+         chain->Add(TString::Format("treeindex_chainmt_many_%d.root", i));
+      return chain;
+   };
+
+   auto serialChain = makeChain();
+   TChainIndex serial(serialChain.get(), "event", "run");
+   ASSERT_FALSE(serial.IsZombie());
+
+   ROOT::EnableImplicitMT(2);
+   auto mtChain = makeChain();
+   TChainIndex mt(mtChain.get(), "event", "run");
+   ROOT::DisableImplicitMT();
+   ASSERT_FALSE(mt.IsZombie());
+   ASSERT_EQ(serial.GetN(), mt.GetN());
+   EXPECT_EQ(nfiles, mt.GetN());
+
+   for (Long64_t event = -1; event <= nfiles * n; ++event) {
+      const Long64_t run = (event * 31) % 97;
+      EXPECT_EQ(serial.GetEntryNumberWithIndex(event, run), mt.GetEntryNumberWithIndex(event, run));
+      EXPECT_EQ(serial.GetEntryNumberWithBestIndex(event, run), mt.GetEntryNumberWithBestIndex(event, run));
+      // Keys that are not in the index
+      EXPECT_EQ(serial.GetEntryNumberWithIndex(event, run + 1), mt.GetEntryNumberWithIndex(event, run + 1));
+   }
+   EXPECT_EQ(3 * n + 2, mt.GetEntryNumberWithIndex(3 * n + 2, ((3 * n + 2) * 31) % 97));
+
+   for (Int_t i = 0; i < nfiles; ++i)
+      gSystem->Unlink(TString::Format("treeindex_chainmt_many_%d.root", i));
+}
+#endif
+
+TEST(TTreeIndex, SameKeys)
+{
+   Int_t run = 1, event = 2;
+   TTree tree("t", "t");
+   tree.Branch("run", &run);
+   tree.Branch("event", &event);
+   for (Int_t i = 0; i < 100; ++i)
+      tree.Fill();
+
+   TTreeIndex index(&tree, "run", "event");
+   ASSERT_EQ(100, index.GetN());
+   // Entries with the same key are sorted by entry number
+   for (Long64_t i = 0; i < 100; ++i)
+      EXPECT_EQ(i, index.GetIndex()[i]);
+   EXPECT_EQ(0, index.GetEntryNumberWithIndex(1, 2));
+}
+
+TEST(TTreeIndex, Extend)
+{
+   Int_t run, event;
+   TTree tree("t", "t");
+   tree.Branch("run", &run);
+   tree.Branch("event", &event);
+   FillTree(tree, run, event, 0, 1000);
+   ASSERT_EQ(1000, tree.BuildIndex("run", "event"));
+   auto index = dynamic_cast<TTreeIndex *>(tree.GetTreeIndex());
+   ASSERT_NE(nullptr, index);
+
+   EXPECT_EQ(-1, index->GetEntryNumberWithIndex((1500 * 31) % 97, 1500));
+   FillTree(tree, run, event, 1000, 2000);
+   EXPECT_EQ(2000, index->Extend());
+   CheckIndex(*index, 2000);
+   EXPECT_EQ(1500, tree.GetEntryNumberWithIndex((1500 * 31) % 97, 1500));
+
+   // Nothing new to index
+   EXPECT_EQ(2000, index->Extend());
+}